@@ -0,0 +1,17 @@
+#version 300 es 
+precision highp float;
+in vec3 fragNormal;
+
+uniform vec4 colDiffuse;
+uniform float u_emissive;
+
+out vec4 finalColor;
+
+void main() {
+    vec3 normal = normalize(fragNormal);
+    vec3 lightDir = normalize(vec3(0.5f, 1.0f, 0.3f));
+    float diff = max(dot(normal, lightDir), 0.0f);
+    // 自发光为主, 漫反射只保留体积感
+    vec3 rgb = colDiffuse.rgb * (u_emissive + diff * 0.3f);
+    finalColor = vec4(rgb, colDiffuse.a);
+}
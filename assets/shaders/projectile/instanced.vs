@@ -0,0 +1,15 @@
+#version 300 es 
+precision highp float;
+in vec3 vertexPosition;
+in vec3 vertexNormal;
+// 每个实例的模型矩阵, 由 DrawMeshInstanced 上传
+in mat4 instanceTransform;
+
+uniform mat4 mvp;
+
+out vec3 fragNormal;
+
+void main() {
+    fragNormal = normalize(mat3(instanceTransform) * vertexNormal);
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0f);
+}
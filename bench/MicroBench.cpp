@@ -0,0 +1,514 @@
+// 微基准: 单独测量数学库与核心基础操作的单次耗时, 用于定位热点与发现回归
+// 用法: NW_MicroBench [输出=micro_bench.json] [样本数=50] [过滤子串=*] [基线.json] [标签]
+//       NW_MicroBench check    只做正确性检查 (RenderQueue 排序键), 失败返回非 0
+//       每个用例先预热, 再校准每个样本的内层次数 (约 200us), 之后采样并统计 ns/op 的分位数
+//       给出基线时按 p50 对比, 超过 15% 记为回归, 返回非 0
+#include "Engine/Config/Config.h"
+#include "Engine/Math/Math.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Core/Events/EventManager.h"
+#include "Engine/Graphics/Renderer.h"
+#include "Engine/Graphics/RenderQueue/RenderQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+// 由 CMake 在配置时写入, 便于跨提交比较
+#ifndef NW_GIT_REVISION
+#define NW_GIT_REVISION ""
+#endif
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t DATA_SIZE = 1024; // 输入轮换使用, 2 的幂
+    constexpr double WARMUP_MS = 20.0;
+    constexpr double SAMPLE_NS = 200000.0;
+    constexpr double REGRESSION_RATIO = 1.15;
+
+    // 阻止编译器把结果当作无用代码删掉
+    volatile char g_sink;
+    template <typename T>
+    inline void Keep(const T &value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        g_sink = *reinterpret_cast<const volatile char *>(&value);
+#endif
+    }
+
+    struct MicroCase
+    {
+        std::string name;
+        // 执行 iterations 次被测操作
+        std::function<void(size_t iterations)> body;
+    };
+
+    struct MicroResult
+    {
+        std::string name;
+        size_t iterations = 0; // 每个样本的内层次数
+        double minNs = 0.0, meanNs = 0.0, p50Ns = 0.0, p95Ns = 0.0, p99Ns = 0.0, maxNs = 0.0;
+    };
+
+    double RunOnce(const MicroCase &c, size_t iterations)
+    {
+        auto start = Clock::now();
+        c.body(iterations);
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    MicroResult Measure(const MicroCase &c, int samples)
+    {
+        // 预热: 填充缓存与分支预测, 并让频率稳定下来
+        auto warmupStart = Clock::now();
+        while (std::chrono::duration<double, std::milli>(Clock::now() - warmupStart).count() < WARMUP_MS)
+            c.body(DATA_SIZE);
+
+        // 校准内层次数, 使单个样本远大于计时器精度
+        size_t iterations = 1;
+        while (iterations < ((size_t)1 << 30) && RunOnce(c, iterations) < SAMPLE_NS)
+            iterations *= 2;
+
+        std::vector<double> perOp(samples);
+        for (int s = 0; s < samples; s++)
+            perOp[s] = RunOnce(c, iterations) / (double)iterations;
+        std::sort(perOp.begin(), perOp.end());
+        auto percentile = [&perOp](double p)
+        {
+            return perOp[std::min(perOp.size() - 1, (size_t)(p * (perOp.size() - 1) + 0.5))];
+        };
+
+        MicroResult result;
+        result.name = c.name;
+        result.iterations = iterations;
+        result.minNs = perOp.front();
+        result.maxNs = perOp.back();
+        double sum = 0.0;
+        for (double ns : perOp)
+            sum += ns;
+        result.meanNs = sum / samples;
+        result.p50Ns = percentile(0.5);
+        result.p95Ns = percentile(0.95);
+        result.p99Ns = percentile(0.99);
+        return result;
+    }
+
+    struct MicroEvent : public IEvent
+    {
+        EVENT_TYPE(MicroEvent)
+        int value = 0;
+    };
+
+    std::vector<MicroCase> BuildCases()
+    {
+        std::mt19937 rng(2024);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        auto randomVector = [&](float scale)
+        { return Vector3f(unit(rng), unit(rng), unit(rng)) * scale; };
+        auto randomQuat = [&]
+        { return Quat4f(unit(rng), unit(rng), unit(rng), unit(rng)).normalized(); };
+
+        // 用例共享的输入, 由 lambda 按值捕获 shared_ptr 持有
+        struct Data
+        {
+            std::vector<Vector3f> v0, v1;
+            std::vector<float> scalars;
+            std::vector<Vector4f> v4;
+            std::vector<Matrix4f> m0, m1;
+            std::vector<Quat4f> q0, q1, rawQ;
+            std::vector<AABB> aabbs;
+            std::vector<renderAABB> renderBoxes;
+            std::vector<HitBox> boxes, spheres;
+            Frustum frustum;
+            EventManager emptyEvents, oneEvent, manyEvents;
+            int received = 0;
+            std::vector<RenderMaterial> materials;
+            std::vector<Mesh> meshes;
+            RenderQueue queue;
+        };
+        auto d = std::make_shared<Data>();
+        for (size_t i = 0; i < DATA_SIZE; i++)
+        {
+            d->v0.push_back(randomVector(10.0f));
+            d->v1.push_back(randomVector(10.0f));
+            d->scalars.push_back(unit(rng));
+            d->v4.push_back(Vector4f(randomVector(10.0f), 1.0f));
+            const Quat4f q = randomQuat();
+            d->m0.push_back(Matrix4f::CreateTransform(randomVector(50.0f), q, Vector3f(1.0f, 2.0f, 0.5f)));
+            d->m1.push_back(Matrix4f::CreateTransform(randomVector(50.0f), randomQuat(), Vector3f(1.0f, 1.0f, 1.0f)));
+            d->q0.push_back(q);
+            d->q1.push_back(randomQuat());
+            d->rawQ.push_back(Quat4f(unit(rng), unit(rng), unit(rng), unit(rng)) * 3.0f);
+
+            // 约一半相交
+            const Vector3f c = randomVector(4.0f);
+            const Vector3f e(1.0f + std::fabs(unit(rng)), 1.0f + std::fabs(unit(rng)), 1.0f + std::fabs(unit(rng)));
+            d->aabbs.push_back(AABB(c - e, c + e));
+            const Vector3f rc = randomVector(200.0f);
+            d->renderBoxes.push_back(renderAABB(rc - e, rc + e));
+
+            HitBox box, sphere;
+            box.setHitboxBox(c, q, AABB(-e, e));
+            sphere.setHitboxSphere(randomVector(4.0f), Quat4f::IDENTITY, 1.0f + std::fabs(unit(rng)));
+            d->boxes.push_back(box);
+            d->spheres.push_back(sphere);
+        }
+        // 相机在原点看向 -Z, 一部分盒子在视锥外
+        const Matrix4f projection = Matrix4f::perspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 150.0f, false);
+        d->frustum.Extract(projection * Matrix4f::lookAt(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 0.0f, -1.0f), Vector3f(0.0f, 1.0f, 0.0f)));
+        d->oneEvent.Subscribe<MicroEvent>([d = d.get()](const MicroEvent &e)
+                                          { d->received += e.value; });
+        for (int i = 0; i < 8; i++)
+            d->manyEvents.Subscribe<MicroEvent>([d = d.get()](const MicroEvent &e)
+                                                { d->received += e.value; });
+
+        // 渲染队列只做键编码与排序, 不需要 GL 上下文
+        d->materials.resize(16);
+        for (size_t i = 0; i < d->materials.size(); i++)
+            d->materials[i].blendMode = i % 4 == 0 ? BLEND_ALPHA : BLEND_OPIQUE;
+        d->meshes.resize(64, Mesh{});
+
+        const size_t mask = DATA_SIZE - 1;
+        std::vector<MicroCase> cases;
+        auto add = [&cases](const std::string &name, std::function<void(size_t)> body)
+        { cases.push_back({name, std::move(body)}); };
+
+        // Vector3f
+        add("Vector3f.add_scale", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Vector3f r = d->v0[i & mask] + d->v1[i & mask] * d->scalars[i & mask]; Keep(r); } });
+        add("Vector3f.dot", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { float r = d->v0[i & mask] * d->v1[i & mask]; Keep(r); } });
+        add("Vector3f.cross", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Vector3f r = d->v0[i & mask] ^ d->v1[i & mask]; Keep(r); } });
+        add("Vector3f.length", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { float r = d->v0[i & mask].Length(); Keep(r); } });
+        add("Vector3f.normalized", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Vector3f r = d->v0[i & mask].Normalized(); Keep(r); } });
+
+        // Matrix4f
+        add("Matrix4f.mul", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Matrix4f r = d->m0[i & mask] * d->m1[i & mask]; Keep(r); } });
+        add("Matrix4f.mul_vec4", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Vector4f r = d->m0[i & mask] * d->v4[i & mask]; Keep(r); } });
+        add("Matrix4f.inverse", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Matrix4f r = d->m0[i & mask].inverse(); Keep(r); } });
+        add("Matrix4f.create_transform", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Matrix4f r = Matrix4f::CreateTransform(d->v0[i & mask], d->q0[i & mask], d->v1[i & mask]); Keep(r); } });
+
+        // Quat4f
+        add("Quat4f.normalize", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Quat4f r = d->rawQ[i & mask]; r.normalize(); Keep(r); } });
+        add("Quat4f.mul", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Quat4f r = d->q0[i & mask] * d->q1[i & mask]; Keep(r); } });
+        add("Quat4f.rotate_vec3", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Vector3f r = d->q0[i & mask] * d->v0[i & mask]; Keep(r); } });
+        add("Quat4f.slerp", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { Quat4f r = Quat4f::slerp(d->q0[i & mask], d->q1[i & mask], 0.3f); Keep(r); } });
+
+        // 碰撞
+        add("AABB.IsCollide", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { bool r = AABB::IsCollide(d->aabbs[i & mask], d->aabbs[(i + 1) & mask]); Keep(r); } });
+        auto collide = [mask](const std::vector<HitBox> &a, const std::vector<HitBox> &b, size_t n)
+        {
+            Vector3f normal, hitPoint;
+            float penetration = 0.0f;
+            for (size_t i = 0; i < n; i++)
+            {
+                bool r = HitBox::GetCollisionInfo(a[i & mask], b[(i + 1) & mask], normal, penetration, hitPoint);
+                Keep(r);
+                Keep(penetration);
+            }
+        };
+        add("HitBox.GetCollisionInfo.box_box", [d, collide](size_t n)
+            { collide(d->boxes, d->boxes, n); });
+        add("HitBox.GetCollisionInfo.sphere_box", [d, collide](size_t n)
+            { collide(d->spheres, d->boxes, n); });
+        add("HitBox.GetCollisionInfo.sphere_sphere", [d, collide](size_t n)
+            { collide(d->spheres, d->spheres, n); });
+
+        // 渲染剔除
+        add("Frustum.IsBoxVisible", [d, mask](size_t n)
+            { for (size_t i = 0; i < n; i++) { bool r = d->frustum.IsBoxVisible(d->renderBoxes[i & mask]); Keep(r); } });
+
+        // 事件分发
+        auto emit = [d](EventManager &events, size_t n)
+        {
+            MicroEvent e;
+            for (size_t i = 0; i < n; i++)
+            {
+                e.value = (int)i;
+                events.Emit(e);
+            }
+            Keep(d->received);
+        };
+        add("EventManager.Emit.no_subscriber", [d, emit](size_t n)
+            { emit(d->emptyEvents, n); });
+        add("EventManager.Emit.1_subscriber", [d, emit](size_t n)
+            { emit(d->oneEvent, n); });
+        add("EventManager.Emit.8_subscribers", [d, emit](size_t n)
+            { emit(d->manyEvents, n); });
+
+        // 每次操作为 1024 项的入队 + 排序
+        add("RenderQueue.build_sort_1k", [d, mask](size_t n)
+            {
+            RenderItem item;
+            for (size_t i = 0; i < n; i++)
+            {
+                d->queue.Clear();
+                for (size_t k = 0; k < DATA_SIZE; k++)
+                {
+                    item.material = &d->materials[k % d->materials.size()];
+                    item.mesh = &d->meshes[(k * 7) % d->meshes.size()];
+                    d->queue.Push(item, 0, (uint32_t)(k % 2), std::fabs(d->v0[k & mask].z()) * 10.0f, 100.0f);
+                }
+                d->queue.Sort();
+                Keep(d->queue.KeyAt(0));
+            } });
+        return cases;
+    }
+
+    json MachineInfo()
+    {
+        json machine = json::object();
+#if defined(_MSC_VER)
+        machine["compiler"] = "msvc " + std::to_string(_MSC_VER);
+#elif defined(__clang__)
+        machine["compiler"] = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        machine["compiler"] = std::string("gcc ") + __VERSION__;
+#endif
+#if defined(NDEBUG)
+        machine["build"] = "release";
+#else
+        machine["build"] = "debug";
+#endif
+        machine["hardwareThreads"] = std::thread::hardware_concurrency();
+        return machine;
+    }
+
+    std::string Timestamp()
+    {
+        std::time_t now = std::time(nullptr);
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        return buffer;
+    }
+
+    // 返回回归的用例数; 基线中没有的用例忽略
+    int CompareWithBaseline(const std::string &path, const std::vector<MicroResult> &results)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            std::cerr << "[MicroBench]: Failed to open baseline " << path << std::endl;
+            return 0;
+        }
+        json baseline = json::parse(file, nullptr, false);
+        if (baseline.is_discarded() || !baseline.contains("results"))
+        {
+            std::cerr << "[MicroBench]: Invalid baseline " << path << std::endl;
+            return 0;
+        }
+
+        std::cout << "[MicroBench]: compare with " << path << " (" << baseline.value("revision", "") << ")" << std::endl;
+        int regressions = 0;
+        for (const auto &result : results)
+        {
+            for (const auto &base : baseline["results"])
+            {
+                if (base.value("name", "") != result.name)
+                    continue;
+                const double baseNs = base.value("p50Ns", 0.0);
+                const double ratio = baseNs > 0.0 ? result.p50Ns / baseNs : 1.0;
+                const bool regressed = ratio > REGRESSION_RATIO;
+                regressions += regressed ? 1 : 0;
+                std::cout << "  " << result.name << ": " << baseNs << " -> " << result.p50Ns << " ns (x" << ratio << ")"
+                          << (regressed ? "  REGRESSION" : "") << std::endl;
+                break;
+            }
+        }
+        return regressions;
+    }
+
+    // 不需要 GL: 排序键编解码往返, 以及排序后的提交顺序
+    int RunRenderQueueCheck()
+    {
+        using namespace RenderSortKey;
+        std::cout << "[MicroBench]: RenderQueue check" << std::endl;
+        int failures = 0;
+        auto expect = [&failures](bool ok, const std::string &what)
+        {
+            if (!ok)
+            {
+                failures++;
+                std::cerr << "  FAIL: " << what << std::endl;
+            }
+        };
+
+        std::mt19937 rng(7);
+        auto field = [&rng](int bits)
+        { return (uint32_t)(rng() & ((uint32_t(1) << bits) - 1)); };
+        for (int i = 0; i < 10000; i++)
+        {
+            Fields in;
+            in.view = field(VIEW_BITS);
+            in.rt = field(RT_BITS);
+            in.transparent = (rng() & 1) != 0;
+            in.pass = field(PASS_BITS);
+            in.shader = field(SHADER_BITS);
+            in.material = field(MATERIAL_BITS);
+            in.mesh = field(MESH_BITS);
+            in.depth = field(DEPTH_BITS);
+            const Fields out = Decode(Encode(in));
+            if (out.view != in.view || out.rt != in.rt || out.transparent != in.transparent || out.pass != in.pass ||
+                out.shader != in.shader || out.material != in.material || out.mesh != in.mesh || out.depth != in.depth)
+            {
+                expect(false, "Encode/Decode round-trip, sample " + std::to_string(i));
+                break;
+            }
+        }
+
+        // 4 个 shader, 12 个材质 (每 3 个共用一个 shader), 其中 4 个半透明; 入队顺序打乱
+        const size_t SHADERS = 4, MATERIALS = 12, ITEMS = 2000;
+        const float MAX_DEPTH = 100.0f;
+        // 排序只用 shader 指针作身份, 不解引用, 因此不创建 GL 对象
+        std::vector<char> shaderTags(SHADERS);
+        std::vector<RenderMaterial> materials(MATERIALS);
+        for (size_t m = 0; m < MATERIALS; m++)
+        {
+            materials[m].shader = std::shared_ptr<ShaderWrapper>(std::shared_ptr<void>(), reinterpret_cast<ShaderWrapper *>(&shaderTags[m % SHADERS]));
+            materials[m].blendMode = m % 3 == 0 ? BLEND_ALPHA : BLEND_OPIQUE;
+        }
+        std::vector<Mesh> meshes(16, Mesh{});
+        std::vector<float> depths;
+        RenderQueue queue;
+        std::uniform_real_distribution<float> depthDist(0.0f, MAX_DEPTH);
+        for (size_t i = 0; i < ITEMS; i++)
+        {
+            RenderItem item;
+            item.material = &materials[rng() % MATERIALS];
+            item.mesh = &meshes[rng() % meshes.size()];
+            item.meshIndex = (int)i; // 记录入队顺序
+            depths.push_back(depthDist(rng));
+            queue.Push(item, 0, 0, depths.back(), MAX_DEPTH);
+        }
+        queue.Sort();
+        expect(queue.Size() == ITEMS, "queue size");
+
+        // 不透明在前且按 shader -> 材质 连续成组, 组内由近到远; 半透明在后且由远到近
+        bool seenTransparent = false;
+        std::vector<const void *> closedShaders, closedMaterials;
+        auto isClosed = [](const std::vector<const void *> &closed, const void *p)
+        { return std::find(closed.begin(), closed.end(), p) != closed.end(); };
+        for (size_t i = 0; i < queue.Size(); i++)
+        {
+            const RenderItem &item = queue.At(i);
+            const bool transparent = item.material->blendMode != BLEND_OPIQUE;
+            const float depth = depths[item.meshIndex];
+            expect(Decode(queue.KeyAt(i)).transparent == transparent, "transparent bit at " + std::to_string(i));
+            expect(!(seenTransparent && !transparent), "opaque item after transparent at " + std::to_string(i));
+            seenTransparent = seenTransparent || transparent;
+            if (i == 0)
+                continue;
+
+            const RenderItem &prev = queue.At(i - 1);
+            const bool prevTransparent = prev.material->blendMode != BLEND_OPIQUE;
+            const float prevDepth = depths[prev.meshIndex];
+            const float quantum = MAX_DEPTH / (float)((1u << DEPTH_BITS) - 1);
+            if (transparent && prevTransparent)
+                expect(prevDepth + quantum >= depth, "transparent not back-to-front at " + std::to_string(i));
+            if (transparent || prevTransparent)
+                continue;
+
+            const void *shader = item.material->shader.get();
+            const void *prevShader = prev.material->shader.get();
+            if (shader != prevShader)
+            {
+                expect(!isClosed(closedShaders, shader), "opaque shader group split at " + std::to_string(i));
+                closedShaders.push_back(prevShader);
+            }
+            if (item.material != prev.material)
+            {
+                expect(!isClosed(closedMaterials, item.material), "opaque material group split at " + std::to_string(i));
+                closedMaterials.push_back(prev.material);
+            }
+            else if (item.mesh == prev.mesh)
+            {
+                expect(depth + quantum >= prevDepth, "opaque not front-to-back at " + std::to_string(i));
+                // 键完全相同时保持入队顺序
+                if (queue.KeyAt(i) == queue.KeyAt(i - 1))
+                    expect(item.meshIndex > prev.meshIndex, "equal keys not stable at " + std::to_string(i));
+            }
+        }
+
+        std::cout << "  " << (failures == 0 ? "OK" : "FAILED") << std::endl;
+        return failures == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    __SHOWINFO__ = false;
+    if (argc > 1 && std::string(argv[1]) == "check")
+        return RunRenderQueueCheck();
+    const std::string outputPath = argc > 1 ? argv[1] : "micro_bench.json";
+    const int samples = argc > 2 ? std::max(5, std::atoi(argv[2])) : 50;
+    const std::string filter = argc > 3 ? argv[3] : "*";
+    const std::string baselinePath = argc > 4 ? argv[4] : "";
+    const std::string label = argc > 5 ? argv[5] : "";
+
+    std::cout << "[MicroBench]: samples=" << samples << " filter=" << filter << std::endl;
+    std::vector<MicroResult> results;
+    json resultsJson = json::array();
+    for (const auto &c : BuildCases())
+    {
+        if (filter != "*" && c.name.find(filter) == std::string::npos)
+            continue;
+        const MicroResult r = Measure(c, samples);
+        std::cout << "  " << r.name << ": p50 " << r.p50Ns << " ns, p95 " << r.p95Ns << " ns, min " << r.minNs << " ns" << std::endl;
+        resultsJson.push_back({{"name", r.name},
+                               {"iterations", r.iterations},
+                               {"minNs", r.minNs},
+                               {"meanNs", r.meanNs},
+                               {"p50Ns", r.p50Ns},
+                               {"p95Ns", r.p95Ns},
+                               {"p99Ns", r.p99Ns},
+                               {"maxNs", r.maxNs}});
+        results.push_back(r);
+    }
+
+    json report = {{"revision", NW_GIT_REVISION},
+                   {"label", label},
+                   {"time", Timestamp()},
+                   {"machine", MachineInfo()},
+                   {"samples", samples},
+                   {"results", resultsJson}};
+    std::ofstream file(outputPath);
+    if (!file.is_open())
+    {
+        std::cerr << "[MicroBench]: Failed to open " << outputPath << std::endl;
+        return 1;
+    }
+    file << report.dump(2) << std::endl;
+    std::cout << "[MicroBench]: results written to " << outputPath << std::endl;
+
+    if (!baselinePath.empty() && CompareWithBaseline(baselinePath, results) > 0)
+        return 2;
+    return 0;
+}
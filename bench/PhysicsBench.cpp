@@ -0,0 +1,708 @@
+// 物理基准
+// 用法: NW_PhysicsBench [物体数=10000] [步数=200]      逐物体积分 vs 打包 SIMD 批量积分
+//       NW_PhysicsBench ccd [子弹数=2000]               离散检测 120Hz/60Hz 与 60Hz+CCD 的命中率和耗时
+//       NW_PhysicsBench ray [射线数=10000] [碰撞体=5000]  逐物体射线检测 vs BVH 单条 vs BVH 打包批量
+//       NW_PhysicsBench sat [盒子对数=200000]             OBB-OBB 逐轴 SAT vs SIMD SAT 的一致性与耗时
+//       NW_PhysicsBench math [物体数=10000] [轮数=200]      逐物体 Integrate 与 GetWorldAABB 的单体耗时 (ns)
+//       NW_PhysicsBench simd [数量=100000]                  Matrix4f / Quat4f SIMD 内核与标量参考的一致性与耗时
+//       NW_PhysicsBench transform [数量=100000]             逐个变换点/方向/包围盒 vs BatchTransform 批量变换
+//       NW_PhysicsBench suite [输出=physics_bench.json] [步数=300] [规模=1] [标签]
+//                                                        无窗口压力场景套件, 结果写为 JSON
+#include "Engine/Config/Config.h"
+#include "Engine/Core/GameObject/GameObject.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/System/Physics/PhysicsSystem.h"
+#include "Engine/System/Physics/Integrator/BatchIntegrator.h"
+#include "Engine/System/Physics/CCD/ContinuousCollision.h"
+#include "Engine/System/Physics/Narrowphase/BoxBoxSAT.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include "Engine/Math/Batch/BatchTransform.h"
+#include "Engine/System/Ray/mRay.h"
+#include "Engine/System/Ray/RaycastScene.h"
+#include "PhysicsSuite.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<std::unique_ptr<GameObject>> MakeBodies(int count)
+    {
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        std::vector<std::unique_ptr<GameObject>> objects;
+        objects.reserve(count);
+        for (int i = 0; i < count; i++)
+        {
+            auto object = std::make_unique<GameObject>(i, "body");
+            Quat4f rot(1.0f, unit(rng), unit(rng), unit(rng));
+            rot.normalize();
+            object->AddComponent<TransformComponent>(Vector3f(pos(rng), pos(rng), pos(rng)), rot, Vector3f(1.0f, 1.0f, 1.0f));
+            auto &rb = object->AddComponent<RigidbodyComponent>(1.0f + 0.5f * (unit(rng) + 1.0f), 0.05f,
+                                                                 Vector3f(unit(rng), unit(rng), unit(rng)) * 10.0f);
+            rb.angularDrag = 0.05f;
+            rb.SetBoxInertia(Vector3f(1.0f + unit(rng) * 0.5f, 1.0f, 2.0f));
+            rb.angularMomentum = Vector3f(unit(rng), unit(rng), unit(rng));
+            objects.push_back(std::move(object));
+        }
+        return objects;
+    }
+
+    void ApplyForces(std::vector<std::unique_ptr<GameObject>> &objects)
+    {
+        for (auto &object : objects)
+        {
+            auto &rb = object->GetComponent<RigidbodyComponent>();
+            rb.AddForce(Vector3f(0.0f, -9.8f * rb.mass, 0.0f));
+            rb.AddTorque(Vector3f(0.1f, 0.0f, -0.1f));
+        }
+    }
+
+    double RunScalar(std::vector<std::unique_ptr<GameObject>> &objects, int steps, float dt)
+    {
+        double total = 0.0;
+        for (int s = 0; s < steps; s++)
+        {
+            ApplyForces(objects);
+            auto start = Clock::now();
+            for (auto &object : objects)
+            {
+                auto &rb = object->GetComponent<RigidbodyComponent>();
+                auto &tf = object->GetComponent<TransformComponent>();
+                PhysicsSystem::IntegrateBodyVelocity(rb, tf, dt);
+                PhysicsSystem::IntegrateBodyPosition(rb, tf, dt);
+            }
+            total += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+        return total / steps;
+    }
+
+    double RunBatch(std::vector<std::unique_ptr<GameObject>> &objects, int steps, float dt)
+    {
+        BodyBatch batch;
+        double total = 0.0;
+        for (int s = 0; s < steps; s++)
+        {
+            ApplyForces(objects);
+            // 计时包含打包和写回, 与 PhysicsSystem 中的批量路径一致
+            auto start = Clock::now();
+            batch.Clear();
+            for (auto &object : objects)
+                batch.Add(&object->GetComponent<RigidbodyComponent>(), &object->GetComponent<TransformComponent>());
+            batch.Finalize();
+            BatchIntegrator::IntegrateVelocities(batch, dt);
+            BatchIntegrator::IntegratePositions(batch, dt);
+            batch.ScatterVelocities();
+            batch.ScatterTransforms();
+            total += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+        return total / steps;
+    }
+
+    // 每条通道一颗子弹射向一面薄墙, 通道之间相距足够远互不干扰
+    struct Lane
+    {
+        std::unique_ptr<GameObject> bullet;
+        std::unique_ptr<GameObject> wall;
+        bool hit = false;
+    };
+
+    std::vector<Lane> MakeLanes(int count)
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<float> speed(150.0f, 450.0f);
+        std::uniform_real_distribution<float> thickness(0.1f, 0.5f);
+        std::uniform_real_distribution<float> offset(0.0f, 10.0f);
+
+        std::vector<Lane> lanes(count);
+        for (int i = 0; i < count; i++)
+        {
+            float z = 50.0f * i;
+            auto &lane = lanes[i];
+            lane.bullet = std::make_unique<GameObject>(2 * i, "bullet");
+            // 没有 GameWorld 刷新世界矩阵, 直接写入
+            lane.bullet->AddComponent<TransformComponent>().SetWorldMatrix(
+                Matrix4f::CreateTransform(Vector3f(-offset(rng), 0.0f, z), Quat4f::IDENTITY, Vector3f(1.0f, 1.0f, 1.0f)));
+            auto &rb = lane.bullet->AddComponent<RigidbodyComponent>(1.0f, 0.0f, Vector3f(speed(rng), 0.0f, 0.0f));
+            rb.elasticity = 0.5f;
+            rb.angularDrag = 0.0f;
+            rb.setHitboxBox(Vector3f(3.0f, 0.8f, 0.8f)); // 与子弹预制体相同的细长盒
+            rb.SetBoxInertia(Vector3f(3.0f, 0.8f, 0.8f));
+            rb.ccd = true;
+
+            lane.wall = std::make_unique<GameObject>(2 * i + 1, "wall");
+            lane.wall->AddComponent<TransformComponent>().SetWorldMatrix(
+                Matrix4f::CreateTransform(Vector3f(60.0f, 0.0f, z), Quat4f::IDENTITY, Vector3f(1.0f, 1.0f, 1.0f)));
+            auto &wall = lane.wall->AddComponent<RigidbodyComponent>(0.0f);
+            wall.elasticity = 0.5f;
+            wall.setHitboxBox(Vector3f(thickness(rng), 20.0f, 20.0f));
+
+            Lane *lanePtr = &lane;
+            rb.collisionCallback = [lanePtr](GameObject *)
+            { lanePtr->hit = true; };
+        }
+        return lanes;
+    }
+
+    struct CCDResult
+    {
+        double msPerSecond;
+        float hitRate;
+        size_t ccdHits;
+    };
+
+    // 模拟 0.5 秒; 离散检测直接用 HitBox 窄检测, 命中即记录
+    CCDResult RunLanes(int count, float dt, bool useCCD)
+    {
+        auto lanes = MakeLanes(count);
+        std::vector<GameObject *> objects;
+        for (auto &lane : lanes)
+        {
+            objects.push_back(lane.bullet.get());
+            objects.push_back(lane.wall.get());
+        }
+        ContinuousCollision ccd;
+        ccd.SetEnabled(useCCD);
+
+        const int steps = (int)std::ceil(0.5f / dt);
+        size_t ccdHits = 0;
+        auto start = Clock::now();
+        for (int s = 0; s < steps; s++)
+        {
+            for (auto &lane : lanes)
+            {
+                auto &rb = lane.bullet->GetComponent<RigidbodyComponent>();
+                auto &tf = lane.bullet->GetComponent<TransformComponent>();
+                Vector3f normal, hitPoint;
+                float penetration;
+                HitBox a(tf, rb);
+                HitBox b(lane.wall->GetComponent<TransformComponent>(), lane.wall->GetComponent<RigidbodyComponent>());
+                if (HitBox::GetCollisionInfo(a, b, normal, penetration, hitPoint))
+                    lane.hit = true;
+                PhysicsSystem::IntegrateBodyVelocity(rb, tf, dt);
+            }
+            ccd.Solve(objects, dt, nullptr, nullptr, nullptr);
+            ccdHits += ccd.GetStats().hits;
+            for (auto &lane : lanes)
+                PhysicsSystem::IntegrateBodyPosition(lane.bullet->GetComponent<RigidbodyComponent>(),
+                                                     lane.bullet->GetComponent<TransformComponent>(), dt);
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        int hits = 0;
+        for (auto &lane : lanes)
+            hits += lane.hit ? 1 : 0;
+        return {ms / (steps * dt), (float)hits / count, ccdHits};
+    }
+
+    int RunCCDBench(int count)
+    {
+        struct Config
+        {
+            const char *name;
+            float dt;
+            bool ccd;
+        };
+        const Config configs[] = {
+            {"discrete 120Hz", 1.0f / 120.0f, false},
+            {"discrete  60Hz", 1.0f / 60.0f, false},
+            {"ccd       60Hz", 1.0f / 60.0f, true},
+        };
+        std::cout << "[PhysicsBench]: ccd, bullets=" << count << " (150~450 m/s, walls 0.1~0.5 m)" << std::endl;
+        for (const auto &config : configs)
+        {
+            CCDResult result = RunLanes(count, config.dt, config.ccd);
+            std::cout << "  " << config.name << ": hit rate " << result.hitRate * 100.0f << "%, "
+                      << result.msPerSecond << " ms per simulated second";
+            if (config.ccd)
+                std::cout << ", swept hits " << result.ccdHits;
+            std::cout << std::endl;
+        }
+        return 0;
+    }
+
+    int RunRayBench(int rayCount, int colliderCount)
+    {
+        std::mt19937 rng(4242);
+        std::uniform_real_distribution<float> pos(-200.0f, 200.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> size(1.0f, 8.0f);
+
+        std::vector<std::unique_ptr<GameObject>> objects;
+        std::vector<GameObject *> entities;
+        for (int i = 0; i < colliderCount; i++)
+        {
+            auto object = std::make_unique<GameObject>(i, "collider");
+            Quat4f rot(1.0f, unit(rng), unit(rng), unit(rng));
+            rot.normalize();
+            object->AddComponent<TransformComponent>().SetWorldMatrix(
+                Matrix4f::CreateTransform(Vector3f(pos(rng), pos(rng), pos(rng)), rot, Vector3f(1.0f, 1.0f, 1.0f)));
+            auto &rb = object->AddComponent<RigidbodyComponent>();
+            if (i % 3 == 0)
+                rb.setHitboxSphere(size(rng) * 0.5f);
+            else
+                rb.setHitboxBox(Vector3f(size(rng), size(rng), size(rng)));
+            entities.push_back(object.get());
+            objects.push_back(std::move(object));
+        }
+
+        std::vector<mRay> rays;
+        rays.reserve(rayCount);
+        for (int i = 0; i < rayCount; i++)
+            rays.emplace_back(Vector3f(pos(rng), pos(rng), pos(rng)), Vector3f(unit(rng), unit(rng), unit(rng)));
+        const float maxDistance = 1000.0f;
+
+        std::vector<mRaycastHit> linearHits(rayCount), bvhHits(rayCount), batchHits(rayCount);
+        auto start = Clock::now();
+        for (int i = 0; i < rayCount; i++)
+            linearHits[i] = rays[i].Raycast(maxDistance, entities);
+        double linearMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        RaycastScene scene;
+        start = Clock::now();
+        scene.Build(entities);
+        double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (int i = 0; i < rayCount; i++)
+            bvhHits[i] = scene.Raycast(rays[i], maxDistance, nullptr, 0xFFFFFFFFu);
+        double bvhMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        scene.RaycastBatch(rays.data(), batchHits.data(), rays.size(), maxDistance, nullptr, 0xFFFFFFFFu);
+        double batchMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        // 三条路径的命中物体应一致, 距离在浮点误差内
+        int hits = 0, mismatches = 0;
+        float maxDistError = 0.0f;
+        for (int i = 0; i < rayCount; i++)
+        {
+            hits += linearHits[i].hit ? 1 : 0;
+            for (const mRaycastHit *other : {&bvhHits[i], &batchHits[i]})
+            {
+                if (other->hit != linearHits[i].hit || other->entity != linearHits[i].entity)
+                    mismatches++;
+                else if (other->hit)
+                    maxDistError = std::max(maxDistError, std::abs(other->distance - linearHits[i].distance));
+            }
+        }
+
+        std::cout << "[PhysicsBench]: ray, rays=" << rayCount << " colliders=" << colliderCount << " hits=" << hits << std::endl;
+        std::cout << "  linear   : " << linearMs << " ms" << std::endl;
+        std::cout << "  bvh build: " << buildMs << " ms (" << scene.GetNodeCount() << " nodes)" << std::endl;
+        std::cout << "  bvh      : " << bvhMs << " ms (x" << (bvhMs > 0.0 ? linearMs / bvhMs : 0.0) << ")" << std::endl;
+        std::cout << "  batch    : " << batchMs << " ms (x" << (batchMs > 0.0 ? linearMs / batchMs : 0.0) << ")" << std::endl;
+        std::cout << "  mismatches: " << mismatches << ", max distance error: " << maxDistError << std::endl;
+        return mismatches == 0 ? 0 : 1;
+    }
+
+    int RunSATBench(int count)
+    {
+        // 中心距离与尺寸同量级, 约一半相交; 每 4 对中有 1 对姿态相同, 覆盖边叉积退化的情况
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<float> pos(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> size(0.2f, 3.0f);
+        auto randomRotation = [&]()
+        {
+            Quat4f rot(1.0f, unit(rng), unit(rng), unit(rng));
+            rot.normalize();
+            return rot;
+        };
+        RigidbodyComponent shape;
+        std::vector<HitBox> boxesA(count), boxesB(count);
+        for (int i = 0; i < count; i++)
+        {
+            Quat4f rotA = randomRotation();
+            Quat4f rotB = i % 4 == 0 ? rotA : randomRotation();
+            boxesA[i].setHitboxBox(Vector3f(pos(rng), pos(rng), pos(rng)), rotA,
+                                   AABB(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(size(rng), size(rng), size(rng))));
+            boxesB[i].setHitboxBox(Vector3f(pos(rng), pos(rng), pos(rng)), rotB,
+                                   AABB(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(size(rng), size(rng), size(rng))));
+        }
+
+        std::vector<BoxContact> scalar(count), simd(count), batch(count);
+        auto start = Clock::now();
+        for (int i = 0; i < count; i++)
+            scalar[i].hit = HitBox::GetCollisionInfoBOXBOX(boxesA[i], boxesB[i], scalar[i].normal, scalar[i].penetration, scalar[i].hitPoint);
+        double scalarMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (int i = 0; i < count; i++)
+            simd[i].hit = BoxBoxSAT::Collide(boxesA[i], boxesB[i], simd[i].normal, simd[i].penetration, simd[i].hitPoint);
+        double simdMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        size_t batchHits = BoxBoxSAT::CollideBatch(boxesA.data(), boxesB.data(), count, batch.data());
+        double batchMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        // 运算顺序一致, 结果应逐位相同; 容差只为编译器改写浮点表达式 (如 FMA) 留余地
+        int hits = 0, mismatches = 0;
+        float maxError = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            hits += scalar[i].hit ? 1 : 0;
+            for (const BoxContact *other : {&simd[i], &batch[i]})
+            {
+                if (other->hit != scalar[i].hit)
+                {
+                    mismatches++;
+                    continue;
+                }
+                if (!other->hit)
+                    continue;
+                float error = std::max({(other->normal - scalar[i].normal).Length(),
+                                        std::abs(other->penetration - scalar[i].penetration),
+                                        (other->hitPoint - scalar[i].hitPoint).Length()});
+                maxError = std::max(maxError, error);
+                if (error > 1e-3f)
+                    mismatches++;
+            }
+        }
+
+        std::cout << "[PhysicsBench]: sat, pairs=" << count << " hits=" << hits << " (batch " << batchHits << ")" << std::endl;
+        std::cout << "  scalar: " << scalarMs << " ms" << std::endl;
+        std::cout << "  simd  : " << simdMs << " ms (x" << (simdMs > 0.0 ? scalarMs / simdMs : 0.0) << ")" << std::endl;
+        std::cout << "  batch : " << batchMs << " ms (x" << (batchMs > 0.0 ? scalarMs / batchMs : 0.0) << ")" << std::endl;
+        std::cout << "  mismatches: " << mismatches << ", max error: " << maxError << std::endl;
+        return mismatches == 0 ? 0 : 1;
+    }
+
+    // 数学库热路径: 逐物体积分 (向量/四元数运算) 与世界 AABB (每个角点绕轴旋转)
+    // 结果按单个物体的耗时给出, 便于对比数学库不同实现方式下的构建
+    int RunMathBench(int count, int rounds)
+    {
+        auto objects = MakeBodies(count);
+        for (auto &object : objects)
+            object->GetComponent<RigidbodyComponent>().setHitboxBox(Vector3f(1.0f, 0.5f, 2.0f));
+        const float dt = 1.0f / 60.0f;
+
+        double integrateMs = 0.0, aabbMs = 0.0;
+        float checksum = 0.0f;
+        for (int r = 0; r < rounds; r++)
+        {
+            ApplyForces(objects);
+            auto start = Clock::now();
+            for (auto &object : objects)
+            {
+                auto &rb = object->GetComponent<RigidbodyComponent>();
+                auto &tf = object->GetComponent<TransformComponent>();
+                PhysicsSystem::IntegrateBodyVelocity(rb, tf, dt);
+                PhysicsSystem::IntegrateBodyPosition(rb, tf, dt);
+            }
+            auto mid = Clock::now();
+            for (auto &object : objects)
+            {
+                AABB box = object->GetWorldAABB();
+                checksum += box.max.x() - box.min.x();
+            }
+            auto end = Clock::now();
+            integrateMs += std::chrono::duration<double, std::milli>(mid - start).count();
+            aabbMs += std::chrono::duration<double, std::milli>(end - mid).count();
+        }
+
+        const double perBody = 1e6 / ((double)count * rounds);
+        std::cout << "[PhysicsBench]: math, bodies=" << count << " rounds=" << rounds << std::endl;
+        std::cout << "  integrate   : " << integrateMs * perBody << " ns/body" << std::endl;
+        std::cout << "  worldAABB   : " << aabbMs * perBody << " ns/body" << std::endl;
+        std::cout << "  checksum    : " << checksum / rounds << std::endl;
+        return 0;
+    }
+
+    // 相对误差, 分母不小于 1 以免接近 0 的分量放大误差
+    float RelativeError(const float *a, const float *b, int n)
+    {
+        float error = 0.0f;
+        for (int i = 0; i < n; i++)
+            error = std::max(error, std::fabs(a[i] - b[i]) / std::max(1.0f, std::fabs(b[i])));
+        return error;
+    }
+
+    template <typename F>
+    double TimeMs(int rounds, F &&body)
+    {
+        auto start = Clock::now();
+        for (int r = 0; r < rounds; r++)
+            body();
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / rounds;
+    }
+
+    // 类接口 (MathSIMD) 与 MathScalar 参考实现逐项比较; 乘法应逐位一致, 求逆在 1e-4 相对误差内
+    int RunSIMDMathBench(int count)
+    {
+        std::mt19937 rng(4242);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> scaleDist(0.2f, 5.0f);
+
+        std::vector<Matrix4f> matrices(count), others(count), outSimd(count), outScalar(count);
+        std::vector<Vector4f> vectors(count), vecSimd(count), vecScalar(count);
+        std::vector<Quat4f> quats(count), quatsB(count), quatSimd(count), quatScalar(count);
+        std::vector<Vector3f> positions(count), scales(count);
+        for (int i = 0; i < count; i++)
+        {
+            quats[i] = Quat4f(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+            quatsB[i] = Quat4f(unit(rng), unit(rng), unit(rng), unit(rng)).normalized();
+            positions[i] = Vector3f(unit(rng), unit(rng), unit(rng)) * 100.0f;
+            scales[i] = Vector3f(scaleDist(rng), scaleDist(rng), scaleDist(rng));
+            // 一半为 TRS 变换, 一半为对角占优的一般矩阵
+            if (i % 2 == 0)
+                matrices[i] = Matrix4f::CreateTransform(positions[i], quats[i], scales[i]);
+            else
+            {
+                for (int e = 0; e < 16; e++)
+                    matrices[i].data()[e] = unit(rng) + (e % 5 == 0 ? 4.0f : 0.0f);
+            }
+            for (int e = 0; e < 16; e++)
+                others[i].data()[e] = unit(rng) * 10.0f;
+            vectors[i] = Vector4f(unit(rng), unit(rng), unit(rng), 1.0f) * 50.0f;
+        }
+
+        const int rounds = 20;
+        float mulError = 0.0f, vecError = 0.0f, quatError = 0.0f, invError = 0.0f, trsError = 0.0f;
+
+        double mulScalar = TimeMs(rounds, [&]
+                                  { for (int i = 0; i < count; i++) MathScalar::MulMat4(matrices[i].data(), others[i].data(), outScalar[i].data()); });
+        double mulSimd = TimeMs(rounds, [&]
+                                { for (int i = 0; i < count; i++) outSimd[i] = matrices[i] * others[i]; });
+        for (int i = 0; i < count; i++)
+            mulError = std::max(mulError, RelativeError(outSimd[i].data(), outScalar[i].data(), 16));
+
+        double vecScalarMs = TimeMs(rounds, [&]
+                                    { for (int i = 0; i < count; i++) MathScalar::MulMat4Vec4(matrices[i].data(), vectors[i].data(), vecScalar[i].data()); });
+        double vecSimdMs = TimeMs(rounds, [&]
+                                  { for (int i = 0; i < count; i++) vecSimd[i] = matrices[i] * vectors[i]; });
+        for (int i = 0; i < count; i++)
+            vecError = std::max(vecError, RelativeError(vecSimd[i].data(), vecScalar[i].data(), 4));
+
+        double quatScalarMs = TimeMs(rounds, [&]
+                                     { for (int i = 0; i < count; i++) MathScalar::MulQuat(quats[i].data(), quatsB[i].data(), quatScalar[i].data()); });
+        double quatSimdMs = TimeMs(rounds, [&]
+                                   { for (int i = 0; i < count; i++) quatSimd[i] = quats[i] * quatsB[i]; });
+        for (int i = 0; i < count; i++)
+            quatError = std::max(quatError, RelativeError(quatSimd[i].data(), quatScalar[i].data(), 4));
+
+        double invScalar = TimeMs(rounds, [&]
+                                  { for (int i = 0; i < count; i++) MathScalar::InverseMat4(matrices[i].data(), outScalar[i].data()); });
+        double invSimd = TimeMs(rounds, [&]
+                                { for (int i = 0; i < count; i++) outSimd[i] = matrices[i].inverse(); });
+        for (int i = 0; i < count; i++)
+            invError = std::max(invError, RelativeError(outSimd[i].data(), outScalar[i].data(), 16));
+
+        // 旧实现: 三个矩阵依次相乘
+        double trsScalar = TimeMs(rounds, [&]
+                                  {
+            for (int i = 0; i < count; i++)
+            {
+                Matrix4f tr;
+                MathScalar::MulMat4(Matrix4f::translation(positions[i]).data(), Matrix4f::rotation(quats[i]).data(), tr.data());
+                MathScalar::MulMat4(tr.data(), Matrix4f::scale(scales[i]).data(), outScalar[i].data());
+            } });
+        double trsSimd = TimeMs(rounds, [&]
+                                { for (int i = 0; i < count; i++) outSimd[i] = Matrix4f::CreateTransform(positions[i], quats[i], scales[i]); });
+        for (int i = 0; i < count; i++)
+            trsError = std::max(trsError, RelativeError(outSimd[i].data(), outScalar[i].data(), 16));
+
+        auto report = [](const char *name, double scalarMs, double simdMs, float error)
+        {
+            std::cout << "  " << name << scalarMs << " ms -> " << simdMs << " ms (x" << (simdMs > 0.0 ? scalarMs / simdMs : 0.0)
+                      << "), max rel error " << error << std::endl;
+        };
+#ifdef NW_MATH_SSE
+        std::cout << "[PhysicsBench]: simd (SSE), count=" << count << std::endl;
+#else
+        std::cout << "[PhysicsBench]: simd (scalar fallback), count=" << count << std::endl;
+#endif
+        report("mat4 * mat4   : ", mulScalar, mulSimd, mulError);
+        report("mat4 * vec4   : ", vecScalarMs, vecSimdMs, vecError);
+        report("quat * quat   : ", quatScalarMs, quatSimdMs, quatError);
+        report("mat4 inverse  : ", invScalar, invSimd, invError);
+        report("CreateTransform: ", trsScalar, trsSimd, trsError);
+
+        const bool ok = mulError == 0.0f && vecError == 0.0f && quatError == 0.0f && trsError == 0.0f && invError < 1e-4f;
+        std::cout << "  " << (ok ? "OK" : "MISMATCH") << std::endl;
+        return ok ? 0 : 1;
+    }
+
+    int RunTransformBench(int count)
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        const Quat4f rotation = Quat4f(0.3f, -0.5f, 0.7f, 0.2f).normalized();
+        const Vector3f position(12.0f, -3.0f, 40.0f);
+        const Vector3f scale(1.5f, 0.5f, 2.0f);
+        const Matrix4f transform = Matrix4f::CreateTransform(position, rotation, scale);
+        const Matrix4f rotationMat = Matrix4f::rotation(rotation);
+
+        // 与粒子缓冲相同的交错布局
+        struct Particle
+        {
+            Vector3f position;
+            float pad0;
+            Vector3f velocity;
+            float pad1;
+        };
+        std::vector<Particle> source(count), batch(count), single(count);
+        std::vector<Vector3f> mins(count), maxs(count), aabbMin(count), aabbMax(count), cornerMin(count), cornerMax(count);
+        std::vector<float> xs(count), ys(count), zs(count);
+        for (int i = 0; i < count; i++)
+        {
+            source[i].position = Vector3f(unit(rng), unit(rng), unit(rng)) * 10.0f;
+            source[i].velocity = Vector3f(unit(rng), unit(rng), unit(rng)) * 5.0f;
+            const Vector3f c = Vector3f(unit(rng), unit(rng), unit(rng)) * 100.0f;
+            const Vector3f e(std::fabs(unit(rng)) + 0.1f, std::fabs(unit(rng)) + 0.1f, std::fabs(unit(rng)) + 0.1f);
+            mins[i] = c - e;
+            maxs[i] = c + e;
+        }
+
+        const int rounds = 20;
+        const size_t stride = sizeof(Particle);
+
+        // 旧实现: 逐粒子用四元数旋转
+        double pointsSingle = TimeMs(rounds, [&]
+                                     {
+            single = source;
+            for (auto &particle : single)
+            {
+                particle.position = (rotation * (particle.position & scale)) + position;
+                particle.velocity = rotation * particle.velocity;
+            } });
+        double pointsBatch = TimeMs(rounds, [&]
+                                    {
+            batch = source;
+            BatchTransform::TransformPoints(transform, &batch[0].position, &batch[0].position, count, stride, stride);
+            BatchTransform::TransformDirections(rotationMat, &batch[0].velocity, &batch[0].velocity, count, stride, stride); });
+        float pointError = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            pointError = std::max(pointError, RelativeError(&batch[i].position[0], &single[i].position[0], 3));
+            pointError = std::max(pointError, RelativeError(&batch[i].velocity[0], &single[i].velocity[0], 3));
+        }
+
+        // SoA 路径与 AoS 结果对照
+        double pointsSoA = TimeMs(rounds, [&]
+                                  {
+            for (int i = 0; i < count; i++)
+            {
+                xs[i] = source[i].position.x();
+                ys[i] = source[i].position.y();
+                zs[i] = source[i].position.z();
+            }
+            BatchTransform::TransformPointsSoA(transform, xs.data(), ys.data(), zs.data(), count); });
+        float soaError = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            const Vector3f p(xs[i], ys[i], zs[i]);
+            soaError = std::max(soaError, RelativeError(&p[0], &batch[i].position[0], 3));
+        }
+
+        // 旧实现: 变换 8 个角点后取 min/max
+        double aabbCorners = TimeMs(rounds, [&]
+                                    {
+            for (int i = 0; i < count; i++)
+            {
+                Vector3f lo(FLT_MAX, FLT_MAX, FLT_MAX), hi(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+                for (int k = 0; k < 8; k++)
+                {
+                    const Vector4f corner((k & 4) ? maxs[i].x() : mins[i].x(), (k & 2) ? maxs[i].y() : mins[i].y(), (k & 1) ? maxs[i].z() : mins[i].z(), 1.0f);
+                    const Vector3f world = (transform * corner).xyz();
+                    lo = Vector3f::Min(lo, world);
+                    hi = Vector3f::Max(hi, world);
+                }
+                cornerMin[i] = lo;
+                cornerMax[i] = hi;
+            } });
+        double aabbBatch = TimeMs(rounds, [&]
+                                  { BatchTransform::TransformAABBs(transform, mins.data(), maxs.data(), aabbMin.data(), aabbMax.data(), count); });
+        float aabbError = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            aabbError = std::max(aabbError, RelativeError(&aabbMin[i][0], &cornerMin[i][0], 3));
+            aabbError = std::max(aabbError, RelativeError(&aabbMax[i][0], &cornerMax[i][0], 3));
+        }
+
+        auto report = [](const char *name, double singleMs, double batchMs, float error)
+        {
+            std::cout << "  " << name << singleMs << " ms -> " << batchMs << " ms (x" << (batchMs > 0.0 ? singleMs / batchMs : 0.0)
+                      << "), max rel error " << error << std::endl;
+        };
+        std::cout << "[PhysicsBench]: transform, count=" << count << std::endl;
+        report("points+dirs (strided): ", pointsSingle, pointsBatch, pointError);
+        report("points SoA (incl. copy): ", pointsSingle, pointsSoA, soaError);
+        report("AABB 8 corners -> Arvo : ", aabbCorners, aabbBatch, aabbError);
+
+        const bool ok = pointError < 1e-4f && soaError < 1e-5f && aabbError < 1e-4f;
+        std::cout << "  " << (ok ? "OK" : "MISMATCH") << std::endl;
+        return ok ? 0 : 1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    __SHOWINFO__ = false;
+    if (argc > 1 && std::string(argv[1]) == "ccd")
+        return RunCCDBench(argc > 2 ? std::max(1, std::atoi(argv[2])) : 2000);
+    if (argc > 1 && std::string(argv[1]) == "ray")
+        return RunRayBench(argc > 2 ? std::max(1, std::atoi(argv[2])) : 10000, argc > 3 ? std::max(1, std::atoi(argv[3])) : 5000);
+    if (argc > 1 && std::string(argv[1]) == "sat")
+        return RunSATBench(argc > 2 ? std::max(1, std::atoi(argv[2])) : 200000);
+    if (argc > 1 && std::string(argv[1]) == "simd")
+        return RunSIMDMathBench(argc > 2 ? std::max(1, std::atoi(argv[2])) : 100000);
+    if (argc > 1 && std::string(argv[1]) == "transform")
+        return RunTransformBench(argc > 2 ? std::max(1, std::atoi(argv[2])) : 100000);
+    if (argc > 1 && std::string(argv[1]) == "math")
+        return RunMathBench(argc > 2 ? std::max(1, std::atoi(argv[2])) : 10000, argc > 3 ? std::max(1, std::atoi(argv[3])) : 200);
+    if (argc > 1 && std::string(argv[1]) == "suite")
+    {
+        PhysicsSuiteOptions options;
+        if (argc > 2)
+            options.outputPath = argv[2];
+        if (argc > 3)
+            options.steps = std::max(1, std::atoi(argv[3]));
+        if (argc > 4)
+            options.scale = std::max(0.01f, (float)std::atof(argv[4]));
+        if (argc > 5)
+            options.label = argv[5];
+        return RunPhysicsSuite(options);
+    }
+
+    const int count = argc > 1 ? std::max(1, std::atoi(argv[1])) : 10000;
+    const int steps = argc > 2 ? std::max(1, std::atoi(argv[2])) : 200;
+    const float dt = 1.0f / 60.0f;
+
+    auto scalarObjects = MakeBodies(count);
+    auto batchObjects = MakeBodies(count);
+
+    double scalarMs = RunScalar(scalarObjects, steps, dt);
+    double batchMs = RunBatch(batchObjects, steps, dt);
+
+    // 两条路径的结果应在浮点误差范围内一致
+    float maxPosError = 0.0f, maxRotError = 0.0f;
+    for (int i = 0; i < count; i++)
+    {
+        auto &a = scalarObjects[i]->GetComponent<TransformComponent>();
+        auto &b = batchObjects[i]->GetComponent<TransformComponent>();
+        maxPosError = std::max(maxPosError, (a.GetWorldPosition() - b.GetWorldPosition()).Length());
+        Quat4f qa = a.GetWorldRotation(), qb = b.GetWorldRotation();
+        // q 与 -q 表示同一旋转
+        float dot = std::abs(qa.w() * qb.w() + qa.x() * qb.x() + qa.y() * qb.y() + qa.z() * qb.z());
+        maxRotError = std::max(maxRotError, 1.0f - std::min(dot, 1.0f));
+    }
+
+    std::cout << "[PhysicsBench]: bodies=" << count << " steps=" << steps << std::endl;
+    std::cout << "  scalar: " << scalarMs << " ms/step" << std::endl;
+    std::cout << "  batch : " << batchMs << " ms/step (x" << (batchMs > 0.0 ? scalarMs / batchMs : 0.0) << ")" << std::endl;
+    std::cout << "  max position error: " << maxPosError << ", max rotation error: " << maxRotError << std::endl;
+    return 0;
+}
@@ -0,0 +1,478 @@
+#include "PhysicsSuite.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/System/Physics/Physics.h"
+#include "Game/Systems/Physics/SolarStage.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+#if !defined(PLATFORM_WEB)
+#include <omp.h>
+#endif
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+// 由 CMake 在配置时写入, 便于跨提交比较
+#ifndef NW_GIT_REVISION
+#define NW_GIT_REVISION ""
+#endif
+
+// 统计全局 new 的次数与字节数, 用于检查稳定后每步是否仍在分配
+namespace
+{
+    std::atomic<size_t> g_allocCount{0};
+    std::atomic<size_t> g_allocBytes{0};
+}
+
+void *operator new(std::size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+// 过对齐类型 (如 alignas(64) 的 RigidbodyComponent) 走这组重载, 同样计数
+void *operator new(std::size_t size, std::align_val_t align)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    const std::size_t alignment = (std::size_t)align;
+#if defined(_MSC_VER)
+    if (void *ptr = _aligned_malloc(size ? size : 1, alignment))
+        return ptr;
+#else
+    // aligned_alloc 要求大小为对齐的整数倍
+    const std::size_t rounded = ((size ? size : 1) + alignment - 1) / alignment * alignment;
+    if (void *ptr = std::aligned_alloc(alignment, rounded))
+        return ptr;
+#endif
+    throw std::bad_alloc();
+}
+#if defined(_MSC_VER)
+void operator delete(void *ptr, std::align_val_t) noexcept { _aligned_free(ptr); }
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept { _aligned_free(ptr); }
+#else
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+#endif
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    // 每步之后 (计时外) 调整场景, 可为空
+    using AfterStep = std::function<void()>;
+
+    const float FIXED_DT = 1.0f / 60.0f;
+
+    GameObject &Spawn(GameWorld &world, const char *name, const Vector3f &pos, const Quat4f &rot = Quat4f::IDENTITY)
+    {
+        GameObject &object = world.CreateGameObject();
+        object.SetName(name);
+        object.SetOwnerWorld(&world);
+        object.AddComponent<TransformComponent>(pos, rot, Vector3f(1.0f, 1.0f, 1.0f)).SetOwner(&object);
+        object.SetActive(true);
+        return object;
+    }
+
+    template <typename Stage>
+    void AddStage(GameWorld &world, const char *name, const json &config)
+    {
+        auto stage = std::make_unique<Stage>();
+        stage->Initialize(config);
+        world.GetPhysicsSystem().AddStage(std::move(stage), name);
+    }
+
+    // 盒与球 (2:1) 从网格上方逐层落向 y=0 的地面并堆叠
+    AfterStep BuildFalling(GameWorld &world, int count)
+    {
+        AddStage<GravityStage>(world, "GravityStage", {{"ground", 0.0}, {"contactSolver", true}});
+        AddStage<CollisionStage>(world, "CollisionStage", {{"broadphase", "sap"}, {"contactSolver", true}});
+
+        std::mt19937 rng(1001);
+        std::uniform_real_distribution<float> size(1.0f, 1.5f);
+        std::uniform_real_distribution<float> jitter(-0.2f, 0.2f);
+        const int side = std::max(1, (int)std::ceil(std::sqrt(count / 10.0f)));
+        const float spacing = 2.5f;
+        for (int i = 0; i < count; i++)
+        {
+            const int layer = i / (side * side), cell = i % (side * side);
+            Vector3f pos((cell % side - side * 0.5f) * spacing + jitter(rng), 2.0f + layer * spacing,
+                         (cell / side - side * 0.5f) * spacing + jitter(rng));
+            Quat4f rot(1.0f, jitter(rng), jitter(rng), jitter(rng));
+            rot.normalize();
+            auto &rb = Spawn(world, "body", pos, rot).AddComponent<RigidbodyComponent>(1.0f);
+            if (i % 3 == 2)
+            {
+                float radius = size(rng) * 0.5f;
+                rb.setHitboxSphere(radius);
+                rb.SetSphereInertia(radius);
+            }
+            else
+            {
+                Vector3f extent(size(rng), size(rng), size(rng));
+                rb.setHitboxBox(extent);
+                rb.SetBoxInertia(extent);
+            }
+        }
+        return nullptr;
+    }
+
+    // 中心天体与环绕的小天体, 初速度取圆轨道速度; 超过 directThreshold 时 SolarStage 切换 Barnes-Hut
+    AfterStep BuildOrbits(GameWorld &world, int count)
+    {
+        const float G = 1.0f, centralMass = 1.0e5f;
+        AddStage<SolarStage>(world, "SolarStage", {{"G", G}, {"method", "auto"}});
+
+        Spawn(world, "sun", Vector3f::ZERO).AddComponent<RigidbodyComponent>(centralMass);
+        std::mt19937 rng(2002);
+        std::uniform_real_distribution<float> radius(50.0f, 500.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> tilt(-0.05f, 0.05f);
+        for (int i = 1; i < count; i++)
+        {
+            float r = radius(rng), a = angle(rng);
+            Vector3f pos(std::cos(a) * r, tilt(rng) * r, std::sin(a) * r);
+            Vector3f tangent(-std::sin(a), 0.0f, std::cos(a));
+            Spawn(world, "planet", pos).AddComponent<RigidbodyComponent>(1.0f, 0.0f, tangent * std::sqrt(G * centralMass / r));
+        }
+        return nullptr;
+    }
+
+    // x 在 [100, 400] 内散布的静态靶, 子弹类场景共用
+    void SpawnTargets(GameWorld &world, std::mt19937 &rng, int count)
+    {
+        std::uniform_real_distribution<float> lateral(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> depth(100.0f, 400.0f);
+        std::uniform_real_distribution<float> size(2.0f, 6.0f);
+        for (int i = 0; i < count; i++)
+        {
+            auto &rb = Spawn(world, "target", Vector3f(depth(rng), lateral(rng), lateral(rng))).AddComponent<RigidbodyComponent>(0.0f);
+            rb.isStatic = true;
+            rb.setHitboxBox(Vector3f(size(rng), size(rng), size(rng)));
+        }
+    }
+
+    // ccd 子弹从 x<0 射向前方散布的静态靶, 飞出范围或停下后回到起点, 维持稳定的弹幕密度
+    AfterStep BuildBullets(GameWorld &world, int count)
+    {
+        AddStage<CollisionStage>(world, "CollisionStage", {{"broadphase", "sap"}, {"contactSolver", true}});
+
+        std::mt19937 rng(3003);
+        SpawnTargets(world, rng, std::max(1, count / 2));
+        std::uniform_real_distribution<float> lateral(-50.0f, 50.0f);
+
+        struct Bullet
+        {
+            GameObject *object;
+            Vector3f start;
+            Vector3f velocity;
+        };
+        auto bullets = std::make_shared<std::vector<Bullet>>();
+        std::uniform_real_distribution<float> speed(200.0f, 400.0f);
+        std::uniform_real_distribution<float> back(-50.0f, 0.0f);
+        std::uniform_real_distribution<float> spread(-0.05f, 0.05f);
+        for (int i = 0; i < count; i++)
+        {
+            Vector3f start(back(rng), lateral(rng), lateral(rng));
+            float s = speed(rng);
+            Vector3f velocity(s, s * spread(rng), s * spread(rng));
+            GameObject &object = Spawn(world, "bullet", start);
+            auto &rb = object.AddComponent<RigidbodyComponent>(1.0f, 0.0f, velocity);
+            rb.setHitboxBox(Vector3f(3.0f, 0.8f, 0.8f)); // 与子弹预制体相同的细长盒
+            rb.SetBoxInertia(Vector3f(3.0f, 0.8f, 0.8f));
+            rb.elasticity = 0.3f;
+            rb.ccd = true;
+            bullets->push_back({&object, start, velocity});
+        }
+
+        return [bullets]()
+        {
+            for (auto &bullet : *bullets)
+            {
+                auto &tf = bullet.object->GetComponent<TransformComponent>();
+                auto &rb = bullet.object->GetComponent<RigidbodyComponent>();
+                float x = tf.GetWorldPosition().x();
+                if (x > -60.0f && x < 450.0f && rb.velocity.Length() > 10.0f)
+                    continue;
+                tf.SetWorldPosition(bullet.start);
+                tf.SetLocalRotation(Quat4f::IDENTITY);
+                rb.velocity = bullet.velocity;
+                rb.angularVelocity = Vector3f::ZERO;
+                rb.angularMomentum = Vector3f::ZERO;
+                rb.WakeUp();
+            }
+        };
+    }
+
+    // 与 bullets 相同的靶与弹道, 子弹改由 ProjectileSystem 批量扫掠; 命中或到期的在步后补发
+    AfterStep BuildProjectiles(GameWorld &world, int count)
+    {
+        std::mt19937 rng(3003);
+        SpawnTargets(world, rng, std::max(1, count / 2));
+
+        auto &projectiles = world.GetProjectileSystem();
+        ProjectileType type;
+        type.name = "bullet";
+        type.lifeTime = 2.0f;
+        const int bulletType = projectiles.RegisterType(type);
+        projectiles.SetCapacity(count);
+
+        struct Shot
+        {
+            Vector3f start;
+            Vector3f velocity;
+        };
+        auto shots = std::make_shared<std::vector<Shot>>();
+        std::uniform_real_distribution<float> lateral(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> speed(200.0f, 400.0f);
+        std::uniform_real_distribution<float> back(-50.0f, 0.0f);
+        std::uniform_real_distribution<float> spread(-0.05f, 0.05f);
+        for (int i = 0; i < count; i++)
+        {
+            Vector3f start(back(rng), lateral(rng), lateral(rng));
+            float s = speed(rng);
+            shots->push_back({start, Vector3f(s, s * spread(rng), s * spread(rng))});
+            projectiles.Spawn(bulletType, shots->back().start, shots->back().velocity, nullptr);
+        }
+
+        auto next = std::make_shared<size_t>(0);
+        return [&projectiles, shots, next, bulletType]()
+        {
+            while (projectiles.GetCount() < shots->size())
+            {
+                const Shot &shot = (*shots)[(*next)++ % shots->size()];
+                projectiles.Spawn(bulletType, shot.start, shot.velocity, nullptr);
+            }
+        };
+    }
+
+    // 飞行器编队, 只有气动力与积分, 各机的油门/舵面输入固定且各不相同
+    AfterStep BuildFlight(GameWorld &world, int count)
+    {
+        AddStage<FlightDynamicsStage>(world, "FlightDynamicsStage", json::object());
+
+        std::mt19937 rng(4004);
+        std::uniform_real_distribution<float> area(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> speed(50.0f, 150.0f);
+        std::uniform_real_distribution<float> input(-1.0f, 1.0f);
+        for (int i = 0; i < count; i++)
+        {
+            float s = speed(rng);
+            GameObject &object = Spawn(world, "aircraft", Vector3f(area(rng), 200.0f + area(rng) * 0.2f, area(rng)));
+            auto &rb = object.AddComponent<RigidbodyComponent>(100.0f, 0.0f, Vector3f(0.0f, s * 0.05f, s));
+            rb.setHitboxBox(Vector3f(8.0f, 1.5f, 6.0f));
+            rb.SetBoxInertia(Vector3f(8.0f, 1.5f, 6.0f));
+            rb.angularDrag = 2.0f;
+            auto &ac = object.AddComponent<AircraftComponent>();
+            ac.owner = &object;
+            ac.maxThrust = 10000.0f;
+            ac.liftCoefficient = 0.1f;
+            ac.pitchPower = 100.0f;
+            ac.rollPower = 140.0f;
+            ac.yawPower = 10.0f;
+            ac.throttle = input(rng) > -0.5f ? 1.0f : 0.0f;
+            ac.pitch = input(rng) * 0.2f;
+            ac.roll = input(rng) * 0.2f;
+            ac.yaw = input(rng) * 0.2f;
+        }
+        return nullptr;
+    }
+
+    struct SceneSpec
+    {
+        const char *name;
+        int bodies;
+        AfterStep (*build)(GameWorld &, int);
+    };
+
+    void Accumulate(const PhysicsStepStats &stats, std::map<std::string, double> &sums)
+    {
+        for (const auto &stage : stats.stages)
+        {
+            sums[stage.name + ".ms"] += stage.totalMs;
+            for (const auto &section : stage.sections)
+                sums[stage.name + "." + section.name + ".ms"] += section.ms;
+            for (const auto &counter : stage.counters)
+                sums[stage.name + "." + counter.name] += (double)counter.value;
+        }
+    }
+
+    void AccumulateProjectiles(const ProjectileSystem &projectiles, std::map<std::string, double> &sums)
+    {
+        sums["ProjectileSystem.integrate.ms"] += projectiles.GetIntegrateMs();
+        sums["ProjectileSystem.sweep.ms"] += projectiles.GetSweepMs();
+        sums["ProjectileSystem.hits"] += (double)projectiles.GetLastHitCount();
+        sums["ProjectileSystem.live"] += (double)projectiles.GetCount();
+    }
+
+    json RunScene(const SceneSpec &spec, const PhysicsSuiteOptions &options)
+    {
+        GameWorld world([](ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &) {},
+                        nullptr, nullptr, "", "", "", "", "", true);
+        auto &physics = world.GetPhysicsSystem();
+        physics.SetProfiling(true);
+        AfterStep afterStep = spec.build(world, spec.bodies);
+        world.SyncActiveEntities();
+        world.UpdateTransforms();
+
+        std::vector<double> stepNs;
+        stepNs.reserve(options.steps);
+        std::map<std::string, double> stageSums;
+        size_t warmupAllocs = 0, allocs = 0, bytes = 0;
+        for (int s = 0; s < options.warmup + options.steps; s++)
+        {
+            // 只统计 FixedUpdate 内部的分配, 汇总与场景调整不计入
+            const size_t allocStart = g_allocCount.load(std::memory_order_relaxed);
+            const size_t bytesStart = g_allocBytes.load(std::memory_order_relaxed);
+            auto start = Clock::now();
+            world.FixedUpdate(FIXED_DT);
+            const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            const size_t stepAllocs = g_allocCount.load(std::memory_order_relaxed) - allocStart;
+            const size_t stepBytes = g_allocBytes.load(std::memory_order_relaxed) - bytesStart;
+            if (s < options.warmup)
+                warmupAllocs += stepAllocs;
+            else
+            {
+                stepNs.push_back(ns);
+                allocs += stepAllocs;
+                bytes += stepBytes;
+                Accumulate(physics.GetStats(), stageSums);
+                if (world.GetProjectileSystem().GetTypeCount() > 0)
+                    AccumulateProjectiles(world.GetProjectileSystem(), stageSums);
+            }
+            if (afterStep)
+                afterStep();
+        }
+
+        const double n = (double)stepNs.size();
+        std::vector<double> sorted = stepNs;
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&sorted](double p)
+        {
+            return sorted[std::min(sorted.size() - 1, (size_t)(p * (sorted.size() - 1) + 0.5))];
+        };
+        auto mean = [&stageSums, n](const char *key)
+        {
+            auto it = stageSums.find(key);
+            return it != stageSums.end() ? it->second / n : 0.0;
+        };
+        json stages = json::object();
+        for (const auto &[key, sum] : stageSums)
+            stages[key] = sum / n;
+
+        return {{"scene", spec.name},
+                {"bodies", spec.bodies},
+                {"nsPerStep", std::accumulate(stepNs.begin(), stepNs.end(), 0.0) / n},
+                {"p50Ns", percentile(0.5)},
+                {"p95Ns", percentile(0.95)},
+                {"maxNs", sorted.back()},
+                {"pairsPerStep", mean("CollisionStage.pairs")},
+                {"contactsPerStep", mean("CollisionStage.contacts")},
+                {"allocsPerStep", allocs / n},
+                {"bytesPerStep", bytes / n},
+                {"warmupAllocs", warmupAllocs},
+                {"stages", stages}};
+    }
+
+    json MachineInfo()
+    {
+        json machine = json::object();
+#if defined(_MSC_VER)
+        machine["compiler"] = "msvc " + std::to_string(_MSC_VER);
+#elif defined(__clang__)
+        machine["compiler"] = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        machine["compiler"] = std::string("gcc ") + __VERSION__;
+#endif
+#if defined(NDEBUG)
+        machine["build"] = "release";
+#else
+        machine["build"] = "debug";
+#endif
+        machine["hardwareThreads"] = std::thread::hardware_concurrency();
+#if !defined(PLATFORM_WEB)
+        machine["ompThreads"] = omp_get_max_threads();
+#endif
+        return machine;
+    }
+
+    std::string Timestamp()
+    {
+        std::time_t now = std::time(nullptr);
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        return buffer;
+    }
+}
+
+int RunPhysicsSuite(const PhysicsSuiteOptions &options)
+{
+    auto scaled = [&options](int count)
+    { return std::max(2, (int)(count * options.scale)); };
+    const SceneSpec scenes[] = {
+        {"falling", scaled(1000), BuildFalling},
+        {"falling", scaled(4000), BuildFalling},
+        {"orbits", scaled(2000), BuildOrbits},
+        {"orbits", scaled(8000), BuildOrbits},
+        {"bullets", scaled(1000), BuildBullets},
+        {"bullets", scaled(4000), BuildBullets},
+        {"bullets", scaled(10000), BuildBullets},
+        {"projectiles", scaled(4000), BuildProjectiles},
+        {"projectiles", scaled(10000), BuildProjectiles},
+        {"flight", scaled(1000), BuildFlight},
+        {"flight", scaled(8000), BuildFlight},
+    };
+
+    std::cout << "[PhysicsBench]: suite, steps=" << options.steps << " warmup=" << options.warmup
+              << " scale=" << options.scale << std::endl;
+    json results = json::array();
+    for (const auto &scene : scenes)
+    {
+        json result = RunScene(scene, options);
+        std::cout << "  " << scene.name << " x" << scene.bodies << ": "
+                  << result["nsPerStep"].get<double>() / 1.0e6 << " ms/step (p95 " << result["p95Ns"].get<double>() / 1.0e6
+                  << "), pairs/step " << result["pairsPerStep"].get<double>()
+                  << ", allocs/step " << result["allocsPerStep"].get<double>() << std::endl;
+        results.push_back(std::move(result));
+    }
+
+    json report = {{"revision", NW_GIT_REVISION},
+                   {"label", options.label},
+                   {"time", Timestamp()},
+                   {"machine", MachineInfo()},
+                   {"dt", FIXED_DT},
+                   {"steps", options.steps},
+                   {"warmup", options.warmup},
+                   {"scale", options.scale},
+                   {"results", results}};
+    std::ofstream file(options.outputPath);
+    if (!file.is_open())
+    {
+        std::cerr << "[PhysicsBench]: Failed to open " << options.outputPath << std::endl;
+        return 1;
+    }
+    file << report.dump(2) << std::endl;
+    std::cout << "[PhysicsBench]: results written to " << options.outputPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+
+// 无窗口物理基准套件: 在代码中生成压力场景 (落体堆叠 / N 体轨道 / 子弹风暴 / 投射物弹幕 / 飞行编队),
+// 经 GameWorld::FixedUpdate 推进固定步数, 统计每步耗时、碰撞对数与内存分配, 写出 JSON
+struct PhysicsSuiteOptions
+{
+    std::string outputPath = "physics_bench.json";
+    int steps = 300;
+    int warmup = 30;    // 不计入统计的预热步
+    float scale = 1.0f; // 物体数倍率
+    std::string label;  // 写入结果, 区分机器/配置
+};
+
+int RunPhysicsSuite(const PhysicsSuiteOptions &options);
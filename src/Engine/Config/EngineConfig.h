@@ -13,6 +13,16 @@ struct EngineConfig : public Config
     std::string windowTitle = "Default Engine Window";
 
     float targetFPS = 60.0f;
+    // 物理固定频率, <= 0 时与 targetFPS 相同
+    float fixedRate = 0.0f;
+    // 每帧最多执行的固定步数, 超出的时间丢弃 (游戏时间变慢), <= 0 不限制
+    int maxSubsteps = 5;
+    // 渲染在两次固定步之间插值
+    bool interpolation = true;
+    // 物理在独立线程上与绘制并行, 渲染晚一个固定步
+    bool asyncPhysics = false;
+
+    float GetFixedRate() const { return fixedRate > 0.0f ? fixedRate : targetFPS; }
 
     int initialScreen = SCREEN_STATE_NONE;
 
@@ -26,7 +36,7 @@ struct EngineConfig : public Config
     {
         j = json{
             {"window", {{"width", screenWidth}, {"height", screenHeight}, {"title", windowTitle}, {"fullscreen", fullScreen}}},
-            {"performance", {{"targetFPS", targetFPS}}},
+            {"performance", {{"targetFPS", targetFPS}, {"fixedRate", fixedRate}, {"maxSubsteps", maxSubsteps}, {"interpolation", interpolation}, {"asyncPhysics", asyncPhysics}}},
             {"network", {{"serverIP", serverIP}, {"serverPort", serverPort}}},
         };
     }
@@ -39,6 +49,10 @@ protected:
         this->screenHeight = configJson.at("window").value("height", this->screenHeight);
         this->windowTitle = configJson.at("window").value("title", this->windowTitle);
         this->targetFPS = configJson.at("performance").value("targetFPS", this->targetFPS);
+        this->fixedRate = configJson.at("performance").value("fixedRate", this->fixedRate);
+        this->maxSubsteps = configJson.at("performance").value("maxSubsteps", this->maxSubsteps);
+        this->interpolation = configJson.at("performance").value("interpolation", this->interpolation);
+        this->asyncPhysics = configJson.at("performance").value("asyncPhysics", this->asyncPhysics);
         if (configJson.contains("window"))
         {
             const auto &windowJson = configJson.at("window");
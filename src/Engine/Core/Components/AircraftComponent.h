@@ -0,0 +1,35 @@
+#pragma once
+#include "IComponent.h"
+
+// 飞行器气动参数与控制输入, 由 FlightDynamicsStage 统一计算升力/阻力/推力/操纵力矩
+// 脚本 (玩家/AI/网络) 只写控制输入
+struct AircraftComponent : public IComponent
+{
+    float liftCoefficient = 0.5f; // 升力系数
+    float dragCoefficient = 0.1f; // 阻力系数
+    // 面积, <= 0 时由碰撞盒推算 (机翼 x*z, 迎风 x*y)
+    float wingArea = 0.0f;
+    float frontalArea = 0.0f;
+
+    float maxThrust = 80.0f; // 最大推力
+    // 机动灵敏
+    float pitchPower = 30.0f;
+    float rollPower = 50.0f;
+    float yawPower = 15.0f;
+    // 达到满舵效的空速, 低速时操纵力矩按比例衰减
+    float controlSpeed = 100.0f;
+
+    // 控制输入: throttle 为推力比例 (负值为反推), 其余在 [-1, 1]
+    float throttle = 0.0f;
+    float pitch = 0.0f;
+    float roll = 0.0f;
+    float yaw = 0.0f;
+
+    // 最近一步的空速, 供脚本读取
+    float airspeed = 0.0f;
+
+    void ClearInputs()
+    {
+        throttle = pitch = roll = yaw = 0.0f;
+    }
+};
@@ -8,5 +8,6 @@
 #include "Engine/Core/Components/ParticleEmitterComponent.h"
 #include "Engine/Core/Components/AudioComponent.h"
 #include "Engine/Core/Components/LightComponent.h"
+#include "Engine/Core/Components/AircraftComponent.h"
 
 #include "Engine/Network/Sync/NetworkSyncComponent.h"
@@ -3,6 +3,7 @@
 #include "raylib.h"
 #include "raymath.h"
 #include "Engine/Math/Math.h"
+#include <cstdint>
 #include <iostream>
 #include <limits>
 
@@ -39,26 +40,65 @@ struct AABB
     }
 };
 
-struct RigidbodyComponent : public IComponent
+// 热数据 (积分/接触每步读写) 放在前两个缓存行, 形状与配置其后, 回调等冷数据放最后
+struct alignas(64) RigidbodyComponent : public IComponent
 {
     RigidbodyComponent(const float &mass = 1.0f,
                        const float &drag = 0.0f,
                        const Vector3f &velocity = Vector3f(0.0f, 0.0f, 0.0f),
                        const Vector3f &acceleration = Vector3f(0.0f, 0.0f, 0.0f))
-        : mass(mass),
+        : velocity(velocity),
+          mass(mass),
           drag(drag),
-          velocity(velocity),
           acceleration(acceleration) {}
     RigidbodyComponent(const RigidbodyComponent &other) = default;
 
     ~RigidbodyComponent() = default;
 
+    // ---- 热数据 ----
+    Vector3f velocity = Vector3f(0.0f, 0.0f, 0.0f);           // 当前速度
+    Vector3f angularVelocity = Vector3f(0.0f, 0.0f, 0.0f);    // 角速度
+    Vector3f angularMomentum = Vector3f(0.0f, 0.0f, 0.0f);    // 角动量
+    Vector3f accumulatedForces = Vector3f(0.0f, 0.0f, 0.0f);  // 当前合力
+    Vector3f accumulatedTorques = Vector3f(0.0f, 0.0f, 0.0f); // 当前扭矩
+    // 世界系逆惯性张量 R * I^-1 * R^T, 速度积分开始时按当前朝向刷新, 位置积分写回朝向后再刷新一次;
+    // 积分前的检测阶段读到的是上一步写回的值
+    Matrix3f worldInverseInertia = Matrix3f::identity();
+    float mass = 1.0f;
+    float drag = 0.5f;         // 线性空气阻力
+    float angularDrag = 0.01f; // 角空气阻力
+    bool isSleeping = false;
+    // 场景加载时烘焙进 StaticGeometry, 不再作为动态候选参与检测; 无脚本的零质量刚体加载时自动标记
+    bool isStatic = false;
+    // 连续碰撞检测, 用于高速小物体
+    bool ccd = false;
+    bool ccdIntegrated = false; // 本步位置已由 CCD 推进, 积分器只更新旋转
+
+    // ---- 惯性与碰撞形状 ----
+    // 主轴惯性 (局部系对角元), 所有设置函数都只产生对角张量
+    Vector3f inertia = Vector3f(1.0f, 1.0f, 1.0f);
+    Vector3f inverseInertia = Vector3f(1.0f, 1.0f, 1.0f);
     float elasticity = 1.0f; // 弹性系数
     bool Collidable = false;
     ColliderType colliderType = ColliderType::NONE;
     AABB localAABB = AABB(Vector3f(0.0f, 0.0f, 0.0f),
                           Vector3f(0.0f, 0.0f, 0.0f));
     float boudingRadius = 0.0f;
+    // 碰撞层 (0~31) 与可检测的层掩码, 见 CollisionLayers
+    int collisionLayer = 0;
+    uint32_t collisionMask = 0xFFFFFFFFu;
+
+    // ---- 冷数据 ----
+    Vector3f acceleration = {0.0f, 0.0f, 0.0f}; // 当前加速度
+    // 休眠
+    bool canSleep = true;
+    float sleepTimer = 0.0f; // 低能量持续时间
+    AABB sleepingAABB;       // 入睡时缓存的世界包围盒
+    Vector3f sleepingPosition; // 入睡时的局部位姿, 休眠中被直接改写 (传送) 时唤醒
+    Quat4f sleepingRotation;
+    int islandIndex = -1; // IslandManager 本步的下标, 可能是以前步骤留下的
+    int solverIndex = -1; // ContactSolver 本步的下标, 同上
+    // 与另一刚体开始接触时调用 (CCD 每次扫掠命中也会调用), 持续接触不重复调用
     std::function<void(GameObject *)> collisionCallback;
 
     void setHitboxBox(const Vector3f &min, const Vector3f &max)
@@ -79,27 +119,50 @@ struct RigidbodyComponent : public IComponent
         Collidable = true;
     }
 
-    float mass = 1.0f;
-    float drag = 0.5f; // 线性空气阻力
-
-    Matrix3f inertiaTensor = Matrix3f::identity();            // 惯性张量
-    Matrix3f inverseInertiaTensor = Matrix3f::identity();     // 逆惯性张量
-    float angularDrag = 0.01f;                                // 角空气阻力
-    Vector3f angularVelocity = Vector3f(0.0f, 0.0f, 0.0f);    // 角速度
-    Vector3f angularMomentum = Vector3f(0.0f, 0.0f, 0.0f);    // 角动量
-    Vector3f accumulatedTorques = Vector3f(0.0f, 0.0f, 0.0f); // 当前扭矩
+    // 只重置已休眠物体的计时, 醒着的物体由能量判据决定
+    void WakeUp()
+    {
+        if (!isSleeping)
+            return;
+        isSleeping = false;
+        sleepTimer = 0.0f;
+    }
 
-    Vector3f velocity = Vector3f(0.0f, 0.0f, 0.0f);  // 当前速度
-    Vector3f acceleration = {0.0f, 0.0f, 0.0f};      // 当前加速度
-    Vector3f accumulatedForces = {0.0f, 0.0f, 0.0f}; // 当前合力
+    // R * diag(d) * R^T, 结果对称只算上三角; 在局部数组上展开, 不逐元素访问 Matrix3f
+    static Matrix3f RotateDiagonal(const float (&r)[3][3], const Vector3f &d)
+    {
+        const float dx = d.x(), dy = d.y(), dz = d.z();
+        float m[3][3];
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = i; j < 3; j++)
+                m[i][j] = m[j][i] = r[i][0] * dx * r[j][0] + r[i][1] * dy * r[j][1] + r[i][2] * dz * r[j][2];
+        }
+        return Matrix3f(m[0][0], m[0][1], m[0][2],
+                        m[1][0], m[1][1], m[1][2],
+                        m[2][0], m[2][1], m[2][2]);
+    }
+    static Matrix3f RotateDiagonal(const Quat4f &q, const Vector3f &d)
+    {
+        const float w = q.w(), x = q.x(), y = q.y(), z = q.z();
+        const float r[3][3] = {{1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z), 2.0f * (x * z + w * y)},
+                               {2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z - w * x)},
+                               {2.0f * (x * z - w * y), 2.0f * (y * z + w * x), 1.0f - 2.0f * (x * x + y * y)}};
+        return RotateDiagonal(r, d);
+    }
+    void UpdateWorldInertia(const Quat4f &rotation)
+    {
+        worldInverseInertia = RotateDiagonal(rotation, inverseInertia);
+    }
+    Matrix3f GetWorldInertia(const Quat4f &rotation) const
+    {
+        return RotateDiagonal(rotation, inertia);
+    }
 
     void SetAnglularVelocity(Vector3f angularVelocity, Quat4f rotation = Quat4f::IDENTITY)
     {
         this->angularVelocity = angularVelocity;
-        Matrix3f rotationMatrix = rotation.toMatrix();
-        Matrix3f worldInertia = rotationMatrix * (this->inertiaTensor) * rotationMatrix.transposed();
-
-        this->angularMomentum = worldInertia * (this->angularVelocity);
+        this->angularMomentum = GetWorldInertia(rotation) * (this->angularVelocity);
     }
     void SetHitbox(Vector3f size)
     {
@@ -140,10 +203,11 @@ struct RigidbodyComponent : public IComponent
             return;
 
         float i = (2.0f / 5.0f) * mass * radius * radius;
-        inverseInertiaTensor = Matrix3f::identity();
-        inverseInertiaTensor.setDiag(1.0f / i, 1.0f / i, 1.0f / i);
-        inertiaTensor = Matrix3f::identity();
-        inertiaTensor.setDiag(i, i, i);
+        inertia = Vector3f(i, i, i);
+        inverseInertia = Vector3f(1.0f / i, 1.0f / i, 1.0f / i);
+        // 球的张量与朝向无关
+        worldInverseInertia = Matrix3f::identity();
+        worldInverseInertia.setDiag(1.0f / i, 1.0f / i, 1.0f / i);
     }
     // I = 1/12 * m * (h*h + d*d)
     void SetBoxInertia(Vector3f size, Quat4f rotation = Quat4f::IDENTITY)
@@ -158,31 +222,22 @@ struct RigidbodyComponent : public IComponent
         float ixx = (1.0f / 12.0f) * mass * (y2 + z2);
         float iyy = (1.0f / 12.0f) * mass * (x2 + z2);
         float izz = (1.0f / 12.0f) * mass * (x2 + y2);
-
-        inverseInertiaTensor = Matrix3f::identity();
-        inverseInertiaTensor.setDiag(1.0f / ixx, 1.0f / iyy, 1.0f / izz);
-        inertiaTensor = Matrix3f::identity();
-        inertiaTensor.setDiag(ixx, iyy, izz);
-
-        Matrix3f rotationMatrix = rotation.toMatrix();
-        Matrix3f worldInertia = rotationMatrix * (this->inertiaTensor) * rotationMatrix.transposed();
-        this->angularMomentum = worldInertia * (this->angularVelocity);
+        SetDiagInertia(ixx, iyy, izz, rotation);
     }
     void SetDiagInertia(float xx, float yy, float zz, Quat4f rotation = Quat4f::IDENTITY)
     {
-        inverseInertiaTensor = Matrix3f::identity();
-        inverseInertiaTensor.setDiag(1.0f / xx, 1.0f / yy, 1.0f / zz);
-        inertiaTensor = Matrix3f::identity();
-        inertiaTensor.setDiag(xx, yy, zz);
+        inertia = Vector3f(xx, yy, zz);
+        inverseInertia = Vector3f(1.0f / xx, 1.0f / yy, 1.0f / zz);
 
-        Matrix3f rotationMatrix = rotation.toMatrix();
-        Matrix3f worldInertia = rotationMatrix * (this->inertiaTensor) * rotationMatrix.transposed();
-        this->angularMomentum = worldInertia * (this->angularVelocity);
+        worldInverseInertia = RotateDiagonal(rotation, inverseInertia);
+        this->angularMomentum = RotateDiagonal(rotation, inertia) * (this->angularVelocity);
     }
     // 施加冲量
     void AddImpulse(Vector3f impulse, Vector3f r = Vector3f::ZERO)
     {
         float invMass = mass > std::numeric_limits<float>::min() ? 1.0f / mass : 0.0f;
+        if (impulse.LengthSquared() > 0.0f)
+            WakeUp();
         this->velocity += impulse * invMass;
         if (invMass > std::numeric_limits<float>::min())
             this->angularMomentum += r ^ impulse;
@@ -190,10 +245,14 @@ struct RigidbodyComponent : public IComponent
     // 施加力
     void AddForce(Vector3f force)
     {
+        if (force.LengthSquared() > 0.0f)
+            WakeUp();
         accumulatedForces += force;
     }
     void AddTorque(Vector3f torque)
     {
+        if (torque.LengthSquared() > 0.0f)
+            WakeUp();
         accumulatedTorques += torque;
     }
     // 清空受力 (每帧结束时调用)
@@ -212,16 +271,20 @@ struct HitBox
     Vector3f axes[3];
     Vector3f halfExtents;
     // Sphere
-    float boudingRadius;
+    float boudingRadius = 0.0f;
+    HitBox() = default;
     HitBox(const TransformComponent &tf, const RigidbodyComponent &rb)
+        : HitBox(tf.GetLocalPosition(), tf.GetLocalRotation(), rb) {}
+    // 指定姿态 (如渲染姿态), 只读刚体的形状参数
+    HitBox(const Vector3f &center, const Quat4f &rotation, const RigidbodyComponent &rb)
     {
         switch (rb.colliderType)
         {
         case ColliderType::SPHERE:
-            setHitboxSphere(tf.GetLocalPosition(), tf.GetLocalRotation(), rb.boudingRadius);
+            setHitboxSphere(center, rotation, rb.boudingRadius);
             break;
         case ColliderType::BOX:
-            setHitboxBox(tf.GetLocalPosition(), tf.GetLocalRotation(), rb.localAABB);
+            setHitboxBox(center, rotation, rb.localAABB);
             break;
         default:
             break;
@@ -251,7 +314,7 @@ struct HitBox
     {
         float res = 0.0f;
         for (int i = 0; i < 3; i++)
-            res += a.halfExtents[i] * fabs(a.axes[i] * axis);
+            res += a.halfExtents[i] * std::fabs(a.axes[i] * axis);
         return res;
     }
     static bool TestAxis(const HitBox &a, const HitBox &b, Vector3f axis,
@@ -261,7 +324,7 @@ struct HitBox
             return false;
         axis.Normalize();
 
-        float distProj = fabs((b.center - a.center) * axis);
+        float distProj = std::fabs((b.center - a.center) * axis);
         float sumRadius = GetProjectionRadius(a, axis) + GetProjectionRadius(b, axis);
 
         float pen = sumRadius - distProj;
@@ -480,7 +543,12 @@ struct HitBox
         normal = bestAxis;
         if (normal * (b.center - a.center) < 0)
             normal = -normal;
-
+        hitPoint = GetBoxBoxContactPoint(a, b, normal, bestAxisIndex);
+        return true;
+    }
+    // 由最小穿透轴 (已指向 b) 求接触点, 与分离轴测试的实现无关
+    static Vector3f GetBoxBoxContactPoint(const HitBox &a, const HitBox &b, const Vector3f &normal, int bestAxisIndex)
+    {
         if (bestAxisIndex < 6)
         {
             const HitBox *refBox;
@@ -499,7 +567,7 @@ struct HitBox
                 otherBox = &a;
                 serachDir = normal;
             }
-            hitPoint = HitBox::GetSupportPoint(*otherBox, serachDir);
+            return HitBox::GetSupportPoint(*otherBox, serachDir);
         }
         else
         {
@@ -516,9 +584,8 @@ struct HitBox
 
             auto p2 = ptB + eDirB * b.halfExtents[j];
             auto q2 = ptB - eDirB * b.halfExtents[j];
-            hitPoint = HitBox::GetContactPointEdgeEdge(p1, q1, p2, q2);
+            return HitBox::GetContactPointEdgeEdge(p1, q1, p2, q2);
         }
-        return true;
     }
 
     static Vector3f GetSupportPoint(const HitBox &a, const Vector3f &dir)
@@ -1,5 +1,6 @@
 #include "Engine/Core/GameObject/GameObject.h"
 #include "Engine/Core/Components/TransformComponent.h"
+#include "Engine/Core/GameWorld.h"
 
 TransformComponent::TransformComponent(const Vector3f &pos) : localPosition(pos)
 {
@@ -34,6 +35,8 @@ Matrix4f TransformComponent::GetWorldMatrix() const
 void TransformComponent::SetWorldMatrix(const Matrix4f &newWorldMat)
 {
     worldMatrix = newWorldMat;
+    if (!IsRenderMatrixLocked())
+        renderMatrix = newWorldMat;
     Matrix4f localMat;
 
     if (parent == nullptr)
@@ -53,6 +56,39 @@ void TransformComponent::SetWorldMatrix(const Matrix4f &newWorldMat)
             child->GetComponent<TransformComponent>().SetDirty();
     }
 }
+void TransformComponent::GetWorldTRS(Vector3f &pos, Quat4f &rot, Vector3f &scl) const
+{
+    if (parent == nullptr && !isDirty)
+    {
+        pos = localPosition;
+        rot = localRotation;
+        scl = localScale;
+        return;
+    }
+    pos = worldMatrix.getTranslation();
+    rot = worldMatrix.getRotation();
+    scl = worldMatrix.getScale();
+}
+void TransformComponent::SetWorldTRS(const Vector3f &pos, const Quat4f &rot, const Vector3f &scl)
+{
+    if (parent != nullptr)
+    {
+        SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scl));
+        return;
+    }
+    worldMatrix = Matrix4f::CreateTransform(pos, rot, scl);
+    if (!IsRenderMatrixLocked())
+        renderMatrix = worldMatrix;
+    localPosition = pos;
+    localRotation = rot;
+    localScale = scl;
+    isDirty = false;
+    for (auto *child : children)
+    {
+        if (child)
+            child->GetComponent<TransformComponent>().SetDirty();
+    }
+}
 void TransformComponent::SetLocalPosition(const Vector3f &pos)
 {
     localPosition = pos;
@@ -120,4 +156,62 @@ Quat4f TransformComponent::GetWorldRotation() const { return worldMatrix.getRota
 Vector3f TransformComponent::GetWorldScale() const { return worldMatrix.getScale(); }
 Vector3f TransformComponent::GetForward() const { return worldMatrix.getCol(2).xyz().Normalized(); }
 Vector3f TransformComponent::GetUp() const { return worldMatrix.getCol(1).xyz().Normalized(); }
-Vector3f TransformComponent::GetRight() const { return worldMatrix.getCol(0).xyz().Normalized(); }
\ No newline at end of file
+Vector3f TransformComponent::GetRight() const { return worldMatrix.getCol(0).xyz().Normalized(); }
+
+void TransformComponent::SavePreviousPose()
+{
+    Vector3f scale;
+    GetWorldTRS(prevPosition, prevRotation, scale);
+    hasPrevPose = true;
+}
+void TransformComponent::SnapInterpolation()
+{
+    hasPrevPose = false;
+    hasPublishedPose = false;
+    renderMatrix = worldMatrix;
+}
+bool TransformComponent::UpdateRenderMatrix(float alpha)
+{
+    if (!interpolate || !hasPrevPose || alpha >= 1.0f)
+    {
+        renderMatrix = worldMatrix;
+        return false;
+    }
+    Vector3f pos, scl;
+    Quat4f rot;
+    GetWorldTRS(pos, rot, scl);
+    renderMatrix = Matrix4f::CreateTransform(Vector3f::Lerp(prevPosition, pos, alpha), Quat4f::slerp(prevRotation, rot, alpha), scl);
+    return true;
+}
+bool TransformComponent::IsRenderMatrixLocked() const
+{
+    GameWorld *world = owner ? owner->GetOwnerWorld() : nullptr;
+    return world && world->IsRenderMatrixLocked();
+}
+void TransformComponent::SetRenderMatrix(const Matrix4f &mat) { renderMatrix = mat; }
+const Matrix4f &TransformComponent::GetRenderMatrix() const { return renderMatrix; }
+Vector3f TransformComponent::GetRenderPosition() const { return renderMatrix.getTranslation(); }
+Quat4f TransformComponent::GetRenderRotation() const { return renderMatrix.getRotation(); }
+Vector3f TransformComponent::GetRenderScale() const { return renderMatrix.getScale(); }
+
+void TransformComponent::PublishPose()
+{
+    prevPosition = publishedPosition;
+    prevRotation = publishedRotation;
+    hasPrevPose = hasPublishedPose;
+    GetWorldTRS(publishedPosition, publishedRotation, publishedScale);
+    hasPublishedPose = true;
+}
+void TransformComponent::UpdatePublishedRenderMatrix(float alpha)
+{
+    // 发布之前 (刚激活/瞬移) 保留激活时同步的渲染矩阵
+    if (!hasPublishedPose)
+        return;
+    if (!interpolate || !hasPrevPose || alpha >= 1.0f)
+    {
+        renderMatrix = Matrix4f::CreateTransform(publishedPosition, publishedRotation, publishedScale);
+        return;
+    }
+    renderMatrix = Matrix4f::CreateTransform(Vector3f::Lerp(prevPosition, publishedPosition, alpha),
+                                             Quat4f::slerp(prevRotation, publishedRotation, alpha), publishedScale);
+}
\ No newline at end of file
@@ -12,6 +12,17 @@ private:
     Vector3f localScale = Vector3f(1.0f, 1.0f, 1.0f);
 
     Matrix4f worldMatrix = Matrix4f::identity();
+    // 渲染用的世界矩阵, 世界矩阵更新时同步, GameWorld 每帧按插值系数覆盖
+    Matrix4f renderMatrix = Matrix4f::identity();
+    // 上一固定步开始时的世界姿态
+    Vector3f prevPosition = Vector3f(0.0f, 0.0f, 0.0f);
+    Quat4f prevRotation = Quat4f(1.0f, 0.0f, 0.0f, 0.0f);
+    bool hasPrevPose = false;
+    // 异步物理: 最近一次发布的世界姿态, 只由主线程读写
+    Vector3f publishedPosition = Vector3f(0.0f, 0.0f, 0.0f);
+    Quat4f publishedRotation = Quat4f(1.0f, 0.0f, 0.0f, 0.0f);
+    Vector3f publishedScale = Vector3f(1.0f, 1.0f, 1.0f);
+    bool hasPublishedPose = false;
 
     // 组件所属对象
     GameObject *parent = nullptr;       // 父对象
@@ -19,6 +30,8 @@ private:
 
 public:
     bool isDirty = true;
+    // 为 false 时渲染当前物理姿态, 不在两次固定步之间插值
+    bool interpolate = true;
 
     TransformComponent() = default;
     TransformComponent(const Vector3f &pos);
@@ -31,6 +44,9 @@ public:
     Matrix4f GetLocalMatrix() const;
     Matrix4f GetWorldMatrix() const;
     void SetWorldMatrix(const Matrix4f &mat);
+    // 根节点且不脏时局部 TRS 即世界 TRS, 跳过矩阵分解
+    void GetWorldTRS(Vector3f &pos, Quat4f &rot, Vector3f &scl) const;
+    void SetWorldTRS(const Vector3f &pos, const Quat4f &rot, const Vector3f &scl);
 
     void SetLocalPosition(const Vector3f &pos);
     Vector3f GetLocalPosition() const;
@@ -53,4 +69,25 @@ public:
     Vector3f GetForward() const;
     Vector3f GetUp() const;
     Vector3f GetRight() const;
+
+    // 渲染插值: 固定步开始时记录姿态, 渲染时在上一步与当前姿态之间按 alpha 插值
+    void SavePreviousPose();
+    // 瞬移后调用, 下一固定步之前不插值
+    void SnapInterpolation();
+    // 根节点使用, 返回是否做了插值
+    bool UpdateRenderMatrix(float alpha);
+    void SetRenderMatrix(const Matrix4f &mat);
+    const Matrix4f &GetRenderMatrix() const;
+    Vector3f GetRenderPosition() const;
+    Quat4f GetRenderRotation() const;
+    Vector3f GetRenderScale() const;
+
+    // 异步物理: 固定步收尾后发布当前世界姿态, 上一次发布的姿态作为插值起点
+    void PublishPose();
+    // 在最近两次发布的姿态之间插值, 不读物理线程正在写的数据; 根节点使用
+    void UpdatePublishedRenderMatrix(float alpha);
+
+private:
+    // 所属世界的异步物理步进行中时, 写世界矩阵不同步渲染矩阵 (渲染矩阵归主线程)
+    bool IsRenderMatrixLocked() const;
 };
\ No newline at end of file
@@ -54,6 +54,14 @@ public:
         m_idToType.erase(itType);
     }
 
+    // 无人订阅时发送方可以跳过构造事件
+    template <typename T>
+    bool HasSubscribers() const
+    {
+        auto it = m_subscribers.find(typeid(T));
+        return it != m_subscribers.end() && !it->second.empty();
+    }
+
     void Emit(const IEvent &event)
     {
         auto it = m_subscribers.find(event.GetTypeIndex());
@@ -64,8 +72,47 @@ public:
         }
     }
 
+    // 延迟模式 (异步物理步进行中): Post 的事件与 Defer 的回调先入队, 由主线程 FlushDeferred 按顺序分发
+    // 延迟期间只允许物理线程入队
+    void SetDeferred(bool deferred) { m_deferred = deferred; }
+    bool IsDeferred() const { return m_deferred; }
+
+    template <typename T>
+    void Post(const T &event)
+    {
+        if (!m_deferred)
+        {
+            Emit(event);
+            return;
+        }
+        m_deferredQueue.push_back([this, event]()
+                                  { Emit(event); });
+    }
+    void Defer(std::function<void()> callback)
+    {
+        if (!m_deferred)
+        {
+            callback();
+            return;
+        }
+        m_deferredQueue.push_back(std::move(callback));
+    }
+    void FlushDeferred()
+    {
+        if (m_deferredQueue.empty())
+            return;
+        // 换出后再分发, 回调中可以继续 Post
+        std::vector<std::function<void()>> queue;
+        queue.swap(m_deferredQueue);
+        for (auto &callback : queue)
+            callback();
+    }
+    void ClearDeferred() { m_deferredQueue.clear(); }
+
 private:
     std::atomic<Subscription_ID> m_nextID;
     std::unordered_map<std::type_index, std::vector<Subscription>> m_subscribers;
     std::unordered_map<Subscription_ID, std::type_index> m_idToType;
+    bool m_deferred = false;
+    std::vector<std::function<void()>> m_deferredQueue;
 };
\ No newline at end of file
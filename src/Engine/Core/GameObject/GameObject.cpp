@@ -95,6 +95,7 @@ bool GameObject::IsWaitingDestroy() const
 
 #include "Engine/Core/Components/Components.h"
 #include "Engine/Math/Math.h"
+#include "Engine/Math/Batch/BatchTransform.h"
 AABB GameObject::GetWorldAABB(Vector3f (*outCorners)[8]) const
 {
     if (!this->HasComponent<RigidbodyComponent>() || !this->HasComponent<TransformComponent>())
@@ -119,38 +120,29 @@ AABB GameObject::GetWorldAABB(Vector3f (*outCorners)[8]) const
         }
         return AABB(center - Vector3f(radius, radius, radius), center + Vector3f(radius, radius, radius));
     }
-    Vector3f min = rb.localAABB.min;
-    Vector3f max = rb.localAABB.max;
-    Vector3f corners[8] = {
-        Vector3f(min.x(), min.y(), min.z()),
-        Vector3f(min.x(), min.y(), max.z()),
-        Vector3f(min.x(), max.y(), min.z()),
-        Vector3f(min.x(), max.y(), max.z()),
-        Vector3f(max.x(), min.y(), min.z()),
-        Vector3f(max.x(), min.y(), max.z()),
-        Vector3f(max.x(), max.y(), min.z()),
-        Vector3f(max.x(), max.y(), max.z()),
-    };
-    float angle = 0.0f;
+    const Vector3f &min = rb.localAABB.min;
+    const Vector3f &max = rb.localAABB.max;
 
-    // Vector3f axis = tf.GetLocalRotation().getAxisAngle(&angle);
-    // Vector3f worldPos = tf.GetLocalPosition();
-    Vector3f axis = tf.GetWorldRotation().getAxisAngle(&angle);
-    Vector3f worldPos = tf.GetWorldPosition();
-
-    Vector3f newMin = Vector3f(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-    Vector3f newMax = Vector3f(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
-    for (int i = 0; i < 8; i++)
+    // 碰撞包围盒只随旋转和平移变化, 不受缩放影响
+    const Matrix4f transform = Matrix4f::CreateTransform(tf.GetWorldPosition(), tf.GetWorldRotation(), Vector3f(1.0f, 1.0f, 1.0f));
+    if (outCorners != nullptr)
     {
-        corners[i] = corners[i];
-        corners[i].RotateByAxixAngle(axis, angle);
-        corners[i] += worldPos;
-        if (outCorners != nullptr)
-            (*outCorners)[i] = corners[i];
-        newMin = Vector3f::Min(newMin, corners[i]);
-        newMax = Vector3f::Max(newMax, corners[i]);
+        const Vector3f corners[8] = {
+            Vector3f(min.x(), min.y(), min.z()),
+            Vector3f(min.x(), min.y(), max.z()),
+            Vector3f(min.x(), max.y(), min.z()),
+            Vector3f(min.x(), max.y(), max.z()),
+            Vector3f(max.x(), min.y(), min.z()),
+            Vector3f(max.x(), min.y(), max.z()),
+            Vector3f(max.x(), max.y(), min.z()),
+            Vector3f(max.x(), max.y(), max.z()),
+        };
+        BatchTransform::TransformPoints(transform, corners, *outCorners, 8);
     }
-    return AABB{newMin, newMax};
+
+    AABB worldAABB;
+    BatchTransform::TransformAABB(transform, min, max, worldAABB.min, worldAABB.max);
+    return worldAABB;
 }
 renderAABB GameObject::GetWorldRenderAABB() const
 {
@@ -162,37 +154,21 @@ renderAABB GameObject::GetWorldRenderAABB() const
     const auto &rd = GetComponent<RenderComponent>();
     const auto &tf = GetComponent<TransformComponent>();
 
-    Vector3f min = rd.localAABB.min;
-    Vector3f max = rd.localAABB.max;
-
-    Vector3f s = rd.scale;
-    min = min & s;
-    max = max & s;
-
-    Vector4f corners[8] = {
-        Vector4f(min.x(), min.y(), min.z(), 1.0f),
-        Vector4f(min.x(), min.y(), max.z(), 1.0f),
-        Vector4f(min.x(), max.y(), min.z(), 1.0f),
-        Vector4f(min.x(), max.y(), max.z(), 1.0f),
-        Vector4f(max.x(), min.y(), min.z(), 1.0f),
-        Vector4f(max.x(), min.y(), max.z(), 1.0f),
-        Vector4f(max.x(), max.y(), min.z(), 1.0f),
-        Vector4f(max.x(), max.y(), max.z(), 1.0f)};
-
-    Matrix4f worldMat = tf.GetWorldMatrix();
-
-    Vector3f worldMin(FLT_MAX, FLT_MAX, FLT_MAX);
-    Vector3f worldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-    for (int i = 0; i < 8; i++)
-    {
-        Vector3f worldCorner = (worldMat * corners[i]).xyz();
+    const Vector3f &localMin = rd.localAABB.min;
+    const Vector3f &localMax = rd.localAABB.max;
+    // 尚未设置网格的空包围盒
+    if (localMin.x() > localMax.x() || localMin.y() > localMax.y() || localMin.z() > localMax.z())
+        return renderAABB();
 
-        worldMin = Vector3f::Min(worldMin, worldCorner);
-        worldMax = Vector3f::Max(worldMax, worldCorner);
-    }
+    // 负缩放会交换上下界
+    const Vector3f &s = rd.scale;
+    const Vector3f min = Vector3f::Min(localMin & s, localMax & s);
+    const Vector3f max = Vector3f::Max(localMin & s, localMax & s);
 
-    return renderAABB(worldMin, worldMax);
+    // 渲染包围盒跟随插值后的渲染姿态
+    renderAABB worldAABB;
+    BatchTransform::TransformAABB(tf.GetRenderMatrix(), min, max, worldAABB.min, worldAABB.max);
+    return worldAABB;
 }
 
 void GameObject::SetActive(bool active)
@@ -44,7 +44,7 @@ void GameObjectFactory::ApplyComponent(GameWorld &gameWorld, GameObject &gameObj
     else if (compName == "RenderComponent")
         ParseRenderComponent(gameWorld, gameObject, prefab);
     else if (compName == "RigidBodyComponent")
-        ParseRigidBodyComponent(gameObject, prefab);
+        ParseRigidBodyComponent(gameWorld, gameObject, prefab);
     else if (compName == "ScriptComponent")
         ParseScriptComponent(gameWorld, gameObject, prefab);
     else if (compName == "ParticleEmitterComponent")
@@ -53,6 +53,8 @@ void GameObjectFactory::ApplyComponent(GameWorld &gameWorld, GameObject &gameObj
         ParseAudioComponent(gameWorld, gameObject, prefab);
     else if (compName == "LightComponent")
         ParseLightComponent(gameWorld, gameObject, prefab);
+    else if (compName == "AircraftComponent")
+        ParseAircraftComponent(gameObject, prefab);
     else
         std::cerr << "Component " << compName << " not implemented" << std::endl;
 }
@@ -87,6 +89,21 @@ void GameObjectFactory::ParseLightComponent(GameWorld &gameWorld, GameObject &ga
     light.castShadows = prefab.value("shadows", false);
     light.shadowBias = prefab.value("shadowBias", 0.005f);
 }
+void GameObjectFactory::ParseAircraftComponent(GameObject &gameObject, const json &prefab)
+{
+    auto &ac = gameObject.AddComponent<AircraftComponent>();
+    ac.owner = &gameObject;
+    ac.liftCoefficient = prefab.value("liftCoefficient", ac.liftCoefficient);
+    ac.dragCoefficient = prefab.value("dragCoefficient", ac.dragCoefficient);
+    // 不填时由碰撞盒推算
+    ac.wingArea = prefab.value("wingArea", 0.0f);
+    ac.frontalArea = prefab.value("frontalArea", 0.0f);
+    ac.maxThrust = prefab.value("thrust", ac.maxThrust);
+    ac.pitchPower = prefab.value("pitchPower", ac.pitchPower);
+    ac.rollPower = prefab.value("rollPower", ac.rollPower);
+    ac.yawPower = prefab.value("yawPower", ac.yawPower);
+    ac.controlSpeed = prefab.value("controlSpeed", ac.controlSpeed);
+}
 void GameObjectFactory::ParseAudioComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab)
 {
     auto &audio = gameObject.AddComponent<AudioComponent>();
@@ -197,8 +214,10 @@ void GameObjectFactory::ParseTransformComponent(GameObject &gameObject, const js
         tf.SetLocalScale(JsonParser::ToVector3f(prefab["scale"]));
     if (prefab.contains("rotation"))
         tf.SetLocalRotation(Quat4f::XYZRotate(DEG2RAD * JsonParser::ToVector3f(prefab["rotation"])));
+    // 为 false 时渲染直接使用当前物理姿态
+    tf.interpolate = prefab.value("interpolate", true);
 }
-void GameObjectFactory::ParseRigidBodyComponent(GameObject &gameObject, const json &prefab)
+void GameObjectFactory::ParseRigidBodyComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab)
 {
     if (!gameObject.HasComponent<TransformComponent>())
     {
@@ -229,8 +248,14 @@ void GameObjectFactory::ParseRigidBodyComponent(GameObject &gameObject, const js
         rb.SetHitbox(JsonParser::ToVector3f(prefab["hitBox"]));
     else
         rb.SetHitbox(tf.GetLocalScale());
+    rb.UpdateWorldInertia(tf.GetLocalRotation());
 
     rb.Collidable = prefab.value("isCollidable", true);
+    rb.canSleep = prefab.value("canSleep", true);
+    rb.isStatic = prefab.value("static", false);
+    rb.ccd = prefab.value("ccd", false);
+
+    gameWorld.GetPhysicsSystem().GetCollisionLayers().ParseBodyLayer(prefab, rb.collisionLayer, rb.collisionMask);
 }
 void GameObjectFactory::ParseScriptComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab)
 {
@@ -14,13 +14,14 @@ public:
 
 private:
     static void ApplyComponent(GameWorld &gameWorld, GameObject &gameObject, const std::string &compName, const json &prefab);
-    static void ParseRigidBodyComponent(GameObject &gameObject, const json &prefab);
+    static void ParseRigidBodyComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab);
     static void ParseTransformComponent(GameObject &gameObject, const json &prefab);
     static void ParseScriptComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab);
     static void ParseRenderComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab);
     static void ParseParticleEmitterComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab);
     static void ParseAudioComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab);
     static void ParseLightComponent(GameWorld &gameWorld, GameObject &gameObject, const json &prefab);
+    static void ParseAircraftComponent(GameObject &gameObject, const json &prefab);
 
     static renderAABB GetMeshAABB(const Mesh &mesh);
 };
\ No newline at end of file
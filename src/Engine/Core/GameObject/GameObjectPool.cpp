@@ -41,6 +41,8 @@ GameObject *GameObjectPool::Spawn(const std::string &name, const std::string &ta
     tf.SetLocalPosition(position);
     tf.SetLocalRotation(rotation);
     tf.SetDirty();
+    if (obj->HasComponent<RigidbodyComponent>())
+        obj->GetComponent<RigidbodyComponent>().UpdateWorldInertia(rotation);
 
     obj->SetActive(true);
     if (obj->HasComponent<ScriptComponent>())
@@ -62,6 +64,7 @@ void GameObjectPool::Recycle(GameObject *obj)
         rb.angularVelocity = Vector3f::ZERO;
         rb.angularMomentum = Vector3f::ZERO;
         rb.ClearForces();
+        rb.WakeUp();
     }
     if (obj->HasComponent<ScriptComponent>())
     {
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include "Engine/System/System.h"
 #include "Engine/Graphics/Graphics.h"
+#include "Engine/System/Physics/Async/PhysicsWorker.h"
 #include <string>
 
 GameWorld::GameWorld(std::function<void(ScriptingFactory &, PhysicsStageFactory &, ParticleFactory &)> configCallback,
@@ -15,7 +16,8 @@ GameWorld::GameWorld(std::function<void(ScriptingFactory &, PhysicsStageFactory
                      bool headless)
     : m_resourceManager(resourceManager),
       m_audioManager(audioManager),
-      m_nextObjectID(0)
+      m_nextObjectID(0),
+      m_headless(headless)
 {
     m_timeManager = std::make_unique<TimeManager>();
     m_timerManager = std::make_unique<TimerManager>();
@@ -29,14 +31,20 @@ GameWorld::GameWorld(std::function<void(ScriptingFactory &, PhysicsStageFactory
     m_renderer = std::make_unique<Renderer>();
     m_particleFactory = std::make_unique<ParticleFactory>();
     m_particleSystem = std::make_unique<ParticleSystem>(this);
+    m_projectileSystem = std::make_unique<ProjectileSystem>();
 
     // NetworkClient is injected by ScreenManager via SetNetworkClient().
     m_networkSyncSystem = std::make_unique<NetworkSyncSystem>();
 
     configCallback(*m_scriptingFactory, *m_physicsStageFactory, *m_particleFactory);
 
+    // headless: 只跑逻辑与物理, 不加载相机/渲染/输入配置; 场景路径为空时由调用方在代码中搭建场景
+    if (!sceneConfigPath.empty())
+        m_sceneManager->LoadScene(sceneConfigPath, *this);
+    if (headless)
+        return;
+
     m_cameraManager->LoadConfig(cameraConfigPath);
-    m_sceneManager->LoadScene(sceneConfigPath, *this);
     m_particleSystem->LoadEffectLibrary(effectLibPath);
 
     m_renderer->Init(renderView, *this);
@@ -59,28 +67,34 @@ void GameWorld::Reset(const std::string &sceneConfigPath, const std::string &ren
     m_pools.clear();
 
     m_sceneManager->LoadScene(sceneConfigPath, *this);
-    m_renderer->Init(renderView, *this);
+    if (!m_headless)
+        m_renderer->Init(renderView, *this);
     SyncActiveEntities();
 }
 
 void GameWorld::OnDestroy()
 {
+    CancelPhysics();
     for (auto &obj : m_gameObjects)
     {
         obj->SetIsWaitingDestroy(true);
     }
     DestroyWaitingObjects();
+    m_projectileSystem->Clear();
     m_gameObjects.clear();
     m_activateGameObjects.clear();
 
-    m_audioManager->ClearOneShots();
-    m_resourceManager->GameWorldUnloadAll();
+    if (m_audioManager)
+        m_audioManager->ClearOneShots();
+    if (m_resourceManager)
+        m_resourceManager->GameWorldUnloadAll();
 }
 
 GameObject &GameWorld::CreateGameObject()
 {
     auto newObject = std::make_unique<GameObject>(m_nextObjectID++);
     GameObject *rawPtr = newObject.get();
+    rawPtr->SetOwnerWorld(this);
     m_gameObjects.push_back(std::move(newObject));
     return *rawPtr;
 }
@@ -88,50 +102,175 @@ GameObject &GameWorld::CreateGameObject()
 // 返回true表示游戏继续，返回false表示游戏结束
 bool GameWorld::FixedUpdate(float fixedDeltaTime)
 {
+    // 异步模式先完成上一步的物理部分, 发布的姿态作为渲染插值的终点
+    if (m_asyncPhysics)
+    {
+        this->CompletePhysics();
+        this->PublishPoses();
+    }
     m_timeManager->TickGame(fixedDeltaTime);
+    if (!m_asyncPhysics)
+        this->SavePreviousPoses();
 
     m_scriptingSystem->FixedUpdate(*this, fixedDeltaTime);
     this->SyncActiveEntities();
     this->UpdateTransforms();
 
+    // 脚本本步施加的力与冲量留在刚体上, 由待算的物理步消耗
+    if (m_asyncPhysics)
+    {
+        m_physicsPending = true;
+        m_pendingDeltaTime = fixedDeltaTime;
+        return true;
+    }
     m_physicsSystem->Update(*this, fixedDeltaTime);
+    this->FinishPhysicsStep(fixedDeltaTime);
+    return true;
+}
+
+void GameWorld::FinishPhysicsStep(float fixedDeltaTime)
+{
+    m_eventManager->FlushDeferred();
     this->SyncActiveEntities();
     this->UpdateTransforms();
+    // 投射物对本步结束时的碰撞体扫掠
+    m_projectileSystem->Update(*this, fixedDeltaTime);
 
     this->DestroyWaitingObjects();
-    return true;
+}
+
+void GameWorld::SetAsyncPhysics(bool enabled)
+{
+    if (enabled == m_asyncPhysics)
+        return;
+    CompletePhysics();
+    m_asyncPhysics = enabled;
+    if (enabled && !m_physicsWorker)
+        m_physicsWorker = std::make_unique<PhysicsWorker>();
+    // 切换后从当前姿态重新开始插值
+    for (auto *obj : m_activateGameObjects)
+    {
+        if (obj->HasComponent<TransformComponent>())
+            obj->GetComponent<TransformComponent>().SnapInterpolation();
+    }
+    if (__SHOWINFO__)
+        std::cout << "[GameWorld]: Async physics " << (enabled ? "enabled" : "disabled") << std::endl;
+}
+
+void GameWorld::BeginAsyncPhysics()
+{
+    if (!m_physicsPending || m_physicsLaunched)
+        return;
+    m_physicsLaunched = true;
+    m_eventManager->SetDeferred(true);
+    m_renderMatrixLocked = true;
+    const float fixedDeltaTime = m_pendingDeltaTime;
+    m_physicsWorker->Launch([this, fixedDeltaTime]()
+                            { m_physicsSystem->Update(*this, fixedDeltaTime); });
+}
+
+bool GameWorld::IsPhysicsBusy() const
+{
+    return m_physicsLaunched && m_physicsWorker->IsBusy();
+}
+
+void GameWorld::CompletePhysics()
+{
+    if (!m_physicsPending)
+        return;
+    // 屏幕每帧至多推进一步并在绘制前交出, 这里通常只等已在物理线程上的一步.
+    // 直接连续调用 FixedUpdate 或切换模式时上一步还没交出: 同样交给物理线程执行, 保证同一时刻至多一步
+    if (!m_physicsLaunched)
+        this->BeginAsyncPhysics();
+    m_physicsWorker->Wait();
+    m_physicsLaunched = false;
+    m_renderMatrixLocked = false;
+    m_eventManager->SetDeferred(false);
+    m_physicsPending = false;
+    this->FinishPhysicsStep(m_pendingDeltaTime);
+}
+
+void GameWorld::CancelPhysics()
+{
+    if (m_physicsLaunched)
+    {
+        m_physicsWorker->Wait();
+        m_physicsLaunched = false;
+        m_renderMatrixLocked = false;
+        m_eventManager->SetDeferred(false);
+    }
+    m_eventManager->ClearDeferred();
+    m_physicsPending = false;
+    m_deferredUpdateTime = 0.0f;
+}
+
+void GameWorld::PublishPoses()
+{
+    for (auto *obj : m_activateGameObjects)
+    {
+        if (!obj->HasComponent<TransformComponent>())
+            continue;
+        auto &tf = obj->GetComponent<TransformComponent>();
+        if (tf.GetParent() == nullptr)
+            tf.PublishPose();
+    }
 }
 
 bool GameWorld::Update(float DeltaTime, bool sound)
 {
     m_timeManager->Tick();
-    m_timerManager->Update(DeltaTime);
+    // 物理线程仍在计算: 粒子与音频只读渲染姿态, 收包只把数据排进同步队列, 照常更新;
+    // 其余读写刚体与世界姿态, 推迟到物理空闲的一帧
+    if (this->IsPhysicsBusy())
+    {
+        m_deferredUpdateTime += DeltaTime;
+        m_particleSystem->Update(*this, DeltaTime);
+        this->UpdateAudio(sound);
+        if (m_networkClient)
+            m_networkClient->Poll();
+        return true;
+    }
+    // 上一帧交出的物理步已算完, 在这里收尾, 本帧脚本看到完整的一步
+    if (m_physicsLaunched)
+        this->CompletePhysics();
+    // 定时器、脚本与网络同步补上推迟期间的时间
+    const float logicDeltaTime = DeltaTime + m_deferredUpdateTime;
+    m_deferredUpdateTime = 0.0f;
+    m_timerManager->Update(logicDeltaTime);
+    // 先插值, 本帧脚本/相机/粒子看到的渲染姿态与绘制一致; 之后在 Update 中移动的物体直接渲染当前姿态
+    this->InterpolateTransforms();
 
-    m_scriptingSystem->Update(*this, DeltaTime);
+    m_scriptingSystem->Update(*this, logicDeltaTime);
     this->SyncActiveEntities();
 
     m_particleSystem->Update(*this, DeltaTime);
     this->UpdateTransforms();
 
-    mCamera *activeCam = m_cameraManager->GetMainCamera();
-    if (activeCam && sound)
-    {
-        m_audioManager->Update(*this, *activeCam);
-    }
+    this->UpdateAudio(sound);
 
-    m_renderer->Update(*this);
+    if (!m_headless)
+        m_renderer->Update(*this);
 
     // Network: poll incoming packets and sync transforms.
     if (m_networkClient)
     {
         m_networkClient->Poll();
         if (m_networkSyncSystem)
-            m_networkSyncSystem->Update(*this, *m_networkClient, DeltaTime);
+            m_networkSyncSystem->Update(*this, *m_networkClient, logicDeltaTime);
     }
 
     return true;
 }
 
+void GameWorld::UpdateAudio(bool sound)
+{
+    mCamera *activeCam = m_cameraManager->GetMainCamera();
+    if (activeCam && sound && m_audioManager)
+    {
+        m_audioManager->Update(*this, *activeCam);
+    }
+}
+
 void GameWorld::UpdateTransforms()
 {
     for (auto &obj : m_gameObjects)
@@ -146,6 +285,7 @@ void GameWorld::UpdateTransforms()
             UpdateHierarchyLogic(obj.get(), Matrix4f::identity());
         }
     }
+    m_physicsSystem->GetRaycastScene().MarkDirty();
 }
 
 void GameWorld::UpdateHierarchyLogic(GameObject *obj, const Matrix4f &parentWorldMatrix)
@@ -163,6 +303,52 @@ void GameWorld::UpdateHierarchyLogic(GameObject *obj, const Matrix4f &parentWorl
             UpdateHierarchyLogic(child, tf.GetWorldMatrix());
     }
 }
+void GameWorld::SavePreviousPoses()
+{
+    for (auto *obj : m_activateGameObjects)
+    {
+        if (!obj->HasComponent<TransformComponent>())
+            continue;
+        auto &tf = obj->GetComponent<TransformComponent>();
+        if (tf.interpolate && tf.GetParent() == nullptr)
+            tf.SavePreviousPose();
+    }
+}
+
+void GameWorld::InterpolateTransforms()
+{
+    for (auto *obj : m_activateGameObjects)
+    {
+        if (obj->IsWaitingDestroy() || !obj->HasComponent<TransformComponent>())
+            continue;
+        auto &tf = obj->GetComponent<TransformComponent>();
+        if (tf.GetParent() != nullptr)
+            continue;
+        // 异步模式只用发布的姿态, 子物体跟随父物体的渲染矩阵
+        if (m_asyncPhysics)
+        {
+            tf.UpdatePublishedRenderMatrix(m_interpolationAlpha);
+            InterpolateHierarchy(obj, true);
+        }
+        else
+            InterpolateHierarchy(obj, tf.UpdateRenderMatrix(m_interpolationAlpha));
+    }
+}
+
+void GameWorld::InterpolateHierarchy(GameObject *obj, bool interpolated)
+{
+    // 子物体跟随父物体的渲染姿态
+    auto &tf = obj->GetComponent<TransformComponent>();
+    for (auto *child : tf.GetChildren())
+    {
+        if (!child || child->IsWaitingDestroy())
+            continue;
+        auto &childTf = child->GetComponent<TransformComponent>();
+        childTf.SetRenderMatrix(interpolated ? tf.GetRenderMatrix() * childTf.GetLocalMatrix() : childTf.GetWorldMatrix());
+        InterpolateHierarchy(child, interpolated);
+    }
+}
+
 const std::vector<std::unique_ptr<GameObject>> &GameWorld::GetGameObjects() const
 {
     return m_gameObjects;
@@ -171,6 +357,16 @@ const std::vector<GameObject *> &GameWorld::GetActivateGameObjects() const
 {
     return m_activateGameObjects;
 }
+GameObject *GameWorld::FindGameObject(unsigned int id) const
+{
+    // 只在末尾追加且 ID 递增, 删除保持顺序, 因此按 ID 有序
+    auto it = std::lower_bound(m_gameObjects.begin(), m_gameObjects.end(), id,
+                               [](const std::unique_ptr<GameObject> &object, unsigned int value)
+                               { return object->GetID() < value; });
+    if (it == m_gameObjects.end() || (*it)->GetID() != id || (*it)->IsWaitingDestroy())
+        return nullptr;
+    return it->get();
+}
 void GameWorld::DestroyWaitingObjects()
 {
     bool anyObjectDestroyed = false;
@@ -187,6 +383,7 @@ void GameWorld::DestroyWaitingObjects()
     }
     if (anyObjectDestroyed)
     {
+        m_physicsSystem->GetRaycastScene().MarkDirty();
         m_gameObjects.erase(
             std::remove_if(
                 m_gameObjects.begin(),
@@ -196,10 +393,14 @@ void GameWorld::DestroyWaitingObjects()
                     return object && object->IsWaitingDestroy();
                 }),
             m_gameObjects.end());
+        // 已释放的对象立即移出激活列表, 连续多个固定步时下一步开头 (SavePreviousPoses) 不会访问到
+        this->SyncActiveEntities();
     }
 }
 void GameWorld::Render()
 {
+    if (m_headless)
+        return;
     m_renderer->RenderScene(*this, *m_cameraManager);
 }
 
@@ -222,6 +423,8 @@ void GameWorld::NotifyActivateStateChanged(GameObject *obj, bool active)
 }
 void GameWorld::SyncActiveEntities()
 {
+    if (!m_activeChanges.empty())
+        m_physicsSystem->GetRaycastScene().MarkDirty();
     while (!m_activeChanges.empty())
     {
         auto change = m_activeChanges.front();
@@ -230,6 +433,9 @@ void GameWorld::SyncActiveEntities()
         bool currentlyInList = (it != m_activateGameObjects.end());
         if (change.newState && !currentlyInList)
         {
+            // 重新激活 (如对象池取出) 的物体通常刚被移动, 不从旧位置插值
+            if (change.obj->HasComponent<TransformComponent>())
+                change.obj->GetComponent<TransformComponent>().SnapInterpolation();
             m_activateGameObjects.push_back(change.obj);
         }
         else if (!change.newState && currentlyInList)
@@ -17,6 +17,7 @@
 
 class ScriptingFactory;
 class ScriptingSystem;
+class PhysicsWorker;
 
 class GameWorld
 {
@@ -35,14 +36,38 @@ public:
                const std::string &renderView = "assets/view/test_view.json");
 
     void OnDestroy();
+    // 无窗口运行 (基准测试/服务端), resourceManager 与 audioManager 可为空
+    bool IsHeadless() const { return m_headless; }
 
     GameObject &CreateGameObject();
     bool FixedUpdate(float fexedDeltaTime);
+    // 异步物理步进行中只更新不读写刚体与世界姿态的部分 (粒子、音频、网络收包),
+    // 定时器、脚本与网络同步推迟到物理空闲的一帧, 并补上推迟期间的时间
     bool Update(float deltaTime, bool sound = true);
     void Render();
     void UpdateTransforms();
+    // 渲染插值系数 = 累积器剩余时间 / 固定步长, 由屏幕在每帧固定步之后设置; 1 表示不插值
+    void SetInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
+    float GetInterpolationAlpha() const { return m_interpolationAlpha; }
+    // 计算各物体本帧的渲染矩阵
+    void InterpolateTransforms();
+
+    // 异步物理: 固定步中的物理部分推迟, 由屏幕在绘制前交给物理线程, 与绘制并行;
+    // 下一次 FixedUpdate/Update 开始时收尾 (分发碰撞事件, 投射物, 销毁). 渲染在最近两次发布的姿态间插值, 比同步模式晚一步
+    void SetAsyncPhysics(bool enabled);
+    bool IsAsyncPhysics() const { return m_asyncPhysics; }
+    // 把待算的物理步交给物理线程, 没有待算步时什么也不做
+    void BeginAsyncPhysics();
+    // 物理线程仍在计算; 此时主线程只能读渲染矩阵, 不能读写刚体与世界姿态
+    bool IsPhysicsBusy() const;
+    // 等待待算的物理步并收尾; 还未交出时先交给物理线程
+    void CompletePhysics();
+    // 本世界的物理步在物理线程上时为 true, 此时写世界矩阵不同步渲染矩阵
+    bool IsRenderMatrixLocked() const { return m_renderMatrixLocked; }
 
     const std::vector<std::unique_ptr<GameObject>> &GetGameObjects() const;
+    // 按 ID 查找, 已销毁时返回 nullptr
+    GameObject *FindGameObject(unsigned int id) const;
     const std::vector<GameObject *> &GetActivateGameObjects() const;
 
     PhysicsStageFactory &GetPhysicsStageFactory() { return *m_physicsStageFactory; };
@@ -63,6 +88,7 @@ public:
 
     ParticleFactory &GetParticleFactory() { return *m_particleFactory; };
     ParticleSystem &GetParticleSystem() { return *m_particleSystem; };
+    ProjectileSystem &GetProjectileSystem() { return *m_projectileSystem; };
     AudioManager &GetAudioManager() { return *m_audioManager; }
 
     NetworkClient &GetNetworkClient() { return *m_networkClient; }
@@ -108,7 +134,15 @@ public:
 
 private:
     void UpdateHierarchyLogic(GameObject *obj, const Matrix4f &parentWorldMatrix);
+    void SavePreviousPoses();
+    void InterpolateHierarchy(GameObject *obj, bool interpolated);
     void DestroyWaitingObjects();
+    // 物理步之后的收尾, 同步与异步模式共用
+    void FinishPhysicsStep(float fixedDeltaTime);
+    void PublishPoses();
+    void UpdateAudio(bool sound);
+    // 丢弃未收尾的异步物理步 (销毁/重置场景时)
+    void CancelPhysics();
 
     std::unique_ptr<TimeManager> m_timeManager;
     std::unique_ptr<TimerManager> m_timerManager;
@@ -135,6 +169,7 @@ private:
 
     std::unique_ptr<ParticleFactory> m_particleFactory;
     std::unique_ptr<ParticleSystem> m_particleSystem;
+    std::unique_ptr<ProjectileSystem> m_projectileSystem;
 
     std::shared_ptr<NetworkClient> m_networkClient;
     std::unique_ptr<NetworkSyncSystem> m_networkSyncSystem;
@@ -148,4 +183,16 @@ private:
     std::unordered_map<std::string, std::unique_ptr<GameObjectPool>> m_pools;
 
     AudioManager *m_audioManager;
+    bool m_headless = false;
+    float m_interpolationAlpha = 1.0f;
+
+    std::unique_ptr<PhysicsWorker> m_physicsWorker;
+    bool m_asyncPhysics = false;
+    bool m_physicsPending = false;  // 已跑完固定步前半段, 物理部分待算
+    bool m_physicsLaunched = false; // 待算步已交给物理线程
+    // 只在交出前与等待后由主线程写, 物理线程运行期间只读
+    bool m_renderMatrixLocked = false;
+    float m_pendingDeltaTime = 0.0f;
+    // 物理线程忙时推迟的 Update 时间, 下一次完整 Update 补上
+    float m_deferredUpdateTime = 0.0f;
 };
\ No newline at end of file
@@ -110,8 +110,8 @@ void mCamera::UpdateFromDirection(Vector3f pos, Vector3f dir, Vector3f u, const
     if (m_mountTarget != nullptr)
     {
         auto &tf = m_mountTarget->GetComponent<TransformComponent>();
-        Matrix4f mountTarWorldMat = tf.GetWorldMatrix();
-        Quat4f worldRot = tf.GetWorldRotation();
+        Matrix4f mountTarWorldMat = tf.GetRenderMatrix();
+        Quat4f worldRot = tf.GetRenderRotation();
         m_position = (mountTarWorldMat * Vector4f(m_localPositionOffset, 1.0f)).xyz();
         m_direction = (worldRot * m_localDirection).Normalized();
         m_up = (worldRot * m_localUp).Normalized();
@@ -138,12 +138,12 @@ void mCamera::UpdateFromTarget(Vector3f pos, Vector3f tar, Vector3f u, const Cam
     if (m_mountTarget != nullptr)
     {
         auto &tf = m_mountTarget->GetComponent<TransformComponent>();
-        Matrix4f mountTarWorldMat = tf.GetWorldMatrix();
+        Matrix4f mountTarWorldMat = tf.GetRenderMatrix();
         m_position = (mountTarWorldMat * Vector4f(m_localPositionOffset, 1)).xyz();
 
         m_target = tar;
         m_direction = (m_target - m_position).Normalized();
-        Quat4f worldRot = tf.GetWorldRotation();
+        Quat4f worldRot = tf.GetRenderRotation();
         m_up = worldRot * (m_localUp);
         m_right = (m_direction ^ m_up).Normalized();
         m_up = (m_right ^ m_direction).Normalized();
@@ -167,9 +167,9 @@ void mCamera::UpdateFixed(Vector3f dir, Vector3f u, const CameraMode &mode)
         return;
     }
     auto &tf = m_mountTarget->GetComponent<TransformComponent>();
-    Matrix4f mountTarWorldMat = tf.GetWorldMatrix();
+    Matrix4f mountTarWorldMat = tf.GetRenderMatrix();
     m_position = (mountTarWorldMat * Vector4f(m_localPositionOffset, 1)).xyz();
-    Quat4f worldRot = tf.GetWorldRotation();
+    Quat4f worldRot = tf.GetRenderRotation();
     m_direction = (worldRot * dir).Normalized();
     m_up = (worldRot * u).Normalized();
     m_right = (m_direction ^ m_up).Normalized();
@@ -211,7 +211,7 @@ void mCamera::SetMountTarget(GameObject *target)
 {
     m_mountTarget = target;
     auto &tf = m_mountTarget->GetComponent<TransformComponent>();
-    Matrix4f mountTarWorldMat = tf.GetWorldMatrix();
+    Matrix4f mountTarWorldMat = tf.GetRenderMatrix();
     m_direction = (mountTarWorldMat * Vector4f(m_localDirection, 0)).xyz().Normalized();
     m_up = (mountTarWorldMat * Vector4f(m_localUp, 0)).xyz().Normalized();
     m_right = (m_direction ^ m_up).Normalized();
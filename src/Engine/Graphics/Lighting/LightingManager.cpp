@@ -59,11 +59,11 @@ void LightingManager::Update(GameWorld &world)
 
         LightInfo info;
         info.data = &light;
-        info.worldPosition = tf.GetWorldPosition();
+        info.worldPosition = tf.GetRenderPosition();
         info.shadowIndex = -1;
 
         if (light.type == LightType::Directional)
-            info.worldDirection = tf.GetWorldRotation() * (light.direction).Normalized();
+            info.worldDirection = tf.GetRenderRotation() * (light.direction).Normalized();
         else
             info.worldDirection = light.direction;
 
@@ -102,6 +102,12 @@ void LightingManager::Update(GameWorld &world)
     }
 }
 void LightingManager::UploadToShader(std::shared_ptr<ShaderWrapper> shader, const Vector3f &viewPos, int texUnit)
+{
+    UploadLights(shader, viewPos);
+    BindShadowMaps(shader, texUnit);
+}
+
+void LightingManager::UploadLights(std::shared_ptr<ShaderWrapper> shader, const Vector3f &viewPos)
 {
     if (!shader || !shader->IsValid())
         return;
@@ -126,14 +132,20 @@ void LightingManager::UploadToShader(std::shared_ptr<ShaderWrapper> shader, cons
         }
     }
 
+    for (size_t i = 0; i < m_activeCasters.size(); ++i)
+        shader->SetMat4("lightVPs[" + std::to_string(i) + "]", m_activeCasters[i].lightVP);
+}
+
+void LightingManager::BindShadowMaps(std::shared_ptr<ShaderWrapper> shader, int texUnit)
+{
+    if (!shader || !shader->IsValid())
+        return;
+
     // 避开材质贴图
     int shadowUnitBase = texUnit + 1;
     for (int i = 0; i < m_activeCasters.size(); ++i)
     {
-        std::string baseVP = "lightVPs[" + std::to_string(i) + "]";
         std::string baseMap = "shadowMaps[" + std::to_string(i) + "]";
-
-        shader->SetMat4(baseVP, m_activeCasters[i].lightVP);
         shader->SetTexture(baseMap, m_shadowMaps[m_activeCasters[i].textureIndex].depth, shadowUnitBase + i);
     }
 
@@ -244,7 +256,7 @@ void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerP
             auto &tf = obj->GetComponent<TransformComponent>();
             if (!render.castShadows)
                 continue;
-            Matrix4f modelMat = tf.GetWorldMatrix();
+            Matrix4f modelMat = tf.GetRenderMatrix();
             m_depthShader->SetMat4("model", modelMat);
 
             for (int i = 0; i < render.model.meshCount; i++)
@@ -276,7 +288,7 @@ void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerP
             auto &caster = m_activePointCasters[i];
             PointShadowMap &psm = m_pointShadowMaps[i];
 
-            Vector3 lightPos = caster.light->owner->GetComponent<TransformComponent>().GetWorldPosition();
+            Vector3 lightPos = caster.light->owner->GetComponent<TransformComponent>().GetRenderPosition();
             float farPlane = caster.light->range;
 
             glViewport(0, 0, psm.resolution, psm.resolution);
@@ -314,7 +326,7 @@ void LightingManager::RenderShadowMaps(GameWorld &world, const Vector3f &centerP
                         auto &tf = obj->GetComponent<TransformComponent>();
                         if (!render.castShadows || obj == caster.owner)
                             continue;
-                        Matrix4f modelMat = tf.GetWorldMatrix();
+                        Matrix4f modelMat = tf.GetRenderMatrix();
 
                         m_pointDepthShader->SetMat4("model", modelMat);
 
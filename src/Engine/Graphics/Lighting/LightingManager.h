@@ -14,6 +14,10 @@ public:
     ~LightingManager();
     void Update(GameWorld &world);
     void UploadToShader(std::shared_ptr<ShaderWrapper> shader, const Vector3f &viewPos, int texUnit);
+    // UploadToShader 的两部分: 灯光 uniform 在同一 shader 连续绘制时只需上传一次,
+    // 阴影贴图的纹理单元跟在材质贴图之后, 每次绘制都要重新绑定
+    void UploadLights(std::shared_ptr<ShaderWrapper> shader, const Vector3f &viewPos);
+    void BindShadowMaps(std::shared_ptr<ShaderWrapper> shader, int texUnit);
 
     void InitShadowMaps(int width, int height, ResourceManager &rm);
     void RenderShadowMaps(GameWorld &world, const Vector3f &centerPos);
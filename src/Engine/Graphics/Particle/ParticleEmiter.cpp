@@ -1,5 +1,6 @@
 #include "ParticleEmitter.h"
 #include "Engine/Core/GameWorld.h"
+#include "Engine/Math/Batch/BatchTransform.h"
 #include <nlohmann/json.hpp>
 #include <memory>
 #include <vector>
@@ -112,16 +113,17 @@ void ParticleEmitter::Spawn(int spawnCounts, const TransformComponent &ownerTf,
     for (auto &init : m_initializers)
         init->Initialize(m_spawnBuffer, 0, spawnCounts);
 
-    // 随体系世界系处理
-    if (simSpace == SimulationSpace::WORLD)
+    // 随体系世界系处理, 从插值后的渲染姿态发射, 与发射体的绘制位置一致
+    // 整批共用一个变换, 按 GPUParticle 跨步原地改写各字段
+    if (simSpace == SimulationSpace::WORLD && !m_spawnBuffer.empty())
     {
-        for (auto &particle : m_spawnBuffer)
-        {
-
-            particle.position = (ownerTf.GetWorldRotation() * (particle.position & ownerTf.GetWorldScale())) + ownerTf.GetWorldPosition();
-            particle.velocity = ownerTf.GetWorldRotation() * particle.velocity;
-            particle.acceleration = ownerTf.GetWorldRotation() * particle.acceleration;
-        }
+        const Matrix4f transform = Matrix4f::CreateTransform(ownerTf.GetRenderPosition(), ownerTf.GetRenderRotation(), ownerTf.GetRenderScale());
+        const Matrix4f rotation = Matrix4f::rotation(ownerTf.GetRenderRotation());
+        const size_t stride = sizeof(GPUParticle);
+        GPUParticle *particles = m_spawnBuffer.data();
+        BatchTransform::TransformPoints(transform, &particles->position, &particles->position, m_spawnBuffer.size(), stride, stride);
+        BatchTransform::TransformDirections(rotation, &particles->velocity, &particles->velocity, m_spawnBuffer.size(), stride, stride);
+        BatchTransform::TransformDirections(rotation, &particles->acceleration, &particles->acceleration, m_spawnBuffer.size(), stride, stride);
     }
 
     // 写入GPU
@@ -363,7 +365,7 @@ Matrix4f ParticleEmitter::GetRenderMatrix(const TransformComponent &parentTf) co
     if (simSpace == SimulationSpace::WORLD)
         return Matrix4f::identity();
     else
-        return parentTf.GetLocalMatrix(); // local space
+        return parentTf.GetRenderMatrix(); // local space
 }
 
 unsigned int ParticleEmitter::GetDataTextureID() const
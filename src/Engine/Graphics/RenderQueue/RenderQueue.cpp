@@ -0,0 +1,127 @@
+#include "RenderQueue.h"
+#include "Engine/Graphics/RenderMaterial.h"
+#include <algorithm>
+
+namespace
+{
+    constexpr uint64_t Mask(int bits) { return (uint64_t(1) << bits) - 1; }
+
+    uint32_t Clamp(uint32_t value, int bits) { return (uint32_t)std::min<uint64_t>(value, Mask(bits)); }
+
+    // 先查找再插入, 已有的键不产生分配
+    template <typename K, typename M>
+    uint32_t Intern(M &ids, const K &key)
+    {
+        auto it = ids.find(key);
+        if (it != ids.end())
+            return it->second;
+        const uint32_t id = (uint32_t)ids.size();
+        ids.emplace(key, id);
+        return id;
+    }
+}
+
+uint64_t RenderSortKey::Encode(const Fields &fields)
+{
+    uint64_t key = Clamp(fields.view, VIEW_BITS);
+    key = (key << RT_BITS) | Clamp(fields.rt, RT_BITS);
+    key = (key << 1) | (fields.transparent ? 1u : 0u);
+
+    const uint64_t pass = Clamp(fields.pass, PASS_BITS);
+    const uint64_t shader = Clamp(fields.shader, SHADER_BITS);
+    const uint64_t material = Clamp(fields.material, MATERIAL_BITS);
+    const uint64_t mesh = Clamp(fields.mesh, MESH_BITS);
+    const uint64_t depth = Clamp(fields.depth, DEPTH_BITS);
+    if (!fields.transparent)
+    {
+        // 按状态合批, 同状态内由近到远减少过度绘制
+        key = (key << PASS_BITS) | pass;
+        key = (key << SHADER_BITS) | shader;
+        key = (key << MATERIAL_BITS) | material;
+        key = (key << MESH_BITS) | mesh;
+        key = (key << DEPTH_BITS) | depth;
+    }
+    else
+    {
+        // 混合结果依赖顺序, 深度优先且由远到近
+        key = (key << DEPTH_BITS) | (Mask(DEPTH_BITS) - depth);
+        key = (key << PASS_BITS) | pass;
+        key = (key << SHADER_BITS) | shader;
+        key = (key << MATERIAL_BITS) | material;
+        key = (key << MESH_BITS) | mesh;
+    }
+    return key;
+}
+
+RenderSortKey::Fields RenderSortKey::Decode(uint64_t key)
+{
+    Fields fields;
+    auto take = [&key](int bits)
+    {
+        const uint32_t value = (uint32_t)(key & Mask(bits));
+        key >>= bits;
+        return value;
+    };
+    const bool transparent = ((key >> (64 - VIEW_BITS - RT_BITS - 1)) & 1) != 0;
+    if (!transparent)
+    {
+        fields.depth = take(DEPTH_BITS);
+        fields.mesh = take(MESH_BITS);
+        fields.material = take(MATERIAL_BITS);
+        fields.shader = take(SHADER_BITS);
+        fields.pass = take(PASS_BITS);
+    }
+    else
+    {
+        fields.mesh = take(MESH_BITS);
+        fields.material = take(MATERIAL_BITS);
+        fields.shader = take(SHADER_BITS);
+        fields.pass = take(PASS_BITS);
+        fields.depth = (uint32_t)Mask(DEPTH_BITS) - take(DEPTH_BITS);
+    }
+    fields.transparent = take(1) != 0;
+    fields.rt = take(RT_BITS);
+    fields.view = take(VIEW_BITS);
+    return fields;
+}
+
+uint32_t RenderSortKey::QuantizeDepth(float depth, float maxDepth)
+{
+    if (!(maxDepth > 0.0f) || !(depth > 0.0f))
+        return 0;
+    const float t = std::min(depth / maxDepth, 1.0f);
+    return (uint32_t)(t * (float)Mask(DEPTH_BITS));
+}
+
+void RenderQueue::Clear()
+{
+    m_entries.clear();
+    m_items.clear();
+    m_shaderIds.clear();
+    m_materialIds.clear();
+    m_meshIds.clear();
+    m_rtIds.clear();
+}
+
+void RenderQueue::Push(const RenderItem &item, uint32_t view, uint32_t pass, float depth, float maxDepth)
+{
+    const RenderMaterial &material = *item.material;
+    RenderSortKey::Fields fields;
+    fields.view = view;
+    fields.rt = Intern(m_rtIds, material.outputRT);
+    fields.transparent = material.blendMode != BLEND_OPIQUE;
+    fields.pass = pass;
+    fields.shader = Intern(m_shaderIds, (const void *)material.shader.get());
+    fields.material = Intern(m_materialIds, (const void *)item.material);
+    fields.mesh = Intern(m_meshIds, (const void *)item.mesh);
+    fields.depth = RenderSortKey::QuantizeDepth(depth, maxDepth);
+
+    m_entries.push_back({RenderSortKey::Encode(fields), (uint32_t)m_items.size()});
+    m_items.push_back(item);
+}
+
+void RenderQueue::Sort()
+{
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry &a, const Entry &b)
+              { return a.key != b.key ? a.key < b.key : a.index < b.index; });
+}
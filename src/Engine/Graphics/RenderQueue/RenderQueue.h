@@ -0,0 +1,96 @@
+#pragma once
+#include "Engine/Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct Mesh;
+struct Model;
+struct RenderMaterial;
+
+// 64 位排序键, 从高到低:
+//   不透明: view(4) | RT(4) | 0 | pass(3) | shader(10) | material(12) | mesh(12) | depth(18, 由近到远)
+//   透明:   view(4) | RT(4) | 1 | depth(18, 由远到近) | pass(3) | shader(10) | material(12) | mesh(12)
+// pass 为网格上第几个 pass, 保证同一网格的多 pass 仍按配置顺序绘制
+// shader / material / mesh / RT 为本帧内按首次出现分配的紧凑编号, 超出位宽时截断 (只影响合批, 不影响正确性)
+namespace RenderSortKey
+{
+    constexpr int VIEW_BITS = 4;
+    constexpr int RT_BITS = 4;
+    constexpr int PASS_BITS = 3;
+    constexpr int SHADER_BITS = 10;
+    constexpr int MATERIAL_BITS = 12;
+    constexpr int MESH_BITS = 12;
+    constexpr int DEPTH_BITS = 18;
+    static_assert(VIEW_BITS + RT_BITS + 1 + PASS_BITS + SHADER_BITS + MATERIAL_BITS + MESH_BITS + DEPTH_BITS == 64, "sort key must fill 64 bits");
+
+    struct Fields
+    {
+        uint32_t view = 0;
+        uint32_t rt = 0;
+        bool transparent = false;
+        uint32_t pass = 0;
+        uint32_t shader = 0;
+        uint32_t material = 0;
+        uint32_t mesh = 0;
+        uint32_t depth = 0; // 已量化的视线深度, 越小越近
+    };
+
+    uint64_t Encode(const Fields &fields);
+    Fields Decode(uint64_t key);
+    // 视线深度 [0, maxDepth] 量化到 DEPTH_BITS
+    uint32_t QuantizeDepth(float depth, float maxDepth);
+}
+
+// 一次绘制所需的全部数据, 指针在本帧内有效
+struct RenderItem
+{
+    const Mesh *mesh = nullptr;
+    const Model *model = nullptr;
+    int meshIndex = 0;
+    const RenderMaterial *material = nullptr;
+    Matrix4f transform;
+    Vector4f totalBaseColor;
+};
+
+// 每帧计数
+struct RenderStats
+{
+    size_t items = 0;        // 入队的绘制项
+    size_t draws = 0;        // 实际的 DrawMesh 次数
+    size_t shaderBinds = 0;  // shader 切换次数
+    size_t stateChanges = 0; // 混合 / 深度 / 剔除状态的实际改变次数
+    void Reset() { *this = RenderStats(); }
+};
+
+// 可见性遍历产生 RenderItem, 排序后按顺序提交; 构建与排序不涉及 GL
+class RenderQueue
+{
+public:
+    void Clear();
+    // depth 为物体到相机的视线距离, maxDepth 通常为远平面
+    void Push(const RenderItem &item, uint32_t view, uint32_t pass, float depth, float maxDepth);
+    void Sort();
+
+    size_t Size() const { return m_entries.size(); }
+    bool Empty() const { return m_entries.empty(); }
+    // 排序后第 i 项
+    const RenderItem &At(size_t i) const { return m_items[m_entries[i].index]; }
+    uint64_t KeyAt(size_t i) const { return m_entries[i].key; }
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        uint32_t index; // 入队顺序, 键相同时保持原顺序
+    };
+    std::vector<Entry> m_entries;
+    std::vector<RenderItem> m_items;
+
+    std::unordered_map<const void *, uint32_t> m_shaderIds;
+    std::unordered_map<const void *, uint32_t> m_materialIds;
+    std::unordered_map<const void *, uint32_t> m_meshIds;
+    std::unordered_map<std::string, uint32_t> m_rtIds;
+};
@@ -107,6 +107,7 @@ void Renderer::RawRenderScene(GameWorld &gameWorld, CameraManager &cameraManager
         glClear(GL_DEPTH_BUFFER_BIT);
 
         // ClearBackground(BLUE);
+        uint32_t viewId = 0;
         for (const auto &view : m_renderViewer->GetRenderViews())
         {
             if (!view.enable)
@@ -160,7 +161,8 @@ void Renderer::RawRenderScene(GameWorld &gameWorld, CameraManager &cameraManager
                     m_skybox->Draw(rawCamera, aspect);
                 }
 
-                DrawWorldObjects(gameWorld, rawCamera, *camera, aspect);
+                DrawWorldObjects(gameWorld, rawCamera, *camera, aspect, viewId++);
+                gameWorld.GetProjectileSystem().Render(gameWorld.GetInterpolationAlpha());
 
                 // debug
                 for (const auto &view1 : m_renderViewer->GetRenderViews())
@@ -261,6 +263,7 @@ void Renderer::RawRenderParticle(GameWorld &gameWorld, CameraManager &cameraMana
 
 void Renderer::RenderScene(GameWorld &gameWorld, CameraManager &cameraManager)
 {
+    m_renderStats.Reset();
     // RT图出入口
     auto &m_RTPool = m_postProcesser->GetRTPool();
     for (auto &[name, rt] : m_RTPool)
@@ -316,7 +319,7 @@ void Renderer::RenderScene(GameWorld &gameWorld, CameraManager &cameraManager)
                    {0, 0}, 0, WHITE);
 }
 
-void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &camera, float aspect)
+void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &camera, float aspect, uint32_t viewId)
 {
     Matrix4f matView = GetCameraMatrix(rawCamera);
     Matrix4f matProj;
@@ -333,6 +336,14 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
     Matrix4f VP = matProj * matView;
     Frustum frustum;
     frustum.Extract(VP);
+    // 速度在异步物理步进行中不可读, 这一帧不画速度箭头
+    const bool physicsBusy = world.IsPhysicsBusy();
+    const Vector3f cameraPos = camera.Position();
+    const Vector3f cameraDir = camera.getDirection();
+    const float farPlane = camera.getFarPlane();
+
+    // 可见性遍历: 带 shader 的 pass 入队, 排序后统一提交
+    m_renderQueue.Clear();
     for (const auto *gameObject : world.GetActivateGameObjects())
     {
         if (gameObject->HasComponent<TransformComponent>() && gameObject->HasComponent<RenderComponent>())
@@ -344,26 +355,28 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
             const auto &tf = gameObject->GetComponent<TransformComponent>();
             const auto &render = gameObject->GetComponent<RenderComponent>();
 
+            // 绘制插值后的渲染姿态
+            const Vector3f position = tf.GetRenderPosition();
+            const Vector3f scale = tf.GetRenderScale();
             float angle = 0.0f;
-            Quat4f rotation = tf.GetWorldRotation();
+            Quat4f rotation = tf.GetRenderRotation();
             Vector3f axis = rotation.getAxisAngle(&angle);
             angle *= (float)180.0f / (float)M_PI;
 
             bool useShader = (render.defaultMaterial.shader != nullptr && render.defaultMaterial.shader->IsValid());
             if (useShader)
             {
-
-                Matrix4f S = Matrix4f(Matrix3f(tf.GetWorldScale() & render.scale));
-                Matrix4f R = Matrix4f(tf.GetWorldRotation().toMatrix());
-                Matrix4f T = Matrix4f::translation(tf.GetWorldPosition());
-                Matrix4f M = T * R * S;
-
-                Matrix4f MVP = VP * M;
+                RenderItem item;
+                item.model = &render.model;
+                item.transform = Matrix4f::CreateTransform(position, rotation, scale & render.scale);
+                item.totalBaseColor = render.totalBaseColor;
+                const float depth = (((worldAABB.min + worldAABB.max) * 0.5f) - cameraPos) * cameraDir;
 
                 // 同模型各个mesh的passes
                 for (int i = 0; i < render.model.meshCount; i++)
                 {
-                    Mesh &mesh = render.model.meshes[i];
+                    item.mesh = &render.model.meshes[i];
+                    item.meshIndex = i;
                     const std::vector<RenderMaterial> *passes = nullptr;
                     auto it = render.meshPasses.find(i);
                     if (it != render.meshPasses.end())
@@ -376,13 +389,16 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
                         for (size_t p = 0; p < passes->size(); p++)
                         {
                             const RenderMaterial &pass = (*passes)[p];
-
-                            RenderSinglePass(mesh, render.model, i, pass, matProj, matView, MVP, M, camera, world, render.totalBaseColor);
+                            if (pass.shader == nullptr || !pass.shader->IsValid())
+                                continue;
+                            item.material = &pass;
+                            m_renderQueue.Push(item, viewId, (uint32_t)p, depth, farPlane);
                         }
                     }
                     else
                     {
-                        RenderSinglePass(mesh, render.model, i, render.defaultMaterial, matProj, matView, MVP, M, camera, world, render.totalBaseColor);
+                        item.material = &render.defaultMaterial;
+                        m_renderQueue.Push(item, viewId, 0, depth, farPlane);
                     }
                 }
             }
@@ -391,149 +407,154 @@ void Renderer::DrawWorldObjects(GameWorld &world, Camera3D &rawCamera, mCamera &
                 Color tint = {(unsigned char)render.defaultMaterial.baseColor.x(), (unsigned char)render.defaultMaterial.baseColor.y(), (unsigned char)render.defaultMaterial.baseColor.z(), (unsigned char)render.defaultMaterial.baseColor.w()};
                 DrawModelEx(
                     render.model,
-                    tf.GetWorldPosition(),
+                    position,
                     axis,
                     angle,
-                    tf.GetWorldScale() & render.scale,
+                    scale & render.scale,
                     tint);
+                m_renderStats.draws++;
             }
             if (render.showWires)
                 DrawModelWiresEx(
                     render.model,
-                    tf.GetWorldPosition(),
+                    position,
                     axis,
                     angle,
-                    tf.GetWorldScale() & render.scale,
+                    scale & render.scale,
                     BLACK);
 
             if (render.showAxes)
-                DrawCoordinateAxes(tf.GetWorldPosition(), tf.GetWorldRotation(), 2.0f, 0.05f);
+                DrawCoordinateAxes(position, rotation, 2.0f, 0.05f);
             if (render.showCenter)
-                DrawSphereEx(tf.GetWorldPosition(), 0.1f, 8, 8, RED);
-            if (render.showAngVol && gameObject->HasComponent<RigidbodyComponent>())
+                DrawSphereEx(position, 0.1f, 8, 8, RED);
+            if (render.showAngVol && !physicsBusy && gameObject->HasComponent<RigidbodyComponent>())
             {
                 const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-                DrawVector(tf.GetWorldPosition(), rb.angularVelocity, 1.0f, 0.05f);
+                DrawVector(position, rb.angularVelocity, 1.0f, 0.05f);
             }
-            if (render.showVol && gameObject->HasComponent<RigidbodyComponent>())
+            if (render.showVol && !physicsBusy && gameObject->HasComponent<RigidbodyComponent>())
             {
                 const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-                DrawVector(tf.GetWorldPosition(), rb.velocity, 1.0f, 0.05f);
+                DrawVector(position, rb.velocity, 1.0f, 0.05f);
             }
         }
     }
+    m_renderQueue.Sort();
+    SubmitRenderQueue(matProj, matView, VP, camera, world);
     // debug
     // DrawGrid(20, 10.0f);
 
     // DrawCoordinateAxes(Vector3f(0.0f), Quat4f::IDENTITY, 2.0f, 0.05f);
 }
 
-void Renderer::RenderSinglePass(const Mesh &mesh, const Model &model, const int &meshIdx, const RenderMaterial &pass,
-                                const Matrix4f &matProj, const Matrix4f &matView, const Matrix4f &MVP, const Matrix4f &M, const mCamera &camera, GameWorld &gameWorld, const Vector4f &totalBaseColor)
+namespace
 {
-    rlDrawRenderBatchActive();
-
-    rlEnableDepthTest();
-    rlEnableDepthMask();
-    rlDisableBackfaceCulling();
-    rlSetCullFace(RL_CULL_FACE_BACK);
-    rlEnableColorBlend();
-    float gameTime = gameWorld.GetTimeManager().GetGameTime();
-    float realTime = gameWorld.GetTimeManager().GetRealTime();
-
-    if (pass.shader != nullptr && pass.shader->IsValid())
+    void ApplyBlendMode(int blendMode)
     {
-        int matIdex = model.meshMaterial[meshIdx];
-        Material tempRaylibMaterial = model.materials[matIdex];
-
-        pass.shader->Begin();
-
-        switch (pass.blendMode)
+        switch (blendMode)
         {
         case BLEND_OPIQUE:
             rlDisableColorBlend();
-            break;
+            return;
         case BLEND_MULTIPLIED:
-            rlSetBlendMode(BLEND_CUSTOM);
+            // rlSetBlendMode 按当前记录的因子生效, 先设因子
             rlSetBlendFactors(RL_DST_COLOR, RL_ZERO, RL_FUNC_ADD);
+            rlSetBlendMode(BLEND_CUSTOM);
             break;
         case BLEND_SCREEN:
-            rlSetBlendMode(BLEND_CUSTOM);
             rlSetBlendFactors(RL_ONE, RL_ONE_MINUS_SRC_COLOR, RL_FUNC_ADD);
+            rlSetBlendMode(BLEND_CUSTOM);
             break;
         case BLEND_SUBTRACT:
-            rlSetBlendMode(BLEND_CUSTOM);
             rlSetBlendFactors(RL_ONE, RL_ONE, RL_FUNC_REVERSE_SUBTRACT);
+            rlSetBlendMode(BLEND_CUSTOM);
             break;
         default:
-            BeginBlendMode(pass.blendMode);
+            rlSetBlendMode(blendMode);
             break;
         }
+        rlEnableColorBlend();
+    }
+}
+
+void Renderer::SubmitRenderQueue(const Matrix4f &matProj, const Matrix4f &matView, const Matrix4f &VP, const mCamera &camera, GameWorld &gameWorld)
+{
+    m_renderStats.items += m_renderQueue.Size();
+    if (m_renderQueue.Empty())
+        return;
 
-        pass.shader->SetAll(MVP, M, camera.Position(), realTime, gameTime, pass.baseColor, pass.customFloats, pass.customVector2, pass.customVector3, pass.customVector4);
-        pass.shader->SetVec4("totalBaseColor", totalBaseColor / 255.0f);
-        pass.shader->SetMat4("matProj", matProj);
-        pass.shader->SetMat4("matView", matView);
+    // 先画掉批处理里的调试图元, 之后的状态改变不会影响它们
+    rlDrawRenderBatchActive();
 
-        pass.shader->SetVec3("emissiveColor", pass.emissiveColor / 255.0f);
-        pass.shader->SetFloat("emissiveIntensity", pass.emissiveIntensity);
+    const float gameTime = gameWorld.GetTimeManager().GetGameTime();
+    const float realTime = gameWorld.GetTimeManager().GetRealTime();
+    const Vector3f viewPos = camera.Position();
+
+    // 与上一项比较, 只改变不同的状态
+    const ShaderWrapper *boundShader = nullptr;
+    PassState state;
+    bool hasState = false;
+    for (size_t i = 0; i < m_renderQueue.Size(); i++)
+    {
+        const RenderItem &item = m_renderQueue.At(i);
+        const RenderMaterial &pass = *item.material;
 
-        int texUnit = 1;
-        if (pass.useDiffuseMap)
+        if (pass.shader.get() != boundShader)
         {
-            pass.shader->SetTexture("u_diffuseMap", pass.diffuseMap, texUnit);
-            if (pass.diffuseIsAnimated)
-            {
-                pass.shader->SetInt("u_diffuseMap_frameCount", pass.diffuseframeCount);
-                pass.shader->SetFloat("u_diffuseMap_animSpeed", pass.diffuseanimSpeed);
-            }
-            else
-            {
-                pass.shader->SetInt("u_diffuseMap_frameCount", 1);
-                pass.shader->SetFloat("u_diffuseMap_animSpeed", 0.0f);
-            }
-            tempRaylibMaterial.maps[MATERIAL_MAP_DIFFUSE].texture = pass.diffuseMap;
-            texUnit++;
+            boundShader = pass.shader.get();
+            pass.shader->Begin();
+            // 同一视图内对所有绘制都相同的 uniform, 每个 shader 上传一次
+            pass.shader->SetMat4("matProj", matProj);
+            pass.shader->SetMat4("matView", matView);
+            m_lightingManager->UploadLights(pass.shader, viewPos);
+            m_renderStats.shaderBinds++;
         }
 
-        pass.shader->SetCubeMap("skyboxMap", m_skybox->GetTexture(), texUnit);
-        texUnit++;
-
-        for (auto const &[name, text] : pass.customTextures)
+        if (!hasState || pass.blendMode != state.blendMode)
         {
-            pass.shader->SetTexture(name, text, texUnit);
-            if (pass.isAnimated.at(name))
-            {
-                pass.shader->SetInt(name + "_frameCount", pass.frameCount.at(name));
-                pass.shader->SetFloat(name + "_animSpeed", pass.animSpeed.at(name));
-            }
+            ApplyBlendMode(pass.blendMode);
+            state.blendMode = pass.blendMode;
+            m_renderStats.stateChanges++;
+        }
+        if (!hasState || pass.depthTest != state.depthTest)
+        {
+            if (pass.depthTest)
+                rlEnableDepthTest();
             else
-            {
-                pass.shader->SetInt(name + "_frameCount", 1);
-                pass.shader->SetFloat(name + "_animSpeed", 0.0f);
-            }
-            texUnit++;
+                rlDisableDepthTest();
+            state.depthTest = pass.depthTest;
+            m_renderStats.stateChanges++;
         }
-
-        m_lightingManager->UploadToShader(pass.shader, camera.Position(), texUnit);
-
-        if (pass.cullFace >= 0)
+        if (!hasState || pass.depthWrite != state.depthWrite)
         {
-            rlEnableBackfaceCulling();
-            rlSetCullFace(pass.cullFace);
+            if (pass.depthWrite)
+                rlEnableDepthMask();
+            else
+                rlDisableDepthMask();
+            state.depthWrite = pass.depthWrite;
+            m_renderStats.stateChanges++;
         }
-        if (!pass.depthTest)
-            rlDisableDepthTest();
-        if (!pass.depthWrite)
-            rlDisableDepthMask();
-
-        tempRaylibMaterial.shader = pass.shader->GetShader();
+        if (!hasState || pass.cullFace != state.cullFace)
+        {
+            if (pass.cullFace >= 0)
+            {
+                rlEnableBackfaceCulling();
+                rlSetCullFace(pass.cullFace);
+            }
+            else
+                rlDisableBackfaceCulling();
+            state.cullFace = pass.cullFace;
+            m_renderStats.stateChanges++;
+        }
+        hasState = true;
 
-        DrawMesh(mesh, tempRaylibMaterial, M);
-        rlDrawRenderBatchActive();
-        pass.shader->End();
-        EndBlendMode();
+        RenderSinglePass(item, VP * item.transform, viewPos, realTime, gameTime);
     }
+
+    // 恢复默认状态
+    if (boundShader != nullptr)
+        EndShaderMode();
+    EndBlendMode();
     rlEnableColorBlend();
     rlEnableDepthTest();
     rlEnableDepthMask();
@@ -541,6 +562,66 @@ void Renderer::RenderSinglePass(const Mesh &mesh, const Model &model, const int
     rlSetCullFace(RL_CULL_FACE_BACK);
 }
 
+// 只上传随绘制项变化的 uniform 与贴图, 混合/深度/剔除状态由 SubmitRenderQueue 设置
+void Renderer::RenderSinglePass(const RenderItem &item, const Matrix4f &MVP, const Vector3f &viewPos, float realTime, float gameTime)
+{
+    const RenderMaterial &pass = *item.material;
+    const Model &model = *item.model;
+    int matIdex = model.meshMaterial[item.meshIndex];
+    Material tempRaylibMaterial = model.materials[matIdex];
+
+    pass.shader->SetAll(MVP, item.transform, viewPos, realTime, gameTime, pass.baseColor, pass.customFloats, pass.customVector2, pass.customVector3, pass.customVector4);
+    pass.shader->SetVec4("totalBaseColor", item.totalBaseColor / 255.0f);
+
+    pass.shader->SetVec3("emissiveColor", pass.emissiveColor / 255.0f);
+    pass.shader->SetFloat("emissiveIntensity", pass.emissiveIntensity);
+
+    // 贴图单元随材质变化, 且 DrawMesh 结束时会解绑材质贴图所在单元, 每次绘制都重新绑定
+    int texUnit = 1;
+    if (pass.useDiffuseMap)
+    {
+        pass.shader->SetTexture("u_diffuseMap", pass.diffuseMap, texUnit);
+        if (pass.diffuseIsAnimated)
+        {
+            pass.shader->SetInt("u_diffuseMap_frameCount", pass.diffuseframeCount);
+            pass.shader->SetFloat("u_diffuseMap_animSpeed", pass.diffuseanimSpeed);
+        }
+        else
+        {
+            pass.shader->SetInt("u_diffuseMap_frameCount", 1);
+            pass.shader->SetFloat("u_diffuseMap_animSpeed", 0.0f);
+        }
+        tempRaylibMaterial.maps[MATERIAL_MAP_DIFFUSE].texture = pass.diffuseMap;
+        texUnit++;
+    }
+
+    pass.shader->SetCubeMap("skyboxMap", m_skybox->GetTexture(), texUnit);
+    texUnit++;
+
+    for (auto const &[name, text] : pass.customTextures)
+    {
+        pass.shader->SetTexture(name, text, texUnit);
+        if (pass.isAnimated.at(name))
+        {
+            pass.shader->SetInt(name + "_frameCount", pass.frameCount.at(name));
+            pass.shader->SetFloat(name + "_animSpeed", pass.animSpeed.at(name));
+        }
+        else
+        {
+            pass.shader->SetInt(name + "_frameCount", 1);
+            pass.shader->SetFloat(name + "_animSpeed", 0.0f);
+        }
+        texUnit++;
+    }
+
+    m_lightingManager->BindShadowMaps(pass.shader, texUnit);
+
+    tempRaylibMaterial.shader = pass.shader->GetShader();
+
+    DrawMesh(*item.mesh, tempRaylibMaterial, item.transform);
+    m_renderStats.draws++;
+}
+
 void Renderer::DrawParticle(GameWorld &gameWorld, mCamera &camera, float aspect)
 {
     auto &m_RTPool = m_postProcesser->GetRTPool();
@@ -764,7 +845,8 @@ void Renderer::DrawHitbox(GameWorld &gameWorld, CameraManager &cameraManager)
                     {
                         const auto &tf = gameObject->GetComponent<TransformComponent>();
                         const auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-                        HitBox worldHitbox(tf, rb);
+                        // 按渲染姿态绘制, 异步物理步进行中也不读物理线程正在写的姿态
+                        HitBox worldHitbox(tf.GetRenderPosition(), tf.GetRenderRotation(), rb);
 
                         if (worldHitbox.colliderType == ColliderType::SPHERE)
                         {
@@ -7,6 +7,7 @@
 #include "PostProcess/PostProcesser.h"
 #include "Skybox/Skybox.h"
 #include "Lighting/LightingManager.h"
+#include "RenderQueue/RenderQueue.h"
 
 #include <memory>
 #include <vector>
@@ -36,6 +37,9 @@ public:
 
     static RenderTexture2D LoadRT(int width, int height, PixelFormat format);
 
+    // 最近一帧 (RenderScene 开始时清零) 的绘制计数
+    const RenderStats &GetRenderStats() const { return m_renderStats; }
+
 private:
     std::unique_ptr<Skybox> m_skybox;
     bool m_useSkybox = false;
@@ -43,10 +47,21 @@ private:
     void RawRenderScene(GameWorld &gameWorld, CameraManager &cameraManager);
     void RawRenderParticle(GameWorld &gameWorld, CameraManager &cameraManager);
 
-    void RenderSinglePass(const Mesh &mesh, const Model &model, const int &meshIdx, const RenderMaterial &pass,
-                          const Matrix4f &matProj, const Matrix4f &matView, const Matrix4f &MVP, const Matrix4f &M,
-                          const mCamera &camera, GameWorld &gameWorld, const Vector4f &totalBaseColor);
-    void DrawWorldObjects(GameWorld &gameWorld, Camera3D &rawCamera, mCamera &camera, float aspect);
+    // 提交时跟踪的固定管线状态
+    struct PassState
+    {
+        int blendMode = BLEND_OPIQUE;
+        bool depthTest = true;
+        bool depthWrite = true;
+        int cullFace = -1;
+    };
+    RenderQueue m_renderQueue;
+    RenderStats m_renderStats;
+
+    void SubmitRenderQueue(const Matrix4f &matProj, const Matrix4f &matView, const Matrix4f &VP, const mCamera &camera, GameWorld &gameWorld);
+    void RenderSinglePass(const RenderItem &item, const Matrix4f &MVP, const Vector3f &viewPos, float realTime, float gameTime);
+    // viewId 写入排序键, 区分同一帧的多个视图
+    void DrawWorldObjects(GameWorld &gameWorld, Camera3D &rawCamera, mCamera &camera, float aspect, uint32_t viewId = 0);
     void DrawParticle(GameWorld &gameWorld, mCamera &camera, float aspect);
 
     bool LoadViewConfig(const std::string &configPath, GameWorld &gameWorld);
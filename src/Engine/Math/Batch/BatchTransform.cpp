@@ -0,0 +1,122 @@
+#include "BatchTransform.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include <cmath>
+
+namespace
+{
+    inline const Vector3f &At(const Vector3f *base, size_t i, size_t stride)
+    {
+        return *reinterpret_cast<const Vector3f *>(reinterpret_cast<const char *>(base) + i * stride);
+    }
+    inline Vector3f &At(Vector3f *base, size_t i, size_t stride)
+    {
+        return *reinterpret_cast<Vector3f *>(reinterpret_cast<char *>(base) + i * stride);
+    }
+
+    // 左上 3x3 (列) 与平移, 循环外取出一次
+    struct Affine
+    {
+        float c0[3], c1[3], c2[3], t[3];
+
+        explicit Affine(const Matrix4f &m)
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                c0[i] = m(i, 0);
+                c1[i] = m(i, 1);
+                c2[i] = m(i, 2);
+                t[i] = m(i, 3);
+            }
+        }
+        Vector3f Direction(const Vector3f &v) const
+        {
+            const float x = v.x(), y = v.y(), z = v.z();
+            return Vector3f(c0[0] * x + c1[0] * y + c2[0] * z,
+                            c0[1] * x + c1[1] * y + c2[1] * z,
+                            c0[2] * x + c1[2] * y + c2[2] * z);
+        }
+        Vector3f Point(const Vector3f &p) const
+        {
+            const Vector3f d = Direction(p);
+            return Vector3f(d.x() + t[0], d.y() + t[1], d.z() + t[2]);
+        }
+    };
+
+    void TransformSoA(const Matrix4f &m, float *x, float *y, float *z, size_t count, bool translate)
+    {
+        const Affine a(m);
+        const float tx = translate ? a.t[0] : 0.0f, ty = translate ? a.t[1] : 0.0f, tz = translate ? a.t[2] : 0.0f;
+        size_t i = 0;
+#ifdef NW_MATH_SSE
+        const __m128 m00 = _mm_set1_ps(a.c0[0]), m10 = _mm_set1_ps(a.c0[1]), m20 = _mm_set1_ps(a.c0[2]);
+        const __m128 m01 = _mm_set1_ps(a.c1[0]), m11 = _mm_set1_ps(a.c1[1]), m21 = _mm_set1_ps(a.c1[2]);
+        const __m128 m02 = _mm_set1_ps(a.c2[0]), m12 = _mm_set1_ps(a.c2[1]), m22 = _mm_set1_ps(a.c2[2]);
+        const __m128 vtx = _mm_set1_ps(tx), vty = _mm_set1_ps(ty), vtz = _mm_set1_ps(tz);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i), pz = _mm_loadu_ps(z + i);
+            const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, px), _mm_mul_ps(m01, py)), _mm_mul_ps(m02, pz)), vtx);
+            const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, px), _mm_mul_ps(m11, py)), _mm_mul_ps(m12, pz)), vty);
+            const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, px), _mm_mul_ps(m21, py)), _mm_mul_ps(m22, pz)), vtz);
+            _mm_storeu_ps(x + i, rx);
+            _mm_storeu_ps(y + i, ry);
+            _mm_storeu_ps(z + i, rz);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            const float px = x[i], py = y[i], pz = z[i];
+            x[i] = a.c0[0] * px + a.c1[0] * py + a.c2[0] * pz + tx;
+            y[i] = a.c0[1] * px + a.c1[1] * py + a.c2[1] * pz + ty;
+            z[i] = a.c0[2] * px + a.c1[2] * py + a.c2[2] * pz + tz;
+        }
+    }
+}
+
+void BatchTransform::TransformPoints(const Matrix4f &m, const Vector3f *in, Vector3f *out, size_t count, size_t inStride, size_t outStride)
+{
+    const Affine a(m);
+    for (size_t i = 0; i < count; i++)
+        At(out, i, outStride) = a.Point(At(in, i, inStride));
+}
+
+void BatchTransform::TransformDirections(const Matrix4f &m, const Vector3f *in, Vector3f *out, size_t count, size_t inStride, size_t outStride)
+{
+    const Affine a(m);
+    for (size_t i = 0; i < count; i++)
+        At(out, i, outStride) = a.Direction(At(in, i, inStride));
+}
+
+void BatchTransform::RotateVectors(const Quat4f &q, const Vector3f *in, Vector3f *out, size_t count, size_t inStride, size_t outStride)
+{
+    TransformDirections(Matrix4f::rotation(q), in, out, count, inStride, outStride);
+}
+
+void BatchTransform::TransformPointsSoA(const Matrix4f &m, float *x, float *y, float *z, size_t count)
+{
+    TransformSoA(m, x, y, z, count, true);
+}
+
+void BatchTransform::TransformDirectionsSoA(const Matrix4f &m, float *x, float *y, float *z, size_t count)
+{
+    TransformSoA(m, x, y, z, count, false);
+}
+
+void BatchTransform::TransformAABBs(const Matrix4f &m, const Vector3f *mins, const Vector3f *maxs,
+                                    Vector3f *outMins, Vector3f *outMaxs, size_t count)
+{
+    const Affine a(m);
+    // |M| 的列
+    const Vector3f abs0(std::fabs(a.c0[0]), std::fabs(a.c0[1]), std::fabs(a.c0[2]));
+    const Vector3f abs1(std::fabs(a.c1[0]), std::fabs(a.c1[1]), std::fabs(a.c1[2]));
+    const Vector3f abs2(std::fabs(a.c2[0]), std::fabs(a.c2[1]), std::fabs(a.c2[2]));
+    for (size_t i = 0; i < count; i++)
+    {
+        const Vector3f center = (mins[i] + maxs[i]) * 0.5f;
+        const Vector3f half = (maxs[i] - mins[i]) * 0.5f;
+        const Vector3f worldCenter = a.Point(center);
+        const Vector3f worldHalf = abs0 * half.x() + abs1 * half.y() + abs2 * half.z();
+        outMins[i] = worldCenter - worldHalf;
+        outMaxs[i] = worldCenter + worldHalf;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Engine/Math/LinearAlgebra/Matrix/Matrix4f.h"
+#include <cstddef>
+
+// 一个变换作用于一批点/方向/包围盒
+// AoS 接口带字节跨步, 可以直接处理结构体数组中的某个 Vector3f 字段 (如 GPUParticle::position)
+// 输入与输出可以是同一段内存 (原地变换)
+namespace BatchTransform
+{
+    constexpr size_t PACKED = sizeof(Vector3f);
+
+    // out = m * (p, 1)
+    void TransformPoints(const Matrix4f &m, const Vector3f *in, Vector3f *out, size_t count,
+                         size_t inStride = PACKED, size_t outStride = PACKED);
+    // out = m * (d, 0), 只用到左上 3x3
+    void TransformDirections(const Matrix4f &m, const Vector3f *in, Vector3f *out, size_t count,
+                             size_t inStride = PACKED, size_t outStride = PACKED);
+    // out = q * v, 四元数先转成矩阵, 每个向量只做一次 3x3 乘法
+    void RotateVectors(const Quat4f &q, const Vector3f *in, Vector3f *out, size_t count,
+                       size_t inStride = PACKED, size_t outStride = PACKED);
+
+    // SoA 原地变换, 每次处理 4 个, 无 SSE 时退化为标量
+    void TransformPointsSoA(const Matrix4f &m, float *x, float *y, float *z, size_t count);
+    void TransformDirectionsSoA(const Matrix4f &m, float *x, float *y, float *z, size_t count);
+
+    // 仿射变换后的轴对齐包围盒 (Arvo): 中心按完整变换, 半长乘以 |M| 的左上 3x3
+    // 与变换 8 个角点后取 min/max 的结果一致
+    void TransformAABBs(const Matrix4f &m, const Vector3f *mins, const Vector3f *maxs,
+                        Vector3f *outMins, Vector3f *outMaxs, size_t count);
+    inline void TransformAABB(const Matrix4f &m, const Vector3f &min, const Vector3f &max, Vector3f &outMin, Vector3f &outMax)
+    {
+        TransformAABBs(m, &min, &max, &outMin, &outMax, 1);
+    }
+}
@@ -0,0 +1,128 @@
+#include "MathSIMD.h"
+#include "Engine/Math/LinearAlgebra/Matrix/Matrix3f.h"
+
+float MathScalar::InverseMat4(const float *m, float *out)
+{
+    float m00 = m[0];
+    float m10 = m[1];
+    float m20 = m[2];
+    float m30 = m[3];
+
+    float m01 = m[4];
+    float m11 = m[5];
+    float m21 = m[6];
+    float m31 = m[7];
+
+    float m02 = m[8];
+    float m12 = m[9];
+    float m22 = m[10];
+    float m32 = m[11];
+
+    float m03 = m[12];
+    float m13 = m[13];
+    float m23 = m[14];
+    float m33 = m[15];
+
+    float cofactor00 = Matrix3f::determinant3x3(m11, m12, m13, m21, m22, m23, m31, m32, m33);
+    float cofactor01 = -Matrix3f::determinant3x3(m12, m13, m10, m22, m23, m20, m32, m33, m30);
+    float cofactor02 = Matrix3f::determinant3x3(m13, m10, m11, m23, m20, m21, m33, m30, m31);
+    float cofactor03 = -Matrix3f::determinant3x3(m10, m11, m12, m20, m21, m22, m30, m31, m32);
+
+    float cofactor10 = -Matrix3f::determinant3x3(m21, m22, m23, m31, m32, m33, m01, m02, m03);
+    float cofactor11 = Matrix3f::determinant3x3(m22, m23, m20, m32, m33, m30, m02, m03, m00);
+    float cofactor12 = -Matrix3f::determinant3x3(m23, m20, m21, m33, m30, m31, m03, m00, m01);
+    float cofactor13 = Matrix3f::determinant3x3(m20, m21, m22, m30, m31, m32, m00, m01, m02);
+
+    float cofactor20 = Matrix3f::determinant3x3(m31, m32, m33, m01, m02, m03, m11, m12, m13);
+    float cofactor21 = -Matrix3f::determinant3x3(m32, m33, m30, m02, m03, m00, m12, m13, m10);
+    float cofactor22 = Matrix3f::determinant3x3(m33, m30, m31, m03, m00, m01, m13, m10, m11);
+    float cofactor23 = -Matrix3f::determinant3x3(m30, m31, m32, m00, m01, m02, m10, m11, m12);
+
+    float cofactor30 = -Matrix3f::determinant3x3(m01, m02, m03, m11, m12, m13, m21, m22, m23);
+    float cofactor31 = Matrix3f::determinant3x3(m02, m03, m00, m12, m13, m10, m22, m23, m20);
+    float cofactor32 = -Matrix3f::determinant3x3(m03, m00, m01, m13, m10, m11, m23, m20, m21);
+    float cofactor33 = Matrix3f::determinant3x3(m00, m01, m02, m10, m11, m12, m20, m21, m22);
+
+    float determinant = m00 * cofactor00 + m01 * cofactor01 + m02 * cofactor02 + m03 * cofactor03;
+    float reciprocalDeterminant = 1.0f / determinant;
+
+    // 逆矩阵 (i, j) = cofactor(j, i) / det, 列主序下 out[j * 4 + i] 即 cofactor(j, i)
+    const float cofactors[16] = {
+        cofactor00, cofactor01, cofactor02, cofactor03,
+        cofactor10, cofactor11, cofactor12, cofactor13,
+        cofactor20, cofactor21, cofactor22, cofactor23,
+        cofactor30, cofactor31, cofactor32, cofactor33};
+    for (int i = 0; i < 16; ++i)
+        out[i] = cofactors[i] * reciprocalDeterminant;
+    return determinant;
+}
+
+#ifdef NW_MATH_SSE
+#define NW_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x))
+
+// 2x2 矩阵按行存放在一个寄存器中: (m00, m01, m10, m11)
+namespace
+{
+    // a * b
+    inline __m128 Mat2Mul(__m128 a, __m128 b)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, NW_SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(NW_SWIZZLE(a, 1, 0, 3, 2), NW_SWIZZLE(b, 2, 1, 2, 1)));
+    }
+    // adj(a) * b
+    inline __m128 Mat2AdjMul(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(_mm_mul_ps(NW_SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(NW_SWIZZLE(a, 1, 1, 2, 2), NW_SWIZZLE(b, 2, 3, 0, 1)));
+    }
+    // a * adj(b)
+    inline __m128 Mat2MulAdj(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(_mm_mul_ps(a, NW_SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(NW_SWIZZLE(a, 1, 0, 3, 2), NW_SWIZZLE(b, 2, 1, 2, 1)));
+    }
+}
+
+// 分块求逆: M = [A B; C D], 各块 2x2, 用伴随矩阵避免逐块求逆
+// 按行主序推导, 对列主序数据等价于对转置求逆, 结果再按列主序写回即为 M^-1
+float MathSIMD::InverseMat4(const float *m, float *out)
+{
+    const __m128 r0 = _mm_loadu_ps(m), r1 = _mm_loadu_ps(m + 4), r2 = _mm_loadu_ps(m + 8), r3 = _mm_loadu_ps(m + 12);
+    const __m128 A = _mm_movelh_ps(r0, r1);
+    const __m128 B = _mm_movehl_ps(r1, r0);
+    const __m128 C = _mm_movelh_ps(r2, r3);
+    const __m128 D = _mm_movehl_ps(r3, r2);
+
+    // (det A, det B, det C, det D)
+    const __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+    const __m128 detA = NW_SWIZZLE(detSub, 0, 0, 0, 0);
+    const __m128 detB = NW_SWIZZLE(detSub, 1, 1, 1, 1);
+    const __m128 detC = NW_SWIZZLE(detSub, 2, 2, 2, 2);
+    const __m128 detD = NW_SWIZZLE(detSub, 3, 3, 3, 3);
+
+    const __m128 DC = Mat2AdjMul(D, C);
+    const __m128 AB = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC));
+
+    // det M = det A * det D + det B * det C - tr(adj(A) B adj(D) C)
+    __m128 tr = _mm_mul_ps(AB, NW_SWIZZLE(DC, 0, 2, 1, 3));
+    tr = _mm_add_ps(tr, NW_SWIZZLE(tr, 1, 0, 3, 2));
+    tr = _mm_add_ps(tr, NW_SWIZZLE(tr, 2, 3, 0, 1));
+    const __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+    const __m128 reciprocal = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    X = _mm_mul_ps(X, reciprocal);
+    Y = _mm_mul_ps(Y, reciprocal);
+    Z = _mm_mul_ps(Z, reciprocal);
+    W = _mm_mul_ps(W, reciprocal);
+
+    _mm_storeu_ps(out, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(out + 4, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(out + 8, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(out + 12, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+    return _mm_cvtss_f32(detM);
+}
+#undef NW_SWIZZLE
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+// Matrix4f / Quat4f 的热点运算内核, 按列主序 float[16] 与 (w, x, y, z) float[4] 操作
+// MathScalar 为标量参考实现; MathSIMD 在支持 SSE2 的桌面平台上走 SSE, 其余平台 (Web 等) 回退到 MathScalar
+// 乘法按与标量相同的顺序累加, 结果逐位一致 (仅 0 的符号可能不同); 求逆使用 2x2 分块法, 结果在浮点误差内一致
+
+// 全部 SSE 内核 (批量变换、SAT、积分器、射线、飞行力学、Barnes-Hut) 共用 NW_MATH_SSE 开关
+#if !defined(PLATFORM_WEB) && (defined(__SSE2__) || defined(_M_X64))
+#define NW_MATH_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace MathScalar
+{
+    // out = a * b
+    inline void MulMat4(const float *a, const float *b, float *out)
+    {
+        for (int k = 0; k < 4; ++k)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                float sum = 0.0f;
+                for (int j = 0; j < 4; ++j)
+                    sum += a[j * 4 + i] * b[k * 4 + j];
+                out[k * 4 + i] = sum;
+            }
+        }
+    }
+
+    // out = m * v
+    inline void MulMat4Vec4(const float *m, const float *v, float *out)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            float sum = 0.0f;
+            for (int j = 0; j < 4; ++j)
+                sum += m[j * 4 + i] * v[j];
+            out[i] = sum;
+        }
+    }
+
+    // out = q0 * q1, 分量顺序 (w, x, y, z)
+    inline void MulQuat(const float *q0, const float *q1, float *out)
+    {
+        const float w = q0[0] * q1[0] - q0[1] * q1[1] - q0[2] * q1[2] - q0[3] * q1[3];
+        const float x = q0[0] * q1[1] + q0[1] * q1[0] + q0[2] * q1[3] - q0[3] * q1[2];
+        const float y = q0[0] * q1[2] - q0[1] * q1[3] + q0[2] * q1[0] + q0[3] * q1[1];
+        const float z = q0[0] * q1[3] + q0[1] * q1[2] - q0[2] * q1[1] + q0[3] * q1[0];
+        out[0] = w;
+        out[1] = x;
+        out[2] = y;
+        out[3] = z;
+    }
+
+    // 余子式法求逆, out = m^-1, 返回行列式; 行列式为 0 时 out 内容无意义
+    float InverseMat4(const float *m, float *out);
+}
+
+namespace MathSIMD
+{
+#ifdef NW_MATH_SSE
+    inline void MulMat4(const float *a, const float *b, float *out)
+    {
+        const __m128 c0 = _mm_loadu_ps(a), c1 = _mm_loadu_ps(a + 4), c2 = _mm_loadu_ps(a + 8), c3 = _mm_loadu_ps(a + 12);
+        __m128 result[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            const float *col = b + k * 4;
+            __m128 sum = _mm_mul_ps(c0, _mm_set1_ps(col[0]));
+            sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(col[1])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(col[2])));
+            result[k] = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(col[3])));
+        }
+        // 全部算完再写回, out 可与 a / b 重叠
+        for (int k = 0; k < 4; ++k)
+            _mm_storeu_ps(out + k * 4, result[k]);
+    }
+
+    inline void MulMat4Vec4(const float *m, const float *v, float *out)
+    {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(v[0]));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(v[1])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(v[2])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(v[3])));
+        _mm_storeu_ps(out, sum);
+    }
+
+    // 按 q0 的分量展开: q0.w * (w, x, y, z) + q0.x * (-x, w, -z, y) + q0.y * (-y, z, w, -x) + q0.z * (-z, -y, x, w)
+    inline void MulQuat(const float *q0, const float *q1, float *out)
+    {
+        const __m128 b = _mm_loadu_ps(q1);
+        const __m128 bx = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f));
+        const __m128 by = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+        const __m128 bz = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f));
+        __m128 sum = _mm_mul_ps(_mm_set1_ps(q0[0]), b);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(q0[1]), bx));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(q0[2]), by));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(q0[3]), bz));
+        _mm_storeu_ps(out, sum);
+    }
+
+    float InverseMat4(const float *m, float *out);
+#else
+    inline void MulMat4(const float *a, const float *b, float *out)
+    {
+        float result[16];
+        MathScalar::MulMat4(a, b, result);
+        for (int i = 0; i < 16; ++i)
+            out[i] = result[i];
+    }
+    inline void MulMat4Vec4(const float *m, const float *v, float *out)
+    {
+        float result[4];
+        MathScalar::MulMat4Vec4(m, v, result);
+        for (int i = 0; i < 4; ++i)
+            out[i] = result[i];
+    }
+    inline void MulQuat(const float *q0, const float *q1, float *out) { MathScalar::MulQuat(q0, q1, out); }
+    inline float InverseMat4(const float *m, float *out) { return MathScalar::InverseMat4(m, out); }
+#endif
+}
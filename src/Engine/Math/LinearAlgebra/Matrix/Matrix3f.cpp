@@ -7,119 +7,6 @@
 
 #include "Matrix2f.h"
 #include "Quat4f.h"
-#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
-#include <string.h>
-
-Matrix3f::Matrix3f(float fill)
-{
-	for (int i = 0; i < 9; ++i)
-	{
-		m_data[i] = fill;
-	}
-}
-Matrix3f::Matrix3f(const Vector3f &v)
-{
-	memset(m_data, 0, sizeof(m_data));
-	m_data[0] = v.x();
-	m_data[4] = v.y();
-	m_data[8] = v.z();
-}
-
-Matrix3f::Matrix3f(float m00, float m01, float m02,
-				   float m10, float m11, float m12,
-				   float m20, float m21, float m22)
-{
-	m_data[0] = m00;
-	m_data[1] = m10;
-	m_data[2] = m20;
-
-	m_data[3] = m01;
-	m_data[4] = m11;
-	m_data[5] = m21;
-
-	m_data[6] = m02;
-	m_data[7] = m12;
-	m_data[8] = m22;
-}
-
-Matrix3f::Matrix3f(const Vector3f &v0, const Vector3f &v1, const Vector3f &v2, bool setColumns)
-{
-	if (setColumns)
-	{
-		setCol(0, v0);
-		setCol(1, v1);
-		setCol(2, v2);
-	}
-	else
-	{
-		setRow(0, v0);
-		setRow(1, v1);
-		setRow(2, v2);
-	}
-}
-
-Matrix3f::Matrix3f(const Matrix3f &rm)
-{
-	memcpy(m_data, rm.m_data, 9 * sizeof(float));
-}
-
-Matrix3f &Matrix3f::operator=(const Matrix3f &rm)
-{
-	if (this != &rm)
-	{
-		memcpy(m_data, rm.m_data, 9 * sizeof(float));
-	}
-	return *this;
-}
-
-const float &Matrix3f::operator()(int i, int j) const
-{
-	return m_data[j * 3 + i];
-}
-
-float &Matrix3f::operator()(int i, int j)
-{
-	return m_data[j * 3 + i];
-}
-void Matrix3f::setDiag(float d1, float d2, float d3)
-{
-	m_data[0] = d1;
-	m_data[4] = d2;
-	m_data[8] = d3;
-}
-Vector3f Matrix3f::getRow(int i) const
-{
-	return Vector3f(
-		m_data[i],
-		m_data[i + 3],
-		m_data[i + 6]);
-}
-
-void Matrix3f::setRow(int i, const Vector3f &v)
-{
-	m_data[i] = v.x();
-	m_data[i + 3] = v.y();
-	m_data[i + 6] = v.z();
-}
-
-Vector3f Matrix3f::getCol(int j) const
-{
-	int colStart = 3 * j;
-
-	return Vector3f(
-		m_data[colStart],
-		m_data[colStart + 1],
-		m_data[colStart + 2]);
-}
-
-void Matrix3f::setCol(int j, const Vector3f &v)
-{
-	int colStart = 3 * j;
-
-	m_data[colStart] = v.x();
-	m_data[colStart + 1] = v.y();
-	m_data[colStart + 2] = v.z();
-}
 
 Matrix2f Matrix3f::getSubmatrix2x2(int i0, int j0) const
 {
@@ -147,14 +34,6 @@ void Matrix3f::setSubmatrix2x2(int i0, int j0, const Matrix2f &m)
 	}
 }
 
-float Matrix3f::determinant() const
-{
-	return Matrix3f::determinant3x3(
-		m_data[0], m_data[3], m_data[6],
-		m_data[1], m_data[4], m_data[7],
-		m_data[2], m_data[5], m_data[8]);
-}
-
 Matrix3f Matrix3f::inverse(bool *pbIsSingular, float epsilon) const
 {
 	float m00 = m_data[0];
@@ -208,68 +87,6 @@ Matrix3f Matrix3f::inverse(bool *pbIsSingular, float epsilon) const
 	}
 }
 
-void Matrix3f::transpose()
-{
-	float temp;
-
-	for (int i = 0; i < 2; ++i)
-	{
-		for (int j = i + 1; j < 3; ++j)
-		{
-			temp = (*this)(i, j);
-			(*this)(i, j) = (*this)(j, i);
-			(*this)(j, i) = temp;
-		}
-	}
-}
-
-Matrix3f Matrix3f::transposed() const
-{
-	Matrix3f out;
-	for (int i = 0; i < 3; ++i)
-	{
-		for (int j = 0; j < 3; ++j)
-		{
-			out(j, i) = (*this)(i, j);
-		}
-	}
-
-	return out;
-}
-
-// static
-float Matrix3f::determinant3x3(float m00, float m01, float m02,
-							   float m10, float m11, float m12,
-							   float m20, float m21, float m22)
-{
-	return (
-		m00 * (m11 * m22 - m12 * m21) - m01 * (m10 * m22 - m12 * m20) + m02 * (m10 * m21 - m11 * m20));
-}
-
-// static
-Matrix3f Matrix3f::ones()
-{
-	Matrix3f m;
-	for (int i = 0; i < 9; ++i)
-	{
-		m.m_data[i] = 1;
-	}
-
-	return m;
-}
-
-// static
-Matrix3f Matrix3f::identity()
-{
-	Matrix3f m;
-
-	m(0, 0) = 1;
-	m(1, 1) = 1;
-	m(2, 2) = 1;
-
-	return m;
-}
-
 // static
 Matrix3f Matrix3f::rotateX(float radians)
 {
@@ -306,24 +123,6 @@ Matrix3f Matrix3f::rotateZ(float radians)
 		0, 0, 1);
 }
 
-// static
-Matrix3f Matrix3f::scaling(float sx, float sy, float sz)
-{
-	return Matrix3f(
-		sx, 0, 0,
-		0, sy, 0,
-		0, 0, sz);
-}
-
-// static
-Matrix3f Matrix3f::uniformScaling(float s)
-{
-	return Matrix3f(
-		s, 0, 0,
-		0, s, 0,
-		0, 0, s);
-}
-
 // static
 Matrix3f Matrix3f::rotation(const Vector3f &rDirection, float radians)
 {
@@ -365,36 +164,3 @@ Matrix3f Matrix3f::rotation(const Quat4f &rq)
 		2.0f * (xy + zw), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - xw),
 		2.0f * (xz - yw), 2.0f * (yz + xw), 1.0f - 2.0f * (xx + yy));
 }
-
-Vector3f operator*(const Matrix3f &m, const Vector3f &v)
-{
-	Vector3f output(0, 0, 0);
-
-	for (int i = 0; i < 3; ++i)
-	{
-		for (int j = 0; j < 3; ++j)
-		{
-			output[i] += m(i, j) * v[j];
-		}
-	}
-
-	return output;
-}
-
-Matrix3f operator*(const Matrix3f &x, const Matrix3f &y)
-{
-	Matrix3f product;
-
-	for (int i = 0; i < 3; ++i)
-	{
-		for (int j = 0; j < 3; ++j)
-		{
-			for (int k = 0; k < 3; ++k)
-			{
-				product(i, k) += x(i, j) * y(j, k);
-			}
-		}
-	}
-
-	return product;
-}
@@ -1,35 +1,66 @@
 #pragma once
 #include <cstdio>
+#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
 
 class Matrix2f;
 class Quat4f;
-class Vector3f;
 
+// 列主序存储, 元素访问与乘法在头文件内联
 class Matrix3f
 {
 public:
-	Matrix3f(float fill = 0.f);
-	Matrix3f(float m00, float m01, float m02,
-			 float m10, float m11, float m12,
-			 float m20, float m21, float m22);
+	constexpr Matrix3f(float fill = 0.f) : m_data{fill, fill, fill, fill, fill, fill, fill, fill, fill} {}
+	constexpr Matrix3f(float m00, float m01, float m02,
+					   float m10, float m11, float m12,
+					   float m20, float m21, float m22)
+		: m_data{m00, m10, m20, m01, m11, m21, m02, m12, m22} {}
 
 	// setColumns = true ==> matrix to be [v0 v1 v2]
-	Matrix3f(const Vector3f &v0, const Vector3f &v1, const Vector3f &v2, bool setColumns = true);
+	constexpr Matrix3f(const Vector3f &v0, const Vector3f &v1, const Vector3f &v2, bool setColumns = true) : m_data{}
+	{
+		if (setColumns)
+		{
+			setCol(0, v0);
+			setCol(1, v1);
+			setCol(2, v2);
+		}
+		else
+		{
+			setRow(0, v0);
+			setRow(1, v1);
+			setRow(2, v2);
+		}
+	}
 	// diag
-	Matrix3f(const Vector3f &v);
-	Matrix3f(const Matrix3f &rm);
-	Matrix3f &operator=(const Matrix3f &rm);
-
-	const float &operator()(int i, int j) const;
-	float &operator()(int i, int j);
-
-	Vector3f getRow(int i) const;
-	void setRow(int i, const Vector3f &v);
-
-	Vector3f getCol(int j) const;
-	void setCol(int j, const Vector3f &v);
-
-	void setDiag(float d0, float d1, float d2);
+	constexpr Matrix3f(const Vector3f &v) : m_data{v.x(), 0, 0, 0, v.y(), 0, 0, 0, v.z()} {}
+	constexpr Matrix3f(const Matrix3f &rm) = default;
+	constexpr Matrix3f &operator=(const Matrix3f &rm) = default;
+
+	constexpr const float &operator()(int i, int j) const { return m_data[j * 3 + i]; }
+	constexpr float &operator()(int i, int j) { return m_data[j * 3 + i]; }
+
+	constexpr Vector3f getRow(int i) const { return Vector3f(m_data[i], m_data[i + 3], m_data[i + 6]); }
+	constexpr void setRow(int i, const Vector3f &v)
+	{
+		m_data[i] = v.x();
+		m_data[i + 3] = v.y();
+		m_data[i + 6] = v.z();
+	}
+
+	constexpr Vector3f getCol(int j) const { return Vector3f(m_data[3 * j], m_data[3 * j + 1], m_data[3 * j + 2]); }
+	constexpr void setCol(int j, const Vector3f &v)
+	{
+		m_data[3 * j] = v.x();
+		m_data[3 * j + 1] = v.y();
+		m_data[3 * j + 2] = v.z();
+	}
+
+	constexpr void setDiag(float d0, float d1, float d2)
+	{
+		m_data[0] = d0;
+		m_data[4] = d1;
+		m_data[8] = d2;
+	}
 	// gets the 2x2 submatrix of this matrix to m
 	// starting with upper left corner at (i0, j0)
 	Matrix2f getSubmatrix2x2(int i0, int j0) const;
@@ -38,23 +69,49 @@ public:
 	// starting with upper left corner at (i0, j0)
 	void setSubmatrix2x2(int i0, int j0, const Matrix2f &m);
 
-	float determinant() const;
+	constexpr float determinant() const
+	{
+		return Matrix3f::determinant3x3(
+			m_data[0], m_data[3], m_data[6],
+			m_data[1], m_data[4], m_data[7],
+			m_data[2], m_data[5], m_data[8]);
+	}
 	Matrix3f inverse(bool *pbIsSingular = NULL, float epsilon = 0.f) const;
 
-	void transpose();
-	Matrix3f transposed() const;
-
-	static float determinant3x3(float m00, float m01, float m02,
-								float m10, float m11, float m12,
-								float m20, float m21, float m22);
-
-	static Matrix3f ones();
-	static Matrix3f identity();
+	constexpr void transpose()
+	{
+		for (int i = 0; i < 2; ++i)
+		{
+			for (int j = i + 1; j < 3; ++j)
+			{
+				float temp = (*this)(i, j);
+				(*this)(i, j) = (*this)(j, i);
+				(*this)(j, i) = temp;
+			}
+		}
+	}
+	constexpr Matrix3f transposed() const
+	{
+		Matrix3f out(*this);
+		out.transpose();
+		return out;
+	}
+
+	static constexpr float determinant3x3(float m00, float m01, float m02,
+										  float m10, float m11, float m12,
+										  float m20, float m21, float m22)
+	{
+		return (
+			m00 * (m11 * m22 - m12 * m21) - m01 * (m10 * m22 - m12 * m20) + m02 * (m10 * m21 - m11 * m20));
+	}
+
+	static constexpr Matrix3f ones() { return Matrix3f(1.0f); }
+	static constexpr Matrix3f identity() { return Matrix3f(Vector3f(1.0f)); }
 	static Matrix3f rotateX(float radians);
 	static Matrix3f rotateY(float radians);
 	static Matrix3f rotateZ(float radians);
-	static Matrix3f scaling(float sx, float sy, float sz);
-	static Matrix3f uniformScaling(float s);
+	static constexpr Matrix3f scaling(float sx, float sy, float sz) { return Matrix3f(Vector3f(sx, sy, sz)); }
+	static constexpr Matrix3f uniformScaling(float s) { return Matrix3f(Vector3f(s)); }
 	static Matrix3f rotation(const Vector3f &rDirection, float radians);
 
 	// Returns the rotation matrix represented by a unit quaternion
@@ -65,6 +122,35 @@ private:
 	float m_data[9];
 };
 
-Vector3f operator*(const Matrix3f &m, const Vector3f &v);
+constexpr Vector3f operator*(const Matrix3f &m, const Vector3f &v)
+{
+	Vector3f output(0, 0, 0);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			output[i] += m(i, j) * v[j];
+		}
+	}
 
-Matrix3f operator*(const Matrix3f &x, const Matrix3f &y);
+	return output;
+}
+
+constexpr Matrix3f operator*(const Matrix3f &x, const Matrix3f &y)
+{
+	Matrix3f product;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				product(i, k) += x(i, j) * y(j, k);
+			}
+		}
+	}
+
+	return product;
+}
@@ -6,133 +6,8 @@
 #include <cstring>
 
 #include "Matrix2f.h"
-#include "Matrix3f.h"
-#include "Quat4f.h"
-#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
-#include "Engine/Math/LinearAlgebra/Vector/Vector4f.h"
 
-Matrix4f::Matrix4f(float fill)
-{
-    for (int i = 0; i < 16; ++i)
-    {
-        m_data[i] = fill;
-    }
-}
-
-Matrix4f::Matrix4f(float m00, float m01, float m02, float m03,
-                   float m10, float m11, float m12, float m13,
-                   float m20, float m21, float m22, float m23,
-                   float m30, float m31, float m32, float m33)
-{
-    m_data[0] = m00;
-    m_data[1] = m10;
-    m_data[2] = m20;
-    m_data[3] = m30;
-
-    m_data[4] = m01;
-    m_data[5] = m11;
-    m_data[6] = m21;
-    m_data[7] = m31;
-
-    m_data[8] = m02;
-    m_data[9] = m12;
-    m_data[10] = m22;
-    m_data[11] = m32;
-
-    m_data[12] = m03;
-    m_data[13] = m13;
-    m_data[14] = m23;
-    m_data[15] = m33;
-}
-
-Matrix4f &Matrix4f::operator/=(float d)
-{
-    for (int ii = 0; ii < 16; ii++)
-    {
-        m_data[ii] /= d;
-    }
-    return *this;
-}
-
-Matrix4f::Matrix4f(const Vector4f &v0, const Vector4f &v1, const Vector4f &v2, const Vector4f &v3, bool setColumns)
-{
-    if (setColumns)
-    {
-        setCol(0, v0);
-        setCol(1, v1);
-        setCol(2, v2);
-        setCol(3, v3);
-    }
-    else
-    {
-        setRow(0, v0);
-        setRow(1, v1);
-        setRow(2, v2);
-        setRow(3, v3);
-    }
-}
-
-Matrix4f::Matrix4f(const Matrix4f &rm)
-{
-    memcpy(m_data, rm.m_data, 16 * sizeof(float));
-}
-
-Matrix4f &Matrix4f::operator=(const Matrix4f &rm)
-{
-    if (this != &rm)
-    {
-        memcpy(m_data, rm.m_data, 16 * sizeof(float));
-    }
-    return *this;
-}
-
-const float &Matrix4f::operator()(int i, int j) const
-{
-    return m_data[j * 4 + i];
-}
-
-float &Matrix4f::operator()(int i, int j)
-{
-    return m_data[j * 4 + i];
-}
-
-Vector4f Matrix4f::getRow(int i) const
-{
-    return Vector4f(
-        m_data[i],
-        m_data[i + 4],
-        m_data[i + 8],
-        m_data[i + 12]);
-}
-
-void Matrix4f::setRow(int i, const Vector4f &v)
-{
-    m_data[i] = v.x();
-    m_data[i + 4] = v.y();
-    m_data[i + 8] = v.z();
-    m_data[i + 12] = v.w();
-}
-
-Vector4f Matrix4f::getCol(int j) const
-{
-    int colStart = 4 * j;
-
-    return Vector4f(
-        m_data[colStart],
-        m_data[colStart + 1],
-        m_data[colStart + 2],
-        m_data[colStart + 3]);
-}
-
-void Matrix4f::setCol(int j, const Vector4f &v)
-{
-    int colStart = 4 * j;
-
-    m_data[colStart] = v.x();
-    m_data[colStart + 1] = v.y();
-    m_data[colStart + 2] = v.z();
-    m_data[colStart + 3] = v.w();
-}
+static_assert(Matrix4f::translation(1.0f, 2.0f, 3.0f).getTranslation().y() == 2.0f, "Matrix4f construction must be constexpr");
 
 Matrix2f Matrix4f::getSubmatrix2x2(int i0, int j0) const
 {
@@ -149,21 +24,6 @@ Matrix2f Matrix4f::getSubmatrix2x2(int i0, int j0) const
     return out;
 }
 
-Matrix3f Matrix4f::getSubmatrix3x3(int i0, int j0) const
-{
-    Matrix3f out;
-
-    for (int i = 0; i < 3; ++i)
-    {
-        for (int j = 0; j < 3; ++j)
-        {
-            out(i, j) = (*this)(i + i0, j + j0);
-        }
-    }
-
-    return out;
-}
-
 void Matrix4f::setSubmatrix2x2(int i0, int j0, const Matrix2f &m)
 {
     for (int i = 0; i < 2; ++i)
@@ -175,17 +35,6 @@ void Matrix4f::setSubmatrix2x2(int i0, int j0, const Matrix2f &m)
     }
 }
 
-void Matrix4f::setSubmatrix3x3(int i0, int j0, const Matrix3f &m)
-{
-    for (int i = 0; i < 3; ++i)
-    {
-        for (int j = 0; j < 3; ++j)
-        {
-            (*this)(i + i0, j + j0) = m(i, j);
-        }
-    }
-}
-
 float Matrix4f::determinant() const
 {
     float m00 = m_data[0];
@@ -218,154 +67,17 @@ float Matrix4f::determinant() const
 
 Matrix4f Matrix4f::inverse(bool *pbIsSingular, float epsilon) const
 {
-    float m00 = m_data[0];
-    float m10 = m_data[1];
-    float m20 = m_data[2];
-    float m30 = m_data[3];
-
-    float m01 = m_data[4];
-    float m11 = m_data[5];
-    float m21 = m_data[6];
-    float m31 = m_data[7];
-
-    float m02 = m_data[8];
-    float m12 = m_data[9];
-    float m22 = m_data[10];
-    float m32 = m_data[11];
-
-    float m03 = m_data[12];
-    float m13 = m_data[13];
-    float m23 = m_data[14];
-    float m33 = m_data[15];
-
-    float cofactor00 = Matrix3f::determinant3x3(m11, m12, m13, m21, m22, m23, m31, m32, m33);
-    float cofactor01 = -Matrix3f::determinant3x3(m12, m13, m10, m22, m23, m20, m32, m33, m30);
-    float cofactor02 = Matrix3f::determinant3x3(m13, m10, m11, m23, m20, m21, m33, m30, m31);
-    float cofactor03 = -Matrix3f::determinant3x3(m10, m11, m12, m20, m21, m22, m30, m31, m32);
-
-    float cofactor10 = -Matrix3f::determinant3x3(m21, m22, m23, m31, m32, m33, m01, m02, m03);
-    float cofactor11 = Matrix3f::determinant3x3(m22, m23, m20, m32, m33, m30, m02, m03, m00);
-    float cofactor12 = -Matrix3f::determinant3x3(m23, m20, m21, m33, m30, m31, m03, m00, m01);
-    float cofactor13 = Matrix3f::determinant3x3(m20, m21, m22, m30, m31, m32, m00, m01, m02);
-
-    float cofactor20 = Matrix3f::determinant3x3(m31, m32, m33, m01, m02, m03, m11, m12, m13);
-    float cofactor21 = -Matrix3f::determinant3x3(m32, m33, m30, m02, m03, m00, m12, m13, m10);
-    float cofactor22 = Matrix3f::determinant3x3(m33, m30, m31, m03, m00, m01, m13, m10, m11);
-    float cofactor23 = -Matrix3f::determinant3x3(m30, m31, m32, m00, m01, m02, m10, m11, m12);
-
-    float cofactor30 = -Matrix3f::determinant3x3(m01, m02, m03, m11, m12, m13, m21, m22, m23);
-    float cofactor31 = Matrix3f::determinant3x3(m02, m03, m00, m12, m13, m10, m22, m23, m20);
-    float cofactor32 = -Matrix3f::determinant3x3(m03, m00, m01, m13, m10, m11, m23, m20, m21);
-    float cofactor33 = Matrix3f::determinant3x3(m00, m01, m02, m10, m11, m12, m20, m21, m22);
-
-    float determinant = m00 * cofactor00 + m01 * cofactor01 + m02 * cofactor02 + m03 * cofactor03;
+    Matrix4f result;
+    float determinant = MathSIMD::InverseMat4(m_data, result.m_data);
 
     bool isSingular = (fabs(determinant) < epsilon);
-    if (isSingular)
-    {
-        if (pbIsSingular != NULL)
-        {
-            *pbIsSingular = true;
-        }
-        return Matrix4f();
-    }
-    else
+    if (pbIsSingular != NULL)
     {
-        if (pbIsSingular != NULL)
-        {
-            *pbIsSingular = false;
-        }
-
-        float reciprocalDeterminant = 1.0f / determinant;
-
-        return Matrix4f(
-            cofactor00 * reciprocalDeterminant, cofactor10 * reciprocalDeterminant, cofactor20 * reciprocalDeterminant, cofactor30 * reciprocalDeterminant,
-            cofactor01 * reciprocalDeterminant, cofactor11 * reciprocalDeterminant, cofactor21 * reciprocalDeterminant, cofactor31 * reciprocalDeterminant,
-            cofactor02 * reciprocalDeterminant, cofactor12 * reciprocalDeterminant, cofactor22 * reciprocalDeterminant, cofactor32 * reciprocalDeterminant,
-            cofactor03 * reciprocalDeterminant, cofactor13 * reciprocalDeterminant, cofactor23 * reciprocalDeterminant, cofactor33 * reciprocalDeterminant);
+        *pbIsSingular = isSingular;
     }
+    return isSingular ? Matrix4f() : result;
 }
 
-void Matrix4f::transpose()
-{
-    float temp;
-
-    for (int i = 0; i < 3; ++i)
-    {
-        for (int j = i + 1; j < 4; ++j)
-        {
-            temp = (*this)(i, j);
-            (*this)(i, j) = (*this)(j, i);
-            (*this)(j, i) = temp;
-        }
-    }
-}
-
-Matrix4f Matrix4f::transposed() const
-{
-    Matrix4f out;
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            out(j, i) = (*this)(i, j);
-        }
-    }
-
-    return out;
-}
-
-Matrix4f Matrix4f::ones()
-{
-    Matrix4f m;
-    for (int i = 0; i < 16; ++i)
-    {
-        m.m_data[i] = 1;
-    }
-
-    return m;
-}
-
-Matrix4f Matrix4f::identity()
-{
-    Matrix4f m;
-
-    m(0, 0) = 1;
-    m(1, 1) = 1;
-    m(2, 2) = 1;
-    m(3, 3) = 1;
-
-    return m;
-}
-
-Matrix4f Matrix4f::translation(float x, float y, float z)
-{
-    return Matrix4f(
-        1, 0, 0, x,
-        0, 1, 0, y,
-        0, 0, 1, z,
-        0, 0, 0, 1);
-}
-
-Matrix4f Matrix4f::translation(const Vector3f &rTranslation)
-{
-    return Matrix4f(
-        1, 0, 0, rTranslation.x(),
-        0, 1, 0, rTranslation.y(),
-        0, 0, 1, rTranslation.z(),
-        0, 0, 0, 1);
-}
-Vector3f Matrix4f::getTranslation() const
-{
-    return Vector3f(m_data[12], m_data[13], m_data[14]);
-}
-Vector3f Matrix4f::getScale() const
-{
-    float sx = Vector3f(m_data[0], m_data[1], m_data[2]).Length();
-    float sy = Vector3f(m_data[4], m_data[5], m_data[6]).Length();
-    float sz = Vector3f(m_data[8], m_data[9], m_data[10]).Length();
-    return Vector3f(sx, sy, sz);
-}
 Quat4f Matrix4f::getRotation() const
 {
     Vector3f scale = getScale();
@@ -477,48 +189,6 @@ Matrix4f Matrix4f::rotation(const Vector3f &rVector)
     return Matrix4f::rotation(rVector, rVector.Length());
 }
 
-Matrix4f Matrix4f::rotation(const Quat4f &q)
-{
-    Quat4f qq = q.normalized();
-
-    float xx = qq.x() * qq.x();
-    float yy = qq.y() * qq.y();
-    float zz = qq.z() * qq.z();
-
-    float xy = qq.x() * qq.y();
-    float zw = qq.z() * qq.w();
-
-    float xz = qq.x() * qq.z();
-    float yw = qq.y() * qq.w();
-
-    float yz = qq.y() * qq.z();
-    float xw = qq.x() * qq.w();
-
-    return Matrix4f(
-        1.0f - 2.0f * (yy + zz), 2.0f * (xy - zw), 2.0f * (xz + yw), 0.0f,
-        2.0f * (xy + zw), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - xw), 0.0f,
-        2.0f * (xz - yw), 2.0f * (yz + xw), 1.0f - 2.0f * (xx + yy), 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f);
-}
-
-Matrix4f Matrix4f::scaling(float sx, float sy, float sz)
-{
-    return Matrix4f(
-        sx, 0, 0, 0,
-        0, sy, 0, 0,
-        0, 0, sz, 0,
-        0, 0, 0, 1);
-}
-
-Matrix4f Matrix4f::uniformScaling(float s)
-{
-    return Matrix4f(
-        s, 0, 0, 0,
-        0, s, 0, 0,
-        0, 0, s, 0,
-        0, 0, 0, 1);
-}
-
 Matrix4f Matrix4f::randomRotation(float u0, float u1, float u2)
 {
     return Matrix4f::rotation(Quat4f::randomRotation(u0, u1, u2));
@@ -677,55 +347,3 @@ Matrix4f Matrix4f::infinitePerspectiveProjection(float fLeft, float fRight,
 
     return projection;
 }
-
-Matrix4f Matrix4f::scale(const Vector3f &scale)
-{
-    Matrix4f m = Matrix4f::identity();
-
-    m(0, 0) = scale.x();
-    m(1, 1) = scale.y();
-    m(2, 2) = scale.z();
-
-    return m;
-}
-Matrix4f Matrix4f::CreateTransform(const Vector3f &pos, const Quat4f &rot, const Vector3f &sc)
-{
-    return translation(pos) * rotation(rot) * scale(sc);
-}
-
-//////////////////////////////////////////////////////////////////////////
-// Operators
-//////////////////////////////////////////////////////////////////////////
-
-Vector4f operator*(const Matrix4f &m, const Vector4f &v)
-{
-    Vector4f output(0, 0, 0, 0);
-
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            output[i] += m(i, j) * v[j];
-        }
-    }
-
-    return output;
-}
-
-Matrix4f operator*(const Matrix4f &x, const Matrix4f &y)
-{
-    Matrix4f product; // zeroes
-
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            for (int k = 0; k < 4; ++k)
-            {
-                product(i, k) += x(i, j) * y(j, k);
-            }
-        }
-    }
-
-    return product;
-}
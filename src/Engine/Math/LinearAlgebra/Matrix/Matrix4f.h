@@ -2,67 +2,88 @@
 #include <cstdio>
 #include "raylib.h"
 #include "raymath.h"
-#include <string.h>
+#include "Matrix3f.h"
+#include "Quat4f.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector4f.h"
 
 class Matrix2f;
-class Matrix3f;
-class Quat4f;
-class Vector3f;
-class Vector4f;
 
+// 列主序存储, 构造/元素访问/乘法/CreateTransform 在头文件内联; 求逆与投影矩阵仍在 Matrix4f.cpp
+// 乘法与求逆经 MathSIMD 内核, 桌面平台走 SSE
 class Matrix4f
 {
 public:
-	Matrix4f(float fill = 0.f);
-	Matrix4f(float m00, float m01, float m02, float m03,
-			 float m10, float m11, float m12, float m13,
-			 float m20, float m21, float m22, float m23,
-			 float m30, float m31, float m32, float m33);
+	constexpr Matrix4f(float fill = 0.f)
+		: m_data{fill, fill, fill, fill, fill, fill, fill, fill, fill, fill, fill, fill, fill, fill, fill, fill} {}
+	constexpr Matrix4f(float m00, float m01, float m02, float m03,
+					   float m10, float m11, float m12, float m13,
+					   float m20, float m21, float m22, float m23,
+					   float m30, float m31, float m32, float m33)
+		: m_data{m00, m10, m20, m30, m01, m11, m21, m31, m02, m12, m22, m32, m03, m13, m23, m33} {}
 
 	// setColumns = true ==> sets the columns of the matrix to be [v0 v1 v2 v3]
-	Matrix4f(const Vector4f &v0, const Vector4f &v1, const Vector4f &v2, const Vector4f &v3, bool setColumns = true);
-
-	Matrix4f(const Matrix4f &rm);
-	Matrix4f(const Matrix3f &rm)
+	constexpr Matrix4f(const Vector4f &v0, const Vector4f &v1, const Vector4f &v2, const Vector4f &v3, bool setColumns = true) : m_data{}
 	{
-		memset(m_data, 0, sizeof(m_data));
+		if (setColumns)
+		{
+			setCol(0, v0);
+			setCol(1, v1);
+			setCol(2, v2);
+			setCol(3, v3);
+		}
+		else
+		{
+			setRow(0, v0);
+			setRow(1, v1);
+			setRow(2, v2);
+			setRow(3, v3);
+		}
+	}
 
+	constexpr Matrix4f(const Matrix4f &rm) = default;
+	constexpr Matrix4f(const Matrix3f &rm) : m_data{}
+	{
 		m_data[15] = 1.f;
 		setSubmatrix3x3(0, 0, rm);
 	}
-	Matrix4f &operator=(const Matrix4f &rm);
-	Matrix4f &operator/=(float d);
-	Matrix4f(const Matrix &rm)
+	constexpr Matrix4f &operator=(const Matrix4f &rm) = default;
+	constexpr Matrix4f &operator/=(float d)
 	{
-		m_data[0] = rm.m0;
-		m_data[1] = rm.m1;
-		m_data[2] = rm.m2;
-		m_data[3] = rm.m3;
-
-		m_data[4] = rm.m4;
-		m_data[5] = rm.m5;
-		m_data[6] = rm.m6;
-		m_data[7] = rm.m7;
-
-		m_data[8] = rm.m8;
-		m_data[9] = rm.m9;
-		m_data[10] = rm.m10;
-		m_data[11] = rm.m11;
-
-		m_data[12] = rm.m12;
-		m_data[13] = rm.m13;
-		m_data[14] = rm.m14;
-		m_data[15] = rm.m15;
+		for (int ii = 0; ii < 16; ii++)
+		{
+			m_data[ii] /= d;
+		}
+		return *this;
 	}
+	constexpr Matrix4f(const Matrix &rm)
+		: m_data{rm.m0, rm.m1, rm.m2, rm.m3, rm.m4, rm.m5, rm.m6, rm.m7,
+				 rm.m8, rm.m9, rm.m10, rm.m11, rm.m12, rm.m13, rm.m14, rm.m15} {}
 
-	const float &operator()(int i, int j) const;
-	float &operator()(int i, int j);
+	constexpr const float &operator()(int i, int j) const { return m_data[j * 4 + i]; }
+	constexpr float &operator()(int i, int j) { return m_data[j * 4 + i]; }
 
-	Vector4f getRow(int i) const;
-	void setRow(int i, const Vector4f &v);
+	constexpr Vector4f getRow(int i) const { return Vector4f(m_data[i], m_data[i + 4], m_data[i + 8], m_data[i + 12]); }
+	constexpr void setRow(int i, const Vector4f &v)
+	{
+		m_data[i] = v.x();
+		m_data[i + 4] = v.y();
+		m_data[i + 8] = v.z();
+		m_data[i + 12] = v.w();
+	}
 
-	Vector4f getCol(int j) const;
-	void setCol(int j, const Vector4f &v);
+	constexpr Vector4f getCol(int j) const
+	{
+		return Vector4f(m_data[4 * j], m_data[4 * j + 1], m_data[4 * j + 2], m_data[4 * j + 3]);
+	}
+	constexpr void setCol(int j, const Vector4f &v)
+	{
+		m_data[4 * j] = v.x();
+		m_data[4 * j + 1] = v.y();
+		m_data[4 * j + 2] = v.z();
+		m_data[4 * j + 3] = v.w();
+	}
 
 	// gets the 2x2 submatrix of this matrix to m
 	// starting with upper left corner at (i0, j0)
@@ -70,7 +91,18 @@ public:
 
 	// gets the 3x3 submatrix of this matrix to m
 	// starting with upper left corner at (i0, j0)
-	Matrix3f getSubmatrix3x3(int i0, int j0) const;
+	constexpr Matrix3f getSubmatrix3x3(int i0, int j0) const
+	{
+		Matrix3f out;
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				out(i, j) = (*this)(i + i0, j + j0);
+			}
+		}
+		return out;
+	}
 
 	// sets a 2x2 submatrix of this matrix to m
 	// starting with upper left corner at (i0, j0)
@@ -78,29 +110,77 @@ public:
 
 	// sets a 3x3 submatrix of this matrix to m
 	// starting with upper left corner at (i0, j0)
-	void setSubmatrix3x3(int i0, int j0, const Matrix3f &m);
+	constexpr void setSubmatrix3x3(int i0, int j0, const Matrix3f &m)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				(*this)(i + i0, j + j0) = m(i, j);
+			}
+		}
+	}
 
 	float determinant() const;
 	Matrix4f inverse(bool *pbIsSingular = NULL, float epsilon = 0.f) const;
 
-	void transpose();
-	Matrix4f transposed() const;
+	constexpr void transpose()
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = i + 1; j < 4; ++j)
+			{
+				float temp = (*this)(i, j);
+				(*this)(i, j) = (*this)(j, i);
+				(*this)(j, i) = temp;
+			}
+		}
+	}
+	constexpr Matrix4f transposed() const
+	{
+		Matrix4f out(*this);
+		out.transpose();
+		return out;
+	}
 
-	Vector3f getTranslation() const;
-	Vector3f getScale() const;
+	constexpr Vector3f getTranslation() const { return Vector3f(m_data[12], m_data[13], m_data[14]); }
+	Vector3f getScale() const
+	{
+		float sx = Vector3f(m_data[0], m_data[1], m_data[2]).Length();
+		float sy = Vector3f(m_data[4], m_data[5], m_data[6]).Length();
+		float sz = Vector3f(m_data[8], m_data[9], m_data[10]).Length();
+		return Vector3f(sx, sy, sz);
+	}
 	Quat4f getRotation() const;
 
-	static Matrix4f ones();
-	static Matrix4f identity();
-	static Matrix4f translation(float x, float y, float z);
-	static Matrix4f translation(const Vector3f &rTranslation);
+	static constexpr Matrix4f ones() { return Matrix4f(1.0f); }
+	static constexpr Matrix4f identity() { return scaling(1.0f, 1.0f, 1.0f); }
+	static constexpr Matrix4f translation(float x, float y, float z)
+	{
+		return Matrix4f(
+			1, 0, 0, x,
+			0, 1, 0, y,
+			0, 0, 1, z,
+			0, 0, 0, 1);
+	}
+	static constexpr Matrix4f translation(const Vector3f &rTranslation)
+	{
+		return translation(rTranslation.x(), rTranslation.y(), rTranslation.z());
+	}
 	static Matrix4f rotateX(float radians);
 	static Matrix4f rotateY(float radians);
 	static Matrix4f rotateZ(float radians);
 	static Matrix4f rotation(const Vector3f &rDirection, float radians);
 	static Matrix4f rotation(const Vector3f &rVector);
-	static Matrix4f scaling(float sx, float sy, float sz);
-	static Matrix4f uniformScaling(float s);
+	static constexpr Matrix4f scaling(float sx, float sy, float sz)
+	{
+		return Matrix4f(
+			sx, 0, 0, 0,
+			0, sy, 0, 0,
+			0, 0, sz, 0,
+			0, 0, 0, 1);
+	}
+	static constexpr Matrix4f uniformScaling(float s) { return scaling(s, s, s); }
 	static Matrix4f lookAt(const Vector3f &eye, const Vector3f &center, const Vector3f &up);
 	static Matrix4f orthographicProjection(float width, float height, float zNear, float zFar, bool directX);
 	static Matrix4f orthographicProjection(float left, float right, float bottom, float top, float zNear, float zFar, bool directX);
@@ -110,13 +190,16 @@ public:
 	static Matrix4f CreateTransform(const Vector3f &translation, const Quat4f &rotation, const Vector3f &scale);
 	// Returns the rotation matrix represented by a quaternion
 	// uses a normalized version of q
-	static Matrix4f rotation(const Quat4f &q);
-	static Matrix4f scale(const Vector3f &scale);
+	static Matrix4f rotation(const Quat4f &q) { return Matrix4f(q.normalized().toMatrix()); }
+	static constexpr Matrix4f scale(const Vector3f &scale) { return scaling(scale.x(), scale.y(), scale.z()); }
 	// returns an orthogonal matrix that's a uniformly distributed rotation
 	// given u[i] is a uniformly distributed random number in [0,1]
 	static Matrix4f randomRotation(float u0, float u1, float u2);
 
-	operator Matrix() const
+	constexpr const float *data() const { return m_data; }
+	constexpr float *data() { return m_data; }
+
+	constexpr operator Matrix() const
 	{
 		return Matrix{
 			m_data[0], m_data[4], m_data[8], m_data[12],
@@ -129,6 +212,27 @@ private:
 	float m_data[16];
 };
 
-Vector4f operator*(const Matrix4f &m, const Vector4f &v);
+inline Vector4f operator*(const Matrix4f &m, const Vector4f &v)
+{
+	Vector4f output;
+	MathSIMD::MulMat4Vec4(m.data(), v.data(), output.data());
+	return output;
+}
 
-Matrix4f operator*(const Matrix4f &x, const Matrix4f &y);
+inline Matrix4f operator*(const Matrix4f &x, const Matrix4f &y)
+{
+	Matrix4f product;
+	MathSIMD::MulMat4(x.data(), y.data(), product.data());
+	return product;
+}
+
+// 与 translation(pos) * rotation(rot) * scale(sc) 结果一致, 直接按列写出, 省去两次 4x4 乘法
+inline Matrix4f Matrix4f::CreateTransform(const Vector3f &pos, const Quat4f &rot, const Vector3f &sc)
+{
+	Matrix4f m(rot.normalized().toMatrix());
+	m.setCol(0, m.getCol(0) * sc.x());
+	m.setCol(1, m.getCol(1) * sc.y());
+	m.setCol(2, m.getCol(2) * sc.z());
+	m.setCol(3, Vector4f(pos, 1.0f));
+	return m;
+}
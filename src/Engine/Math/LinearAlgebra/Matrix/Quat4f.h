@@ -1,57 +1,96 @@
 #pragma once
-class Vector3f;
-class Vector4f;
-
 #include "Matrix3f.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector3f.h"
+#include "Engine/Math/LinearAlgebra/Vector/Vector4f.h"
 #include "raylib.h"
 #include "raymath.h"
 
+#include <cmath>
 #include <iostream>
+// 乘法/旋转/归一化等热路径在头文件内联, 插值与对数等仍在 Quat4f.cpp
 class Quat4f
 {
 public:
     static const Quat4f ZERO;
     static const Quat4f IDENTITY;
 
-    Quat4f();
+    constexpr Quat4f() : m_data{0, 0, 0, 0} {}
 
     // q = w + x * i + y * j + z * k
-    Quat4f(float w, float x, float y, float z);
+    constexpr Quat4f(float w, float x, float y, float z) : m_data{w, x, y, z} {}
 
-    Quat4f(const Quat4f &rq);
-    Quat4f &operator=(const Quat4f &rq);
+    constexpr Quat4f(const Quat4f &rq) = default;
+    constexpr Quat4f &operator=(const Quat4f &rq) = default;
 
     // Euler角初始化
     Quat4f(const Vector3f &v);
 
     // copies the components of a Vector4f directly into this quaternion
-    Quat4f(const Vector4f &v);
-
-    const float &operator[](int i) const;
-    float &operator[](int i);
-
-    float w() const;
-    float x() const;
-    float y() const;
-    float z() const;
-    Vector3f xyz() const;
-    Vector4f wxyz() const;
-
-    float abs() const;
-    float absSquared() const;
-    void normalize();
-    Quat4f normalized() const;
-
-    void conjugate();
-    Quat4f conjugated() const;
-
-    void invert();
-    Quat4f inverse() const;
+    constexpr Quat4f(const Vector4f &v) : m_data{v[0], v[1], v[2], v[3]} {}
+
+    constexpr const float &operator[](int i) const { return m_data[i]; }
+    constexpr float &operator[](int i) { return m_data[i]; }
+
+    constexpr float w() const { return m_data[0]; }
+    constexpr float x() const { return m_data[1]; }
+    constexpr float y() const { return m_data[2]; }
+    constexpr float z() const { return m_data[3]; }
+    constexpr Vector3f xyz() const { return Vector3f(m_data[1], m_data[2], m_data[3]); }
+    constexpr Vector4f wxyz() const { return Vector4f(m_data[0], m_data[1], m_data[2], m_data[3]); }
+
+    float abs() const { return std::sqrt(absSquared()); }
+    constexpr float absSquared() const
+    {
+        return (m_data[0] * m_data[0] + m_data[1] * m_data[1] + m_data[2] * m_data[2] + m_data[3] * m_data[3]);
+    }
+    void normalize()
+    {
+        float reciprocalAbs = 1.f / abs();
+
+        m_data[0] *= reciprocalAbs;
+        m_data[1] *= reciprocalAbs;
+        m_data[2] *= reciprocalAbs;
+        m_data[3] *= reciprocalAbs;
+    }
+    Quat4f normalized() const
+    {
+        Quat4f q(*this);
+        q.normalize();
+        return q;
+    }
+
+    constexpr void conjugate()
+    {
+        m_data[1] = -m_data[1];
+        m_data[2] = -m_data[2];
+        m_data[3] = -m_data[3];
+    }
+    constexpr Quat4f conjugated() const { return Quat4f(m_data[0], -m_data[1], -m_data[2], -m_data[3]); }
+
+    constexpr void invert() { *this = inverse(); }
+    constexpr Quat4f inverse() const;
 
     Quat4f log() const;
     Quat4f exp() const;
 
-    Matrix3f toMatrix() const;
+    constexpr Matrix3f toMatrix() const
+    {
+        float xx = x() * x();
+        float yy = y() * y();
+        float zz = z() * z();
+        float xy = x() * y();
+        float xz = x() * z();
+        float yz = y() * z();
+        float wx = w() * x();
+        float wy = w() * y();
+        float wz = w() * z();
+
+        return Matrix3f(
+            1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy),
+            2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx),
+            2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy));
+    }
 
     // returns unit vector for rotation and radians about the unit vector
     Vector3f getAxisAngle(float *radiansOut) const;
@@ -59,7 +98,10 @@ public:
     // sets this quaternion to be a rotation of fRadians about v = < fx, fy, fz >, v need not necessarily be unit length
     void setAxisAngle(float radians, const Vector3f &axis);
 
-    static float dot(const Quat4f &q0, const Quat4f &q1);
+    static constexpr float dot(const Quat4f &q0, const Quat4f &q1)
+    {
+        return (q0.w() * q1.w() + q0.x() * q1.x() + q0.y() * q1.y() + q0.z() * q1.z());
+    }
 
     static Quat4f lerp(const Quat4f &q0, const Quat4f &q1, float alpha);
     // spherical linear interpolation
@@ -92,13 +134,48 @@ public:
     void print() const { std::cout << "Quat4f: " << m_data[0] << " " << m_data[1] << " " << m_data[2] << " " << m_data[3] << std::endl; };
     operator Quaternion() const { return {m_data[1], m_data[2], m_data[3], m_data[0]}; }
 
+    // (w, x, y, z)
+    constexpr const float *data() const { return m_data; }
+    constexpr float *data() { return m_data; }
+
 private:
     float m_data[4];
 };
 
-Quat4f operator+(const Quat4f &q0, const Quat4f &q1);
-Quat4f operator-(const Quat4f &q0, const Quat4f &q1);
-Quat4f operator*(const Quat4f &q0, const Quat4f &q1);
-Quat4f operator*(float f, const Quat4f &q);
-Quat4f operator*(const Quat4f &q, float f);
-Vector3f operator*(const Quat4f &q, const Vector3f &v); // 旋转向量
+constexpr Quat4f operator+(const Quat4f &q0, const Quat4f &q1)
+{
+    return Quat4f(q0.w() + q1.w(), q0.x() + q1.x(), q0.y() + q1.y(), q0.z() + q1.z());
+}
+constexpr Quat4f operator-(const Quat4f &q0, const Quat4f &q1)
+{
+    return Quat4f(q0.w() - q1.w(), q0.x() - q1.x(), q0.y() - q1.y(), q0.z() - q1.z());
+}
+inline Quat4f operator*(const Quat4f &q0, const Quat4f &q1)
+{
+    Quat4f product;
+    MathSIMD::MulQuat(q0.data(), q1.data(), product.data());
+    return product;
+}
+constexpr Quat4f operator*(float f, const Quat4f &q)
+{
+    return Quat4f(f * q.w(), f * q.x(), f * q.y(), f * q.z());
+}
+constexpr Quat4f operator*(const Quat4f &q, float f)
+{
+    return Quat4f(f * q.w(), f * q.x(), f * q.y(), f * q.z());
+}
+// 旋转向量
+constexpr Vector3f operator*(const Quat4f &q, const Vector3f &v)
+{
+    Vector3f q_xyz(q.x(), q.y(), q.z());
+
+    // t = 2 * cross(q_xyz, v)
+    Vector3f t = q_xyz ^ v * 2.0f;
+    // result = v + (q.w * t) + cross(q_xyz, t)
+    return v + (t * q.w()) + (q_xyz ^ t);
+}
+
+constexpr Quat4f Quat4f::inverse() const
+{
+    return conjugated() * (1.0f / absSquared());
+}
@@ -1,6 +1,8 @@
 #pragma once
 #include "raylib.h"
 #include "raymath.h"
+#include <cmath>
+#include <stdexcept>
 class Vector2f
 {
 public:
@@ -8,67 +10,159 @@ public:
     static const Vector2f UP;
     static const Vector2f RIGHT;
 
-    Vector2f(const Vector2& v) {
-        m_data[0] = v.x;
-        m_data[1] = v.y;
-    }
-    Vector2f(const Vector2f &other);
-    Vector2f(float val = 0.0f);
-    Vector2f(float x, float y);
+    constexpr Vector2f(const Vector2 &v) : m_data{v.x, v.y} {}
+    constexpr Vector2f(const Vector2f &other) = default;
+    constexpr Vector2f(float val = 0.0f) : m_data{val, val} {}
+    constexpr Vector2f(float x, float y) : m_data{x, y} {}
 
-    Vector2f &operator=(const Vector2f &other);
+    constexpr Vector2f &operator=(const Vector2f &other) = default;
 
-    Vector2f &operator+=(const Vector2f &other);
-    Vector2f &operator-=(const Vector2f &other);
-    Vector2f &operator*=(float scalar);
-    Vector2f &operator/=(float scalar);
+    constexpr Vector2f &operator+=(const Vector2f &other)
+    {
+        m_data[0] += other.m_data[0];
+        m_data[1] += other.m_data[1];
+        return *this;
+    }
+    constexpr Vector2f &operator-=(const Vector2f &other)
+    {
+        m_data[0] -= other.m_data[0];
+        m_data[1] -= other.m_data[1];
+        return *this;
+    }
+    constexpr Vector2f &operator*=(float scalar)
+    {
+        m_data[0] *= scalar;
+        m_data[1] *= scalar;
+        return *this;
+    }
+    constexpr Vector2f &operator/=(float scalar)
+    {
+        m_data[0] /= scalar;
+        m_data[1] /= scalar;
+        return *this;
+    }
 
-    const float &operator[](int i) const;
-    float &operator[](int i);
+    constexpr const float &operator[](int i) const { return m_data[i]; }
+    constexpr float &operator[](int i) { return m_data[i]; }
 
-    float &x();
-    float &y();
+    constexpr float &x() { return m_data[0]; }
+    constexpr float &y() { return m_data[1]; }
 
-    float x() const;
-    float y() const;
+    constexpr float x() const { return m_data[0]; }
+    constexpr float y() const { return m_data[1]; }
 
-    Vector2f xy() const;
-    Vector2f yx() const;
-    Vector2f xx() const;
-    Vector2f yy() const;
+    constexpr Vector2f xy() const { return *this; }
+    constexpr Vector2f yx() const { return Vector2f(m_data[1], m_data[0]); }
+    constexpr Vector2f xx() const { return Vector2f(m_data[0], m_data[0]); }
+    constexpr Vector2f yy() const { return Vector2f(m_data[1], m_data[1]); }
 
     // returns (-y,x)
-    Vector2f Normal() const;
-
-    float Length() const;
-    float LengthSquared() const;
-    void Normalize();
-    Vector2f Normalized() const;
+    constexpr Vector2f Normal() const { return Vector2f(-m_data[1], m_data[0]); }
+
+    float Length() const { return std::sqrt(LengthSquared()); }
+    constexpr float LengthSquared() const { return m_data[0] * m_data[0] + m_data[1] * m_data[1]; }
+    void Normalize()
+    {
+        float len = Length();
+        if (len > 0.0f)
+        {
+            m_data[0] /= len;
+            m_data[1] /= len;
+        }
+    }
+    Vector2f Normalized() const
+    {
+        Vector2f result(*this);
+        result.Normalize();
+        return result;
+    }
 
-    void Negate();
+    constexpr void Negate()
+    {
+        m_data[0] = -m_data[0];
+        m_data[1] = -m_data[1];
+    }
 
     static float Distance(const Vector2f &a, const Vector2f &b);
-    static Vector2f Lerp(const Vector2f &a, const Vector2f &b, float t);
+    static constexpr Vector2f Lerp(const Vector2f &a, const Vector2f &b, float t);
+
+    constexpr operator Vector2() const { return {m_data[0], m_data[1]}; }
 
-    operator Vector2() const{return {m_data[0], m_data[1]};}
 private:
     float m_data[2];
 };
 
 // 逐分量
-Vector2f operator+(const Vector2f &v0, const Vector2f &v1);
-Vector2f operator-(const Vector2f &v0, const Vector2f &v1);
-Vector2f operator&(const Vector2f &v0, const Vector2f &v1); // 逐分量乘法
-Vector2f operator/(const Vector2f &v0, const Vector2f &v1); // 逐分量除法
+constexpr Vector2f operator+(const Vector2f &v0, const Vector2f &v1)
+{
+    return Vector2f(v0.x() + v1.x(), v0.y() + v1.y());
+}
+constexpr Vector2f operator-(const Vector2f &v0, const Vector2f &v1)
+{
+    return Vector2f(v0.x() - v1.x(), v0.y() - v1.y());
+}
+// 逐分量乘法
+constexpr Vector2f operator&(const Vector2f &v0, const Vector2f &v1)
+{
+    return Vector2f(v0.x() * v1.x(), v0.y() * v1.y());
+}
+// 逐分量除法
+constexpr Vector2f operator/(const Vector2f &v0, const Vector2f &v1)
+{
+    return Vector2f(v0.x() / v1.x(), v0.y() / v1.y());
+}
 
-float operator*(const Vector2f &v0, const Vector2f &v1); // 点乘
-float operator^(const Vector2f &v0, const Vector2f &v1); // 叉乘
+// 点乘
+constexpr float operator*(const Vector2f &v0, const Vector2f &v1)
+{
+    return v0.x() * v1.x() + v0.y() * v1.y();
+}
+// 叉乘
+constexpr float operator^(const Vector2f &v0, const Vector2f &v1)
+{
+    return v0.x() * v1.y() - v0.y() * v1.x();
+}
 
-Vector2f operator-(const Vector2f &v);
+constexpr Vector2f operator-(const Vector2f &v)
+{
+    return Vector2f(-v.x(), -v.y());
+}
 
-Vector2f operator*(float f, const Vector2f &v);
-Vector2f operator*(const Vector2f &v, float f);
-Vector2f operator/(const Vector2f &v, float f);
+constexpr Vector2f operator*(float f, const Vector2f &v)
+{
+    return Vector2f(v.x() * f, v.y() * f);
+}
+constexpr Vector2f operator*(const Vector2f &v, float f)
+{
+    return Vector2f(v.x() * f, v.y() * f);
+}
+constexpr Vector2f operator/(const Vector2f &v, float f)
+{
+    if (f == 0.0f)
+    {
+        // TODO:无限远向量
+        throw std::runtime_error("Division by zero in Vector2f operator/");
+    }
+    return Vector2f(v.x() / f, v.y() / f);
+}
 
-bool operator==(const Vector2f &v0, const Vector2f &v1);
-bool operator!=(const Vector2f &v0, const Vector2f &v1);
+inline float Vector2f::Distance(const Vector2f &a, const Vector2f &b)
+{
+    return (a - b).Length();
+}
+
+constexpr Vector2f Vector2f::Lerp(const Vector2f &a, const Vector2f &b, float t)
+{
+    // Clamp t to [0, 1]
+    t = (t < 0.0f) ? 0.0f : (t > 1.0f ? 1.0f : t);
+    return t * b + (1 - t) * a;
+}
+
+inline bool operator==(const Vector2f &v0, const Vector2f &v1)
+{
+    return Vector2f::Distance(v0, v1) < 1e-5f;
+}
+inline bool operator!=(const Vector2f &v0, const Vector2f &v1)
+{
+    return !(v0 == v1);
+}
@@ -1,11 +1,15 @@
 #pragma once
 #include "raylib.h"
 #include "raymath.h"
+#include "Vector2f.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
-class Vector2f;
+#include <stdexcept>
 
 using json = nlohmann::json;
+// 运算都在头文件内联, 热路径上不再产生函数调用, 编译器可以合并/向量化
 class Vector3f
 {
 public:
@@ -15,15 +19,10 @@ public:
     static const Vector3f FORWARD;
     static const Vector3f ONE;
 
-    Vector3f(const Vector3 &v)
-    {
-        m_data[0] = v.x;
-        m_data[1] = v.y;
-        m_data[2] = v.z;
-    }
-    Vector3f(const Vector3f &other);
-    Vector3f(float val = 0.0f);
-    Vector3f(float x, float y, float z);
+    constexpr Vector3f(const Vector3 &v) : m_data{v.x, v.y, v.z} {}
+    constexpr Vector3f(const Vector3f &other) = default;
+    constexpr Vector3f(float val = 0.0f) : m_data{val, val, val} {}
+    constexpr Vector3f(float x, float y, float z) : m_data{x, y, z} {}
     Vector3f(const json &arr)
     {
         if (arr.size() >= 3)
@@ -34,53 +33,102 @@ public:
         }
     }
 
-    Vector3f &operator=(const Vector3f &other);
+    constexpr Vector3f &operator=(const Vector3f &other) = default;
 
-    Vector3f &operator+=(const Vector3f &other);
-    Vector3f &operator-=(const Vector3f &other);
-    Vector3f &operator*=(float scalar);
-    Vector3f &operator/=(float scalar);
+    constexpr Vector3f &operator+=(const Vector3f &other)
+    {
+        m_data[0] += other.m_data[0];
+        m_data[1] += other.m_data[1];
+        m_data[2] += other.m_data[2];
+        return *this;
+    }
+    constexpr Vector3f &operator-=(const Vector3f &other)
+    {
+        m_data[0] -= other.m_data[0];
+        m_data[1] -= other.m_data[1];
+        m_data[2] -= other.m_data[2];
+        return *this;
+    }
+    constexpr Vector3f &operator*=(float scalar)
+    {
+        m_data[0] *= scalar;
+        m_data[1] *= scalar;
+        m_data[2] *= scalar;
+        return *this;
+    }
+    constexpr Vector3f &operator/=(float scalar)
+    {
+        m_data[0] /= scalar;
+        m_data[1] /= scalar;
+        m_data[2] /= scalar;
+        return *this;
+    }
 
-    const float &operator[](int i) const;
-    float &operator[](int i);
+    constexpr const float &operator[](int i) const { return m_data[i]; }
+    constexpr float &operator[](int i) { return m_data[i]; }
 
-    float &x();
-    float &y();
-    float &z();
+    constexpr float &x() { return m_data[0]; }
+    constexpr float &y() { return m_data[1]; }
+    constexpr float &z() { return m_data[2]; }
 
-    float x() const;
-    float y() const;
-    float z() const;
+    constexpr float x() const { return m_data[0]; }
+    constexpr float y() const { return m_data[1]; }
+    constexpr float z() const { return m_data[2]; }
 
-    Vector2f xy() const;
-    Vector2f xz() const;
-    Vector2f yz() const;
+    constexpr Vector2f xy() const { return Vector2f(m_data[0], m_data[1]); }
+    constexpr Vector2f xz() const { return Vector2f(m_data[0], m_data[2]); }
+    constexpr Vector2f yz() const { return Vector2f(m_data[1], m_data[2]); }
 
-    Vector3f xyz() const;
-    Vector3f yzx() const;
-    Vector3f zxy() const;
+    constexpr Vector3f xyz() const { return Vector3f(m_data[0], m_data[1], m_data[2]); }
+    constexpr Vector3f yzx() const { return Vector3f(m_data[1], m_data[2], m_data[0]); }
+    constexpr Vector3f zxy() const { return Vector3f(m_data[2], m_data[0], m_data[1]); }
 
-    float Length() const;
-    float LengthSquared() const;
-    void Normalize();
-    Vector3f Normalized() const;
+    float Length() const { return std::sqrt(LengthSquared()); }
+    constexpr float LengthSquared() const { return m_data[0] * m_data[0] + m_data[1] * m_data[1] + m_data[2] * m_data[2]; }
+    void Normalize()
+    {
+        float len = Length();
+        if (len > 0.0f)
+        {
+            m_data[0] /= len;
+            m_data[1] /= len;
+            m_data[2] /= len;
+        }
+    }
+    Vector3f Normalized() const
+    {
+        Vector3f result(*this);
+        result.Normalize();
+        return result;
+    }
 
-    Vector2f Homogenized() const;
+    constexpr Vector2f Homogenized() const { return Vector2f(m_data[0] / m_data[2], m_data[1] / m_data[2]); }
 
-    void Negate();
+    constexpr void Negate()
+    {
+        m_data[0] = -m_data[0];
+        m_data[1] = -m_data[1];
+        m_data[2] = -m_data[2];
+    }
     Vector3f RotateByAxixAngle(const Vector3f &axis, float angle);
 
     static float Distance(const Vector3f &a, const Vector3f &b);
-    static Vector3f Lerp(const Vector3f &a, const Vector3f &b, float t);
+    static constexpr Vector3f Lerp(const Vector3f &a, const Vector3f &b, float t);
 
-    static Vector3f Min(const Vector3f &a, const Vector3f &b);
-    static Vector3f Max(const Vector3f &a, const Vector3f &b);
+    static constexpr Vector3f Min(const Vector3f &a, const Vector3f &b)
+    {
+        return Vector3f(std::min(a.x(), b.x()), std::min(a.y(), b.y()), std::min(a.z(), b.z()));
+    }
+    static constexpr Vector3f Max(const Vector3f &a, const Vector3f &b)
+    {
+        return Vector3f(std::max(a.x(), b.x()), std::max(a.y(), b.y()), std::max(a.z(), b.z()));
+    }
 
     static Vector3f RandomSphere(float radius = 1.0f);
     static Vector3f RandomCycle(const Vector3f &normal, float radius = 1.0f);
 
     void print() const { std::cout << m_data[0] << ", " << m_data[1] << ", " << m_data[2] << std::endl; };
-    operator Vector3() const { return {m_data[0], m_data[1], m_data[2]}; }
+    constexpr operator Vector3() const { return {m_data[0], m_data[1], m_data[2]}; }
 
     friend std::ostream &operator<<(std::ostream &os, const Vector3f &v);
 
@@ -88,19 +136,75 @@ private:
     float m_data[3];
 };
 // 逐分量
-Vector3f operator+(const Vector3f &v0, const Vector3f &v1);
-Vector3f operator-(const Vector3f &v0, const Vector3f &v1);
-Vector3f operator&(const Vector3f &v0, const Vector3f &v1); // 逐分量乘法
-Vector3f operator/(const Vector3f &v0, const Vector3f &v1); // 逐分量除法
+constexpr Vector3f operator+(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() + v1.x(), v0.y() + v1.y(), v0.z() + v1.z());
+}
+constexpr Vector3f operator-(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() - v1.x(), v0.y() - v1.y(), v0.z() - v1.z());
+}
+// 逐分量乘法
+constexpr Vector3f operator&(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() * v1.x(), v0.y() * v1.y(), v0.z() * v1.z());
+}
+// 逐分量除法
+constexpr Vector3f operator/(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.x() / v1.x(), v0.y() / v1.y(), v0.z() / v1.z());
+}
+
+// 点乘
+constexpr float operator*(const Vector3f &v0, const Vector3f &v1)
+{
+    return v0.x() * v1.x() + v0.y() * v1.y() + v0.z() * v1.z();
+}
+// 叉乘
+constexpr Vector3f operator^(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f(v0.y() * v1.z() - v0.z() * v1.y(),
+                    v0.z() * v1.x() - v0.x() * v1.z(),
+                    v0.x() * v1.y() - v0.y() * v1.x());
+}
+
+constexpr Vector3f operator-(const Vector3f &v)
+{
+    return Vector3f(-v.x(), -v.y(), -v.z());
+}
 
-float operator*(const Vector3f &v0, const Vector3f &v1);    // 点乘
-Vector3f operator^(const Vector3f &v0, const Vector3f &v1); // 叉乘
+constexpr Vector3f operator*(float f, const Vector3f &v)
+{
+    return Vector3f(f * v.x(), f * v.y(), f * v.z());
+}
+constexpr Vector3f operator*(const Vector3f &v, float f)
+{
+    return Vector3f(v.x() * f, v.y() * f, v.z() * f);
+}
+constexpr Vector3f operator/(const Vector3f &v, float f)
+{
+    if (f == 0.0f)
+    {
+        throw std::runtime_error("Division by zero in Vector3f operator/");
+    }
+    return Vector3f(v.x() / f, v.y() / f, v.z() / f);
+}
 
-Vector3f operator-(const Vector3f &v);
+inline float Vector3f::Distance(const Vector3f &a, const Vector3f &b)
+{
+    return (a - b).Length();
+}
 
-Vector3f operator*(float f, const Vector3f &v);
-Vector3f operator*(const Vector3f &v, float f);
-Vector3f operator/(const Vector3f &v, float f);
+constexpr Vector3f Vector3f::Lerp(const Vector3f &a, const Vector3f &b, float t)
+{
+    return t * b + (1 - t) * a;
+}
 
-bool operator==(const Vector3f &v0, const Vector3f &v1);
-bool operator!=(const Vector3f &v0, const Vector3f &v1);
+inline bool operator==(const Vector3f &v0, const Vector3f &v1)
+{
+    return Vector3f::Distance(v0, v1) < 1e-5f;
+}
+inline bool operator!=(const Vector3f &v0, const Vector3f &v1)
+{
+    return !(v0 == v1);
+}
@@ -1,98 +1,205 @@
 #pragma once
 #include "raylib.h"
 #include "raymath.h"
-class Vector2f;
-class Vector3f;
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include <cmath>
 class Vector4f
 {
 public:
 	static const Vector4f ZERO;
-	Vector4f(const Vector4 &v)
+	constexpr Vector4f(const Vector4 &v) : m_data{v.x, v.y, v.z, v.w} {}
+	constexpr Vector4f(float f = 0.f) : m_data{f, f, f, f} {}
+	constexpr Vector4f(float fx, float fy, float fz, float fw) : m_data{fx, fy, fz, fw} {}
+	constexpr Vector4f(float f[4]) : m_data{f[0], f[1], f[2], f[3]} {}
+
+	constexpr Vector4f(const Vector2f &xy, float z, float w) : m_data{xy.x(), xy.y(), z, w} {}
+	constexpr Vector4f(float x, const Vector2f &yz, float w) : m_data{x, yz.x(), yz.y(), w} {}
+	constexpr Vector4f(float x, float y, const Vector2f &zw) : m_data{x, y, zw.x(), zw.y()} {}
+	constexpr Vector4f(const Vector2f &xy, const Vector2f &zw) : m_data{xy.x(), xy.y(), zw.x(), zw.y()} {}
+
+	constexpr Vector4f(const Vector3f &xyz, float w) : m_data{xyz.x(), xyz.y(), xyz.z(), w} {}
+	constexpr Vector4f(float x, const Vector3f &yzw) : m_data{x, yzw.x(), yzw.y(), yzw.z()} {}
+
+	constexpr Vector4f(const Vector4f &other) = default;
+
+	constexpr Vector4f &operator=(const Vector4f &rv) = default;
+	constexpr const float &operator[](int i) const { return m_data[i]; }
+	constexpr float &operator[](int i) { return m_data[i]; }
+
+	constexpr float &x() { return m_data[0]; }
+	constexpr float &y() { return m_data[1]; }
+	constexpr float &z() { return m_data[2]; }
+	constexpr float &w() { return m_data[3]; }
+
+	constexpr float x() const { return m_data[0]; }
+	constexpr float y() const { return m_data[1]; }
+	constexpr float z() const { return m_data[2]; }
+	constexpr float w() const { return m_data[3]; }
+
+	constexpr Vector2f xy() const { return Vector2f(m_data[0], m_data[1]); }
+	constexpr Vector2f yz() const { return Vector2f(m_data[1], m_data[2]); }
+	constexpr Vector2f zw() const { return Vector2f(m_data[2], m_data[3]); }
+	constexpr Vector2f wx() const { return Vector2f(m_data[3], m_data[0]); }
+
+	constexpr Vector3f xyz() const { return Vector3f(m_data[0], m_data[1], m_data[2]); }
+	constexpr Vector3f yzw() const { return Vector3f(m_data[1], m_data[2], m_data[3]); }
+	constexpr Vector3f zwx() const { return Vector3f(m_data[2], m_data[3], m_data[0]); }
+	constexpr Vector3f wxy() const { return Vector3f(m_data[3], m_data[0], m_data[1]); }
+
+	constexpr Vector3f xyw() const { return Vector3f(m_data[0], m_data[1], m_data[3]); }
+	constexpr Vector3f yzx() const { return Vector3f(m_data[1], m_data[2], m_data[0]); }
+	constexpr Vector3f zwy() const { return Vector3f(m_data[2], m_data[3], m_data[1]); }
+	constexpr Vector3f wxz() const { return Vector3f(m_data[3], m_data[0], m_data[2]); }
+
+	constexpr Vector4f &operator+=(const Vector4f &other)
 	{
-		m_data[0] = v.x;
-		m_data[1] = v.y;
-		m_data[2] = v.z;
-		m_data[3] = v.w;
+		m_data[0] += other.m_data[0];
+		m_data[1] += other.m_data[1];
+		m_data[2] += other.m_data[2];
+		m_data[3] += other.m_data[3];
+		return *this;
+	}
+	constexpr Vector4f &operator-=(const Vector4f &other)
+	{
+		m_data[0] -= other.m_data[0];
+		m_data[1] -= other.m_data[1];
+		m_data[2] -= other.m_data[2];
+		m_data[3] -= other.m_data[3];
+		return *this;
+	}
+	constexpr Vector4f &operator*=(float scalar)
+	{
+		m_data[0] *= scalar;
+		m_data[1] *= scalar;
+		m_data[2] *= scalar;
+		m_data[3] *= scalar;
+		return *this;
+	}
+	constexpr Vector4f &operator/=(float scalar)
+	{
+		m_data[0] /= scalar;
+		m_data[1] /= scalar;
+		m_data[2] /= scalar;
+		m_data[3] /= scalar;
+		return *this;
 	}
-	Vector4f(float f = 0.f);
-	Vector4f(float fx, float fy, float fz, float fw);
-	Vector4f(float f[4]);
-
-	Vector4f(const Vector2f &xy, float z, float w);
-	Vector4f(float x, const Vector2f &yz, float w);
-	Vector4f(float x, float y, const Vector2f &zw);
-	Vector4f(const Vector2f &xy, const Vector2f &zw);
-
-	Vector4f(const Vector3f &xyz, float w);
-	Vector4f(float x, const Vector3f &yzw);
-
-	Vector4f(const Vector4f &other);
-
-	Vector4f &operator=(const Vector4f &rv);
-	const float &operator[](int i) const;
-	float &operator[](int i);
-
-	float &x();
-	float &y();
-	float &z();
-	float &w();
-
-	float x() const;
-	float y() const;
-	float z() const;
-	float w() const;
-
-	Vector2f xy() const;
-	Vector2f yz() const;
-	Vector2f zw() const;
-	Vector2f wx() const;
-
-	Vector3f xyz() const;
-	Vector3f yzw() const;
-	Vector3f zwx() const;
-	Vector3f wxy() const;
-
-	Vector3f xyw() const;
-	Vector3f yzx() const;
-	Vector3f zwy() const;
-	Vector3f wxz() const;
-
-	Vector4f &operator+=(const Vector4f &other);
-	Vector4f &operator-=(const Vector4f &other);
-	Vector4f &operator*=(float scalar);
-	Vector4f &operator/=(float scalar);
 
-	float Length() const;
-	float LengthSquared() const;
-	void Normalize();
-	Vector4f Normalized() const;
+	float Length() const { return std::sqrt(LengthSquared()); }
+	constexpr float LengthSquared() const
+	{
+		return (m_data[0] * m_data[0] + m_data[1] * m_data[1] + m_data[2] * m_data[2] + m_data[3] * m_data[3]);
+	}
+	void Normalize()
+	{
+		float norm = Length();
+		m_data[0] = m_data[0] / norm;
+		m_data[1] = m_data[1] / norm;
+		m_data[2] = m_data[2] / norm;
+		m_data[3] = m_data[3] / norm;
+	}
+	Vector4f Normalized() const
+	{
+		float length = Length();
+		return Vector4f(
+			m_data[0] / length,
+			m_data[1] / length,
+			m_data[2] / length,
+			m_data[3] / length);
+	}
 
-	void Homogenize();
-	Vector4f Homogenized() const;
+	constexpr void Homogenize()
+	{
+		if (m_data[3] != 0)
+		{
+			m_data[0] /= m_data[3];
+			m_data[1] /= m_data[3];
+			m_data[2] /= m_data[3];
+			m_data[3] = 1;
+		}
+	}
+	constexpr Vector4f Homogenized() const
+	{
+		if (m_data[3] != 0)
+			return Vector4f(m_data[0] / m_data[3], m_data[1] / m_data[3], m_data[2] / m_data[3], 1);
+		return *this;
+	}
 
-	void Negate();
+	constexpr void Negate()
+	{
+		m_data[0] = -m_data[0];
+		m_data[1] = -m_data[1];
+		m_data[2] = -m_data[2];
+		m_data[3] = -m_data[3];
+	}
 
 	static float Distance(const Vector4f &a, const Vector4f &b);
-	static Vector4f Lerp(const Vector4f &a, const Vector4f &b, float t);
+	static constexpr Vector4f Lerp(const Vector4f &a, const Vector4f &b, float t);
 
-	operator Vector4() const { return {m_data[0], m_data[1], m_data[2], m_data[3]}; }
+	constexpr operator Vector4() const { return {m_data[0], m_data[1], m_data[2], m_data[3]}; }
+
+	constexpr const float *data() const { return m_data; }
+	constexpr float *data() { return m_data; }
 
 private:
 	float m_data[4];
 };
 
-Vector4f operator+(const Vector4f &v0, const Vector4f &v1);
-Vector4f operator-(const Vector4f &v0, const Vector4f &v1);
-Vector4f operator&(const Vector4f &v0, const Vector4f &v1);
-Vector4f operator/(const Vector4f &v0, const Vector4f &v1);
+constexpr Vector4f operator+(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() + v1.x(), v0.y() + v1.y(), v0.z() + v1.z(), v0.w() + v1.w());
+}
+constexpr Vector4f operator-(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() - v1.x(), v0.y() - v1.y(), v0.z() - v1.z(), v0.w() - v1.w());
+}
+constexpr Vector4f operator&(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() * v1.x(), v0.y() * v1.y(), v0.z() * v1.z(), v0.w() * v1.w());
+}
+constexpr Vector4f operator/(const Vector4f &v0, const Vector4f &v1)
+{
+	return Vector4f(v0.x() / v1.x(), v0.y() / v1.y(), v0.z() / v1.z(), v0.w() / v1.w());
+}
 
-Vector4f operator-(const Vector4f &v);
+constexpr Vector4f operator-(const Vector4f &v)
+{
+	return Vector4f(-v.x(), -v.y(), -v.z(), -v.w());
+}
+
+// 点乘
+constexpr float operator*(const Vector4f &v0, const Vector4f &v1)
+{
+	return v0.x() * v1.x() + v0.y() * v1.y() + v0.z() * v1.z() + v0.w() * v1.w();
+}
 
-float operator*(const Vector4f &v0, const Vector4f &v1); // 点乘
+constexpr Vector4f operator*(float f, const Vector4f &v)
+{
+	return Vector4f(f * v.x(), f * v.y(), f * v.z(), f * v.w());
+}
+constexpr Vector4f operator*(const Vector4f &v, float f)
+{
+	return Vector4f(f * v.x(), f * v.y(), f * v.z(), f * v.w());
+}
+constexpr Vector4f operator/(const Vector4f &v, float f)
+{
+	return Vector4f(v[0] / f, v[1] / f, v[2] / f, v[3] / f);
+}
 
-Vector4f operator*(float f, const Vector4f &v);
-Vector4f operator*(const Vector4f &v, float f);
-Vector4f operator/(const Vector4f &v, float f);
+inline float Vector4f::Distance(const Vector4f &a, const Vector4f &b)
+{
+	return (a - b).Length();
+}
+constexpr Vector4f Vector4f::Lerp(const Vector4f &v0, const Vector4f &v1, float alpha)
+{
+	return alpha * (v1 - v0) + v0;
+}
 
-bool operator==(const Vector4f &v0, const Vector4f &v1);
-bool operator!=(const Vector4f &v0, const Vector4f &v1);
+constexpr bool operator==(const Vector4f &v0, const Vector4f &v1)
+{
+	return (v0.x() == v1.x() && v0.y() == v1.y() && v0.z() == v1.z() && v0.w() == v1.w());
+}
+constexpr bool operator!=(const Vector4f &v0, const Vector4f &v1)
+{
+	return !(v0 == v1);
+}
@@ -444,6 +444,8 @@ GameObject *NetworkSyncSystem::FindOrSpawnRemoteObject(GameWorld &world, ClientI
         newObj.AddComponent<TransformComponent>();
     auto &tf = newObj.GetComponent<TransformComponent>();
     tf.SetOwner(&newObj);
+    // 远端物体由 ApplyRemoteInterpolation 逐帧平滑, 不参与固定步插值
+    tf.interpolate = false;
 
     auto &sync = newObj.AddComponent<NetworkSyncComponent>(objectID, false);
     sync.ownerClientID = ownerClientID;
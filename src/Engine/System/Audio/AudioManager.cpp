@@ -15,7 +15,8 @@ void AudioManager::Update(GameWorld &world, const mCamera &camera)
     {
         auto &audioComp = entity->GetComponent<AudioComponent>();
         auto &tf = entity->GetComponent<TransformComponent>();
-        Vector3f sourcePos = tf.GetWorldPosition();
+        // 按渲染姿态定位, 与画面一致, 异步物理步进行中也可读
+        Vector3f sourcePos = tf.GetRenderPosition();
 
         for (auto &[name, clip] : audioComp.audioClips)
         {
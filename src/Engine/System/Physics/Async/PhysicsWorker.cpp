@@ -0,0 +1,63 @@
+#include "PhysicsWorker.h"
+
+#if !defined(PLATFORM_WEB)
+PhysicsWorker::PhysicsWorker() : m_thread(&PhysicsWorker::Run, this) {}
+
+PhysicsWorker::~PhysicsWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+void PhysicsWorker::Launch(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = std::move(job);
+        m_busy.store(true, std::memory_order_release);
+    }
+    m_wake.notify_one();
+}
+
+void PhysicsWorker::Wait()
+{
+    if (!IsBusy())
+        return;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]()
+                { return !m_busy.load(std::memory_order_acquire); });
+}
+
+void PhysicsWorker::Run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wake.wait(lock, [this]()
+                    { return m_stop || m_job; });
+        if (m_stop)
+            return;
+        std::function<void()> job = std::move(m_job);
+        m_job = nullptr;
+        lock.unlock();
+        job();
+        lock.lock();
+        m_busy.store(false, std::memory_order_release);
+        m_done.notify_all();
+    }
+}
+#else
+PhysicsWorker::PhysicsWorker() = default;
+PhysicsWorker::~PhysicsWorker() = default;
+
+void PhysicsWorker::Launch(std::function<void()> job)
+{
+    job();
+}
+
+void PhysicsWorker::Wait() {}
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#if !defined(PLATFORM_WEB)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// 常驻的物理线程, 一次只执行一个任务. 主线程用 IsBusy 轮询, 或用 Wait 等待完成
+// PLATFORM_WEB 下没有线程, Launch 直接在调用线程上执行
+class PhysicsWorker
+{
+public:
+    PhysicsWorker();
+    ~PhysicsWorker();
+    PhysicsWorker(const PhysicsWorker &) = delete;
+    PhysicsWorker &operator=(const PhysicsWorker &) = delete;
+
+    // 上一个任务完成之前不能再次调用
+    void Launch(std::function<void()> job);
+    // 返回 false 后, 任务中的全部写入对调用线程可见
+    bool IsBusy() const { return m_busy.load(std::memory_order_acquire); }
+    void Wait();
+
+private:
+    std::function<void()> m_job;
+    std::atomic<bool> m_busy{false};
+#if !defined(PLATFORM_WEB)
+    void Run();
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    bool m_stop = false;
+    std::thread m_thread;
+#endif
+};
@@ -0,0 +1,184 @@
+#include "SweepAndPrune.h"
+#include <algorithm>
+
+namespace
+{
+    // 同值时 min 端点在前，保持与 AABB::IsCollide 相同的"接触即碰撞"语义
+    inline bool EndpointLess(float va, bool minA, float vb, bool minB)
+    {
+        return va < vb || (va == vb && minA && !minB);
+    }
+    inline bool OverlapOnAxis(const AABB &a, const AABB &b, int axis)
+    {
+        return a.max[axis] >= b.min[axis] && a.min[axis] <= b.max[axis];
+    }
+}
+
+void SweepAndPrune::SetAxis(int axis)
+{
+    axis = std::max(0, std::min(2, axis));
+    if (axis == m_axis)
+        return;
+    m_axis = axis;
+    // 换轴后端点顺序失效，下一步整体重排
+    Clear();
+}
+
+void SweepAndPrune::Clear()
+{
+    m_proxies.clear();
+    m_freeProxies.clear();
+    m_endpoints.clear();
+    m_proxyMap.clear();
+    m_active.clear();
+    m_stats = Stats();
+}
+
+uint32_t SweepAndPrune::AddProxy(GameObject *object, const AABB &aabb, uint32_t index)
+{
+    uint32_t id;
+    if (!m_freeProxies.empty())
+    {
+        id = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    }
+    else
+    {
+        id = (uint32_t)m_proxies.size();
+        m_proxies.emplace_back();
+    }
+    Proxy &proxy = m_proxies[id];
+    proxy.object = object;
+    proxy.aabb = aabb;
+    proxy.index = index;
+    proxy.seen = true;
+    proxy.alive = true;
+
+    m_endpoints.push_back({aabb.min[m_axis], id, true});
+    m_endpoints.push_back({aabb.max[m_axis], id, false});
+    m_proxyMap[object] = id;
+    return id;
+}
+
+void SweepAndPrune::RemoveDeadProxies()
+{
+    bool anyRemoved = false;
+    for (uint32_t id = 0; id < m_proxies.size(); ++id)
+    {
+        Proxy &proxy = m_proxies[id];
+        if (!proxy.alive || proxy.seen)
+            continue;
+        proxy.alive = false;
+        m_proxyMap.erase(proxy.object);
+        proxy.object = nullptr;
+        m_freeProxies.push_back(id);
+        m_stats.removed++;
+        anyRemoved = true;
+    }
+    if (!anyRemoved)
+        return;
+    m_endpoints.erase(std::remove_if(m_endpoints.begin(), m_endpoints.end(),
+                                     [this](const Endpoint &e)
+                                     { return !m_proxies[e.proxy].alive; }),
+                      m_endpoints.end());
+}
+
+void SweepAndPrune::InsertionSort()
+{
+    const size_t n = m_endpoints.size();
+    for (size_t i = 1; i < n; ++i)
+    {
+        Endpoint key = m_endpoints[i];
+        size_t j = i;
+        while (j > 0 && EndpointLess(key.value, key.isMin, m_endpoints[j - 1].value, m_endpoints[j - 1].isMin))
+        {
+            m_endpoints[j] = m_endpoints[j - 1];
+            --j;
+            m_stats.swapCount++;
+        }
+        m_endpoints[j] = key;
+    }
+}
+
+void SweepAndPrune::Update(const std::vector<GameObject *> &objects, const std::vector<AABB> &aabbs, std::vector<BroadphasePair> &outPairs)
+{
+    m_stats = Stats();
+    outPairs.clear();
+
+    for (auto &proxy : m_proxies)
+        proxy.seen = false;
+
+    m_pending.clear();
+    for (uint32_t i = 0; i < objects.size(); ++i)
+    {
+        auto it = m_proxyMap.find(objects[i]);
+        if (it != m_proxyMap.end())
+        {
+            Proxy &proxy = m_proxies[it->second];
+            proxy.aabb = aabbs[i];
+            proxy.index = i;
+            proxy.seen = true;
+        }
+        else
+        {
+            m_pending.push_back(i);
+        }
+    }
+    RemoveDeadProxies();
+
+    for (auto &e : m_endpoints)
+    {
+        const AABB &aabb = m_proxies[e.proxy].aabb;
+        e.value = e.isMin ? aabb.min[m_axis] : aabb.max[m_axis];
+    }
+    // 已有端点基本有序，插入排序只移动跨越的端点
+    InsertionSort();
+
+    // 新激活的物体单独排序后归并, 避免从数组尾部逐个插入
+    if (!m_pending.empty())
+    {
+        const size_t oldCount = m_endpoints.size();
+        for (uint32_t i : m_pending)
+            AddProxy(objects[i], aabbs[i], i);
+        m_stats.added = m_pending.size();
+
+        auto less = [](const Endpoint &a, const Endpoint &b)
+        { return EndpointLess(a.value, a.isMin, b.value, b.isMin); };
+        std::sort(m_endpoints.begin() + oldCount, m_endpoints.end(), less);
+        std::inplace_merge(m_endpoints.begin(), m_endpoints.begin() + oldCount, m_endpoints.end(), less);
+    }
+
+    const int axis1 = (m_axis + 1) % 3;
+    const int axis2 = (m_axis + 2) % 3;
+    m_active.clear();
+    for (const auto &e : m_endpoints)
+    {
+        if (e.isMin)
+        {
+            const Proxy &p = m_proxies[e.proxy];
+            for (uint32_t other : m_active)
+            {
+                const Proxy &q = m_proxies[other];
+                if (!OverlapOnAxis(p.aabb, q.aabb, axis1) || !OverlapOnAxis(p.aabb, q.aabb, axis2))
+                    continue;
+                if (p.index < q.index)
+                    outPairs.emplace_back(p.index, q.index);
+                else
+                    outPairs.emplace_back(q.index, p.index);
+            }
+            m_active.push_back(e.proxy);
+        }
+        else
+        {
+            auto it = std::find(m_active.begin(), m_active.end(), e.proxy);
+            if (it != m_active.end())
+            {
+                *it = m_active.back();
+                m_active.pop_back();
+            }
+        }
+    }
+
+    m_stats.proxyCount = objects.size();
+    m_stats.pairCount = outPairs.size();
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class GameObject;
+
+using BroadphasePair = std::pair<uint32_t, uint32_t>;
+
+// 单轴 Sweep and Prune
+// 端点数组跨帧保留，物体移动不大时插入排序接近 O(n)
+class SweepAndPrune
+{
+public:
+    struct Stats
+    {
+        size_t proxyCount = 0;
+        size_t pairCount = 0;
+        size_t swapCount = 0;
+        size_t added = 0;
+        size_t removed = 0;
+    };
+
+    void SetAxis(int axis);
+    int GetAxis() const { return m_axis; }
+
+    // objects[i] 与 aabbs[i] 一一对应, outPairs 输出的是下标对 (i < j)
+    // 本步未出现的物体 (回收进对象池/销毁) 自动移除
+    void Update(const std::vector<GameObject *> &objects, const std::vector<AABB> &aabbs, std::vector<BroadphasePair> &outPairs);
+    void Clear();
+
+    const Stats &GetStats() const { return m_stats; }
+
+private:
+    struct Endpoint
+    {
+        float value;
+        uint32_t proxy;
+        bool isMin;
+    };
+    struct Proxy
+    {
+        GameObject *object = nullptr;
+        AABB aabb;
+        uint32_t index = 0; // 本步在 objects 中的下标
+        bool seen = false;
+        bool alive = false;
+    };
+
+    uint32_t AddProxy(GameObject *object, const AABB &aabb, uint32_t index);
+    void RemoveDeadProxies();
+    void InsertionSort();
+
+    int m_axis = 0;
+    std::vector<Proxy> m_proxies;
+    std::vector<uint32_t> m_freeProxies;
+    std::vector<Endpoint> m_endpoints;
+    std::unordered_map<GameObject *, uint32_t> m_proxyMap;
+
+    std::vector<uint32_t> m_pending;
+    std::vector<uint32_t> m_active;
+    Stats m_stats;
+};
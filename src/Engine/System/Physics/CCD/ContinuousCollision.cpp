@@ -0,0 +1,277 @@
+#include "ContinuousCollision.h"
+#include "SweepTests.h"
+#include "Engine/Core/GameObject/GameObject.h"
+#include "Engine/Core/Events/EventManager.h"
+#include "Engine/System/Physics/Layers/CollisionLayers.h"
+#include "Engine/System/Physics/Static/StaticGeometry.h"
+#include "Engine/System/Physics/Stages/CollisionEvent.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // 异步物理步中回调推迟到主线程
+    void NotifyCallback(EventManager *eventManager, const std::function<void(GameObject *)> &callback, GameObject *other)
+    {
+        if (!callback)
+            return;
+        if (eventManager)
+            eventManager->Defer([callback, other]()
+                                { callback(other); });
+        else
+            callback(other);
+    }
+}
+
+void ContinuousCollision::Initialize(const json &config)
+{
+    m_enabled = config.value("enable", true);
+    m_maxSubsteps = std::max(1, config.value("maxSubsteps", 4));
+    m_motionThreshold = config.value("motionThreshold", 1.0f);
+    m_skin = config.value("skin", 0.01f);
+}
+
+float ContinuousCollision::GetSweepRadius(const RigidbodyComponent &rb)
+{
+    if (rb.colliderType == ColliderType::SPHERE)
+        return rb.boudingRadius;
+    if (rb.colliderType == ColliderType::BOX)
+    {
+        Vector3f half = (rb.localAABB.max - rb.localAABB.min) * 0.5f;
+        return std::min(half.x(), std::min(half.y(), half.z()));
+    }
+    return 0.0f;
+}
+
+void ContinuousCollision::Solve(const std::vector<GameObject *> &objects, float fixedDeltaTime, const CollisionLayers *layers,
+                                const StaticGeometry *geometry, EventManager *eventManager)
+{
+    m_stats = Stats();
+    if (!m_enabled)
+        return;
+
+    auto isSwept = [](const RigidbodyComponent &rb)
+    {
+        return rb.ccd && rb.Collidable && !rb.isSleeping && !rb.isStatic && rb.mass > std::numeric_limits<float>::min();
+    };
+    bool any = false;
+    for (auto *object : objects)
+    {
+        if (object->HasComponent<RigidbodyComponent>() && isSwept(object->GetComponent<RigidbodyComponent>()))
+        {
+            any = true;
+            break;
+        }
+    }
+    if (!any)
+        return;
+
+    // 目标取本步起点的姿态, 目标自身的运动忽略 (CCD 针对的是远快于目标的物体)
+    m_targets.clear();
+    m_targetIndex.assign(objects.size(), -1);
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        auto *object = objects[i];
+        if (!object->HasComponent<RigidbodyComponent>() || !object->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        if (!rb.Collidable || rb.isStatic || rb.colliderType == ColliderType::NONE)
+            continue;
+        uint32_t mask = layers ? layers->GetEffectiveMask(rb.collisionLayer, rb.collisionMask) : CollisionLayers::ALL;
+        m_targetIndex[i] = (int)m_targets.size();
+        m_targets.push_back({object, &rb, HitBox(object->GetComponent<TransformComponent>(), rb), object->GetWorldAABB(),
+                             rb.collisionLayer, mask});
+    }
+    BuildTargetOrder();
+
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        const int self = m_targetIndex[i];
+        if (self < 0)
+            continue;
+        auto *object = objects[i];
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        if (!isSwept(rb))
+            continue;
+        const float radius = GetSweepRadius(rb);
+        if (radius <= 0.0f || rb.velocity.Length() * fixedDeltaTime <= radius * m_motionThreshold)
+            continue;
+        m_stats.sweptBodies++;
+
+        auto &tf = object->GetComponent<TransformComponent>();
+        Vector3f pos = tf.GetWorldPosition();
+        float remaining = fixedDeltaTime;
+        int ignore = -1;
+        bool moved = false;
+        for (int sub = 0; sub < m_maxSubsteps && remaining > 0.0f; sub++)
+        {
+            float speed = rb.velocity.Length();
+            if (speed <= std::numeric_limits<float>::min())
+            {
+                remaining = 0.0f;
+                break;
+            }
+            Vector3f dir = rb.velocity / speed;
+            float dist = speed * remaining;
+
+            SweepHit hit;
+            if (!Sweep(self, pos, dir, dist, radius, m_targets[self].layer, m_targets[self].mask, ignore, geometry, hit))
+            {
+                if (moved)
+                    pos += dir * dist;
+                remaining = 0.0f;
+                break;
+            }
+
+            // 推进到碰撞点, 剩余时间沿反弹后的速度继续
+            m_stats.hits++;
+            pos += dir * std::max(hit.distance - m_skin, 0.0f);
+            remaining *= 1.0f - hit.distance / dist;
+            tf.SetWorldPosition(pos);
+            moved = true;
+
+            Vector3f hitPoint = pos - hit.normal * radius;
+            Vector3f relativeVelocity;
+            float impulse = ApplyImpulse(object, hitPoint, hit.normal, hit, relativeVelocity);
+            // 场景文件中的静态几何没有对象, 不触发回调与事件
+            GameObject *other = hit.target >= 0 ? m_targets[hit.target].go : hit.staticBody;
+            if (other)
+            {
+                NotifyCallback(eventManager, rb.collisionCallback, other);
+                NotifyCallback(eventManager, other->GetComponent<RigidbodyComponent>().collisionCallback, object);
+                if (eventManager && impulse > 0.0f)
+                    eventManager->Post(CollisionEvent(object, other, -hit.normal, 0.0f, hitPoint, relativeVelocity, impulse));
+            }
+            ignore = hit.target;
+        }
+
+        // 子步用尽时剩余时间丢弃, 宁可少走也不穿透
+        if (moved)
+        {
+            tf.SetWorldPosition(pos);
+            rb.ccdIntegrated = true;
+        }
+    }
+}
+
+void ContinuousCollision::BuildTargetOrder()
+{
+    // 取目标中心分布最广的轴排序, 扫掠时二分定位
+    Vector3f lo(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector3f hi = -lo;
+    for (const auto &target : m_targets)
+    {
+        Vector3f c = (target.aabb.min + target.aabb.max) * 0.5f;
+        for (int i = 0; i < 3; i++)
+        {
+            lo[i] = std::min(lo[i], c[i]);
+            hi[i] = std::max(hi[i], c[i]);
+        }
+    }
+    Vector3f spread = hi - lo;
+    m_sortAxis = spread.x() >= spread.y() ? (spread.x() >= spread.z() ? 0 : 2) : (spread.y() >= spread.z() ? 1 : 2);
+
+    const int axis = m_sortAxis;
+    m_maxExtent = 0.0f;
+    m_order.resize(m_targets.size());
+    for (size_t t = 0; t < m_targets.size(); t++)
+    {
+        m_order[t] = (int)t;
+        m_maxExtent = std::max(m_maxExtent, m_targets[t].aabb.max[axis] - m_targets[t].aabb.min[axis]);
+    }
+    std::sort(m_order.begin(), m_order.end(), [this, axis](int a, int b)
+              { return m_targets[a].aabb.min[axis] < m_targets[b].aabb.min[axis]; });
+}
+
+bool ContinuousCollision::Sweep(int self, const Vector3f &origin, const Vector3f &dir, float maxDist, float radius, int layer,
+                                uint32_t mask, int ignoreTarget, const StaticGeometry *geometry, SweepHit &outHit) const
+{
+    bool hit = false;
+    float best = maxDist;
+
+    Vector3f end = origin + dir * maxDist;
+    AABB swept(Vector3f(std::min(origin.x(), end.x()) - radius, std::min(origin.y(), end.y()) - radius, std::min(origin.z(), end.z()) - radius),
+               Vector3f(std::max(origin.x(), end.x()) + radius, std::max(origin.y(), end.y()) + radius, std::max(origin.z(), end.z()) + radius));
+    // 沿排序轴找出 min 不超过扫掠盒上界、且可能与其重叠的目标
+    const int axis = m_sortAxis;
+    auto first = std::lower_bound(m_order.begin(), m_order.end(), swept.min[axis] - m_maxExtent,
+                                  [this, axis](int t, float value)
+                                  { return m_targets[t].aabb.min[axis] < value; });
+    for (auto it = first; it != m_order.end(); ++it)
+    {
+        const int t = *it;
+        const Target &target = m_targets[t];
+        if (target.aabb.min[axis] > swept.max[axis])
+            break;
+        if (t == self || t == ignoreTarget)
+            continue;
+        if (!CollisionLayers::ShouldCollide(layer, mask, target.layer, target.mask) || !AABB::IsCollide(swept, target.aabb))
+            continue;
+        float dist;
+        Vector3f normal;
+        if (SweepTests::SweepSphereShape(target.shape, origin, dir, best, radius, dist, normal) && dist <= best)
+        {
+            best = dist;
+            hit = true;
+            outHit.distance = dist;
+            outHit.normal = normal;
+            outHit.target = t;
+        }
+    }
+
+    StaticSweepHit staticHit;
+    if (geometry && geometry->SweepSphere(origin, dir, best, radius, staticHit, true, layer, mask) && staticHit.distance <= best)
+    {
+        hit = true;
+        outHit.distance = staticHit.distance;
+        outHit.normal = staticHit.normal;
+        outHit.target = -1;
+        outHit.restitution = staticHit.material.restitution;
+        outHit.staticBody = geometry->GetBody(staticHit.primitive);
+    }
+    return hit;
+}
+
+float ContinuousCollision::ApplyImpulse(GameObject *self, const Vector3f &hitPoint, const Vector3f &surfaceNormal, const SweepHit &hit,
+                                        Vector3f &outRelativeVelocity)
+{
+    // normal:A->B为正
+    const Vector3f normal = -surfaceNormal;
+    auto &rbA = self->GetComponent<RigidbodyComponent>();
+    auto &tfA = self->GetComponent<TransformComponent>();
+    RigidbodyComponent *rbB = hit.target >= 0 ? m_targets[hit.target].rb : nullptr;
+    TransformComponent *tfB = hit.target >= 0 ? &m_targets[hit.target].go->GetComponent<TransformComponent>() : nullptr;
+
+    auto inverseMass = [](const RigidbodyComponent *rb)
+    {
+        return rb && rb->mass > std::numeric_limits<float>::min() ? 1.0f / rb->mass : 0.0f;
+    };
+    const float invMassA = inverseMass(&rbA);
+    const float invMassB = inverseMass(rbB);
+
+    Vector3f rA = hitPoint - tfA.GetWorldPosition();
+    Vector3f rB = tfB ? hitPoint - tfB->GetWorldPosition() : Vector3f::ZERO;
+    Vector3f vB = rbB ? rbB->velocity + (rbB->angularVelocity ^ rB) : Vector3f::ZERO;
+    Vector3f rV = vB - rbA.velocity - (rbA.angularVelocity ^ rA);
+    outRelativeVelocity = rV;
+    float nrV = rV * normal;
+    if (nrV > 0.0f)
+        return 0.0f;
+
+    Vector3f raxn = rA ^ normal;
+    float denom = invMassA + invMassB + raxn * (rbA.worldInverseInertia * raxn);
+    if (rbB && invMassB > 0.0f)
+    {
+        Vector3f rbxn = rB ^ normal;
+        denom += rbxn * (rbB->worldInverseInertia * rbxn);
+    }
+
+    float e = rbA.elasticity * (rbB ? rbB->elasticity : hit.restitution);
+    float j = -(1.0f + e) * nrV / denom;
+    Vector3f impulse = j * normal;
+    rbA.AddImpulse(-impulse, rA);
+    if (rbB)
+        rbB->AddImpulse(impulse, rB);
+    return j;
+}
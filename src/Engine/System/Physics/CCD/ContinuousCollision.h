@@ -0,0 +1,81 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Math.h"
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameObject;
+class EventManager;
+class CollisionLayers;
+class StaticGeometry;
+
+// 连续碰撞检测 (标记 ccd 的刚体)
+// 在接触求解之后、位置积分之前运行: 单步位移超过自身内切半径的物体用球扫掠求最早碰撞时刻 (TOI),
+// 推进到碰撞点并施加冲量, 剩余时间沿反弹后的速度再扫掠, 每步至多 maxSubsteps 次碰撞.
+// 只处理平移, 不做旋转扫掠; 碰撞冲量在此处直接结算, 不进入 ContactSolver 的接触流形.
+// 推进过的物体本步不再由积分器平移
+class ContinuousCollision
+{
+public:
+    struct Stats
+    {
+        size_t sweptBodies = 0;
+        size_t hits = 0;
+    };
+
+    void Initialize(const json &config);
+    bool IsEnabled() const { return m_enabled; }
+    void SetEnabled(bool enabled) { m_enabled = enabled; }
+
+    // layers/geometry/eventManager 可为空
+    void Solve(const std::vector<GameObject *> &objects, float fixedDeltaTime, const CollisionLayers *layers,
+               const StaticGeometry *geometry, EventManager *eventManager);
+
+    const Stats &GetStats() const { return m_stats; }
+
+    // 扫掠用的内切球半径
+    static float GetSweepRadius(const RigidbodyComponent &rb);
+
+private:
+    struct Target
+    {
+        GameObject *go;
+        RigidbodyComponent *rb;
+        HitBox shape;
+        AABB aabb;
+        int layer;
+        uint32_t mask;
+    };
+    struct SweepHit
+    {
+        float distance;
+        Vector3f normal; // 被击中表面外法线
+        int target = -1; // -1 为静态几何
+        float restitution = 0.0f;
+        GameObject *staticBody = nullptr; // 击中烘焙进静态几何的刚体时为该刚体
+    };
+
+    void BuildTargetOrder();
+    bool Sweep(int self, const Vector3f &origin, const Vector3f &dir, float maxDist, float radius, int layer, uint32_t mask,
+               int ignoreTarget, const StaticGeometry *geometry, SweepHit &outHit) const;
+    // 对 self 与目标施加碰撞冲量, 返回冲量大小
+    float ApplyImpulse(GameObject *self, const Vector3f &hitPoint, const Vector3f &normal, const SweepHit &hit,
+                       Vector3f &outRelativeVelocity);
+
+    bool m_enabled = true;
+    int m_maxSubsteps = 4;
+    // 单步位移超过 radius * motionThreshold 时才扫掠
+    float m_motionThreshold = 1.0f;
+    // 推进到碰撞点时预留的间隙
+    float m_skin = 0.01f;
+
+    std::vector<Target> m_targets;
+    std::vector<int> m_targetIndex; // objects 下标 -> m_targets 下标
+    // 目标按 aabb.min[m_sortAxis] 排序, m_maxExtent 为该轴上最大尺寸
+    std::vector<int> m_order;
+    int m_sortAxis = 0;
+    float m_maxExtent = 0.0f;
+    Stats m_stats;
+};
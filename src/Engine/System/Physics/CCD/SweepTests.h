@@ -0,0 +1,122 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Math.h"
+#include <cmath>
+#include <limits>
+
+// 球扫掠求交, dir 为单位向量, 命中时 outDist 为球心移动距离, outNormal 为被击中表面外法线
+// radius 为 0 时即射线检测; 起点已重叠的目标不算命中 (交给离散检测)
+namespace SweepTests
+{
+    // 球扫掠 OBB == 射线与外扩 radius 的 OBB 求交 (忽略圆角, 略保守)
+    inline bool SweepSphereBox(const HitBox &box, const Vector3f &origin, const Vector3f &dir, float maxDist, float radius,
+                               float &outDist, Vector3f &outNormal)
+    {
+        Vector3f delta = origin - box.center;
+        float tMin = 0.0f;
+        float tMax = maxDist;
+        int hitAxis = -1;
+        float hitSign = 1.0f;
+        for (int i = 0; i < 3; i++)
+        {
+            float o = delta * box.axes[i];
+            float d = dir * box.axes[i];
+            float h = box.halfExtents[i] + radius;
+            if (std::fabs(d) < 1e-8f)
+            {
+                if (o < -h || o > h)
+                    return false;
+                continue;
+            }
+            float invD = 1.0f / d;
+            float t1 = (-h - o) * invD;
+            float t2 = (h - o) * invD;
+            float sign = -1.0f;
+            if (t1 > t2)
+            {
+                std::swap(t1, t2);
+                sign = 1.0f;
+            }
+            if (t1 > tMin)
+            {
+                tMin = t1;
+                hitAxis = i;
+                hitSign = sign;
+            }
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+                return false;
+        }
+        if (hitAxis < 0)
+            return false; // 起点在内部
+        outDist = tMin;
+        outNormal = box.axes[hitAxis] * hitSign;
+        return true;
+    }
+
+    inline bool SweepSphereSphere(const Vector3f &center, float targetRadius, const Vector3f &origin, const Vector3f &dir,
+                                  float maxDist, float radius, float &outDist, Vector3f &outNormal)
+    {
+        float r = targetRadius + radius;
+        Vector3f m = origin - center;
+        float c = m * m - r * r;
+        if (c <= 0.0f)
+            return false; // 起点在内部
+        float b = m * dir;
+        if (b > 0.0f)
+            return false;
+        float disc = b * b - c;
+        if (disc < 0.0f)
+            return false;
+        float t = -b - std::sqrt(disc);
+        if (t > maxDist)
+            return false;
+        outDist = std::max(t, 0.0f);
+        outNormal = (origin + dir * outDist - center).Normalized();
+        return true;
+    }
+
+    inline bool SweepSphereShape(const HitBox &shape, const Vector3f &origin, const Vector3f &dir, float maxDist, float radius,
+                                 float &outDist, Vector3f &outNormal)
+    {
+        if (shape.colliderType == ColliderType::SPHERE)
+            return SweepSphereSphere(shape.center, shape.boudingRadius, origin, dir, maxDist, radius, outDist, outNormal);
+        if (shape.colliderType == ColliderType::BOX)
+            return SweepSphereBox(shape, origin, dir, maxDist, radius, outDist, outNormal);
+        return false;
+    }
+
+    // 射线与外扩 radius 的包围盒是否相交, 用于 BVH 剪枝
+    inline bool RayAABB(const AABB &aabb, const Vector3f &origin, const Vector3f &invDir, float maxDist, float radius)
+    {
+        float tMin = 0.0f;
+        float tMax = maxDist;
+        for (int i = 0; i < 3; i++)
+        {
+            float lo = aabb.min[i] - radius, hi = aabb.max[i] + radius;
+            if (std::isinf(invDir[i]))
+            {
+                if (origin[i] < lo || origin[i] > hi)
+                    return false;
+                continue;
+            }
+            float t1 = (lo - origin[i]) * invDir[i];
+            float t2 = (hi - origin[i]) * invDir[i];
+            if (t1 > t2)
+                std::swap(t1, t2);
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+                return false;
+        }
+        return true;
+    }
+
+    inline Vector3f InverseDirection(const Vector3f &dir)
+    {
+        const float inf = std::numeric_limits<float>::infinity();
+        return Vector3f(std::fabs(dir.x()) > 1e-8f ? 1.0f / dir.x() : inf,
+                        std::fabs(dir.y()) > 1e-8f ? 1.0f / dir.y() : inf,
+                        std::fabs(dir.z()) > 1e-8f ? 1.0f / dir.z() : inf);
+    }
+}
@@ -2,6 +2,7 @@
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 class GameWorld;
+struct StageStats;
 
 class IPhysicsStage
 {
@@ -10,4 +11,6 @@ public:
 
     virtual void Execute(GameWorld &world, float fixedDeltaTime) = 0;
     virtual void Initialize(const json &data) {};
+    // 可选: 填写最近一步的分段耗时与计数, 总耗时由 PhysicsSystem 统计
+    virtual void GetStats(StageStats &outStats) const {}
 };
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "BatchIntegrator.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include <algorithm>
+#include <cmath>
+
+void BodyBatch::Clear()
+{
+    rbs.clear();
+    tfs.clear();
+    for (auto *v : {&px, &py, &pz, &qw, &qx, &qy, &qz, &sx, &sy, &sz, &vx, &vy, &vz, &wx, &wy, &wz,
+                    &lx, &ly, &lz, &fx, &fy, &fz, &tx, &ty, &tz, &invMass, &drag, &angularDrag})
+        v->clear();
+    for (auto &v : invInertia)
+        v.clear();
+}
+
+void BodyBatch::Add(RigidbodyComponent *rb, TransformComponent *tf)
+{
+    rbs.push_back(rb);
+    tfs.push_back(tf);
+
+    Vector3f pos, scl;
+    Quat4f rot;
+    tf->GetWorldTRS(pos, rot, scl);
+    // 朝向可能在物理步之外被改写, 按当前朝向刷新世界系逆惯性
+    rb->UpdateWorldInertia(rot);
+    px.push_back(pos.x());
+    py.push_back(pos.y());
+    pz.push_back(pos.z());
+    qw.push_back(rot.w());
+    qx.push_back(rot.x());
+    qy.push_back(rot.y());
+    qz.push_back(rot.z());
+    sx.push_back(scl.x());
+    sy.push_back(scl.y());
+    sz.push_back(scl.z());
+
+    vx.push_back(rb->velocity.x());
+    vy.push_back(rb->velocity.y());
+    vz.push_back(rb->velocity.z());
+    wx.push_back(rb->angularVelocity.x());
+    wy.push_back(rb->angularVelocity.y());
+    wz.push_back(rb->angularVelocity.z());
+    lx.push_back(rb->angularMomentum.x());
+    ly.push_back(rb->angularMomentum.y());
+    lz.push_back(rb->angularMomentum.z());
+    fx.push_back(rb->accumulatedForces.x());
+    fy.push_back(rb->accumulatedForces.y());
+    fz.push_back(rb->accumulatedForces.z());
+    tx.push_back(rb->accumulatedTorques.x());
+    ty.push_back(rb->accumulatedTorques.y());
+    tz.push_back(rb->accumulatedTorques.z());
+
+    invMass.push_back(1.0f / rb->mass);
+    drag.push_back(rb->drag);
+    angularDrag.push_back(rb->angularDrag);
+    const Matrix3f &I = rb->worldInverseInertia;
+    invInertia[0].push_back(I(0, 0));
+    invInertia[1].push_back(I(0, 1));
+    invInertia[2].push_back(I(0, 2));
+    invInertia[3].push_back(I(1, 1));
+    invInertia[4].push_back(I(1, 2));
+    invInertia[5].push_back(I(2, 2));
+}
+
+void BodyBatch::Finalize()
+{
+    const size_t padded = (Size() + WIDTH - 1) / WIDTH * WIDTH;
+    for (auto *v : {&px, &py, &pz, &qx, &qy, &qz, &vx, &vy, &vz, &wx, &wy, &wz,
+                    &lx, &ly, &lz, &fx, &fy, &fz, &tx, &ty, &tz, &invMass, &drag, &angularDrag})
+        v->resize(padded, 0.0f);
+    for (auto *v : {&qw, &sx, &sy, &sz})
+        v->resize(padded, 1.0f);
+    for (auto &v : invInertia)
+        v.resize(padded, 0.0f);
+}
+
+void BodyBatch::GatherVelocities()
+{
+    for (size_t i = 0; i < Size(); i++)
+    {
+        const RigidbodyComponent *rb = rbs[i];
+        vx[i] = rb->velocity.x();
+        vy[i] = rb->velocity.y();
+        vz[i] = rb->velocity.z();
+        wx[i] = rb->angularVelocity.x();
+        wy[i] = rb->angularVelocity.y();
+        wz[i] = rb->angularVelocity.z();
+    }
+}
+
+void BodyBatch::SyncContinuous()
+{
+    for (size_t i = 0; i < Size(); i++)
+    {
+        if (!rbs[i]->ccdIntegrated)
+            continue;
+        Vector3f pos = tfs[i]->GetWorldPosition();
+        px[i] = pos.x();
+        py[i] = pos.y();
+        pz[i] = pos.z();
+        vx[i] = vy[i] = vz[i] = 0.0f;
+    }
+}
+
+void BodyBatch::ScatterVelocities() const
+{
+    for (size_t i = 0; i < Size(); i++)
+    {
+        RigidbodyComponent *rb = rbs[i];
+        rb->velocity = Vector3f(vx[i], vy[i], vz[i]);
+        rb->angularVelocity = Vector3f(wx[i], wy[i], wz[i]);
+        rb->angularMomentum = Vector3f(lx[i], ly[i], lz[i]);
+    }
+}
+
+void BodyBatch::ScatterTransforms() const
+{
+    for (size_t i = 0; i < Size(); i++)
+    {
+        Quat4f rot(qw[i], qx[i], qy[i], qz[i]);
+        tfs[i]->SetWorldTRS(Vector3f(px[i], py[i], pz[i]), rot, Vector3f(sx[i], sy[i], sz[i]));
+        rbs[i]->UpdateWorldInertia(rot);
+        rbs[i]->ClearForces();
+        rbs[i]->ccdIntegrated = false;
+    }
+}
+
+#ifdef NW_MATH_SSE
+namespace
+{
+    inline __m128 Load(const std::vector<float> &v, size_t i) { return _mm_loadu_ps(v.data() + i); }
+    inline void Store(std::vector<float> &v, size_t i, __m128 x) { _mm_storeu_ps(v.data() + i, x); }
+    inline __m128 Madd(__m128 a, __m128 b, __m128 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    // 阻尼系数 max(0, 1 - k*dt)
+    inline __m128 Damping(__m128 k, __m128 dt)
+    {
+        return _mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(k, dt)));
+    }
+}
+
+void BatchIntegrator::IntegrateVelocities(BodyBatch &b, float fixedDeltaTime)
+{
+    const __m128 dt = _mm_set1_ps(fixedDeltaTime);
+    for (size_t i = 0; i < b.PaddedSize(); i += BodyBatch::WIDTH)
+    {
+        // v += F/m * dt, v *= 1 - drag * dt
+        __m128 imdt = _mm_mul_ps(Load(b.invMass, i), dt);
+        __m128 damp = Damping(Load(b.drag, i), dt);
+        Store(b.vx, i, _mm_mul_ps(Madd(Load(b.fx, i), imdt, Load(b.vx, i)), damp));
+        Store(b.vy, i, _mm_mul_ps(Madd(Load(b.fy, i), imdt, Load(b.vy, i)), damp));
+        Store(b.vz, i, _mm_mul_ps(Madd(Load(b.fz, i), imdt, Load(b.vz, i)), damp));
+
+        // L += τ * dt, L *= 1 - angularDrag * dt
+        __m128 adamp = Damping(Load(b.angularDrag, i), dt);
+        __m128 l0 = _mm_mul_ps(Madd(Load(b.tx, i), dt, Load(b.lx, i)), adamp);
+        __m128 l1 = _mm_mul_ps(Madd(Load(b.ty, i), dt, Load(b.ly, i)), adamp);
+        __m128 l2 = _mm_mul_ps(Madd(Load(b.tz, i), dt, Load(b.lz, i)), adamp);
+        Store(b.lx, i, l0);
+        Store(b.ly, i, l1);
+        Store(b.lz, i, l2);
+
+        // ω = I_world^-1 * L, 张量已在步首按朝向旋转好
+        __m128 ixx = Load(b.invInertia[0], i), ixy = Load(b.invInertia[1], i), ixz = Load(b.invInertia[2], i);
+        __m128 iyy = Load(b.invInertia[3], i), iyz = Load(b.invInertia[4], i), izz = Load(b.invInertia[5], i);
+        Store(b.wx, i, Madd(ixx, l0, Madd(ixy, l1, _mm_mul_ps(ixz, l2))));
+        Store(b.wy, i, Madd(ixy, l0, Madd(iyy, l1, _mm_mul_ps(iyz, l2))));
+        Store(b.wz, i, Madd(ixz, l0, Madd(iyz, l1, _mm_mul_ps(izz, l2))));
+    }
+}
+
+void BatchIntegrator::IntegratePositions(BodyBatch &b, float fixedDeltaTime)
+{
+    const __m128 dt = _mm_set1_ps(fixedDeltaTime);
+    const __m128 halfDt = _mm_set1_ps(0.5f * fixedDeltaTime);
+    for (size_t i = 0; i < b.PaddedSize(); i += BodyBatch::WIDTH)
+    {
+        // p += v * dt
+        Store(b.px, i, Madd(Load(b.vx, i), dt, Load(b.px, i)));
+        Store(b.py, i, Madd(Load(b.vy, i), dt, Load(b.py, i)));
+        Store(b.pz, i, Madd(Load(b.vz, i), dt, Load(b.pz, i)));
+
+        // q += 0.5 * (ω, 0) * q * dt, 再归一化; ω 为零的通道保持原值
+        __m128 ox = Load(b.wx, i), oy = Load(b.wy, i), oz = Load(b.wz, i);
+        __m128 w = Load(b.qw, i), x = Load(b.qx, i), y = Load(b.qy, i), z = Load(b.qz, i);
+        __m128 spin = _mm_cmpgt_ps(Madd(ox, ox, Madd(oy, oy, _mm_mul_ps(oz, oz))), _mm_setzero_ps());
+
+        __m128 dw = _mm_sub_ps(_mm_setzero_ps(), Madd(ox, x, Madd(oy, y, _mm_mul_ps(oz, z))));
+        __m128 dx = _mm_sub_ps(Madd(ox, w, _mm_mul_ps(oy, z)), _mm_mul_ps(oz, y));
+        __m128 dy = _mm_sub_ps(Madd(oy, w, _mm_mul_ps(oz, x)), _mm_mul_ps(ox, z));
+        __m128 dz = _mm_sub_ps(Madd(ox, y, _mm_mul_ps(oz, w)), _mm_mul_ps(oy, x));
+
+        __m128 nw = Madd(dw, halfDt, w), nx = Madd(dx, halfDt, x), ny = Madd(dy, halfDt, y), nz = Madd(dz, halfDt, z);
+        __m128 len = _mm_sqrt_ps(Madd(nw, nw, Madd(nx, nx, Madd(ny, ny, _mm_mul_ps(nz, nz)))));
+        __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(len, _mm_set1_ps(1e-20f)));
+
+        auto select = [](__m128 mask, __m128 a, __m128 b)
+        { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); };
+        Store(b.qw, i, select(spin, _mm_mul_ps(nw, inv), w));
+        Store(b.qx, i, select(spin, _mm_mul_ps(nx, inv), x));
+        Store(b.qy, i, select(spin, _mm_mul_ps(ny, inv), y));
+        Store(b.qz, i, select(spin, _mm_mul_ps(nz, inv), z));
+    }
+}
+#else
+void BatchIntegrator::IntegrateVelocities(BodyBatch &b, float fixedDeltaTime)
+{
+    const float dt = fixedDeltaTime;
+    for (size_t i = 0; i < b.Size(); i++)
+    {
+        float imdt = b.invMass[i] * dt;
+        float damp = std::max(0.0f, 1.0f - b.drag[i] * dt);
+        b.vx[i] = (b.vx[i] + b.fx[i] * imdt) * damp;
+        b.vy[i] = (b.vy[i] + b.fy[i] * imdt) * damp;
+        b.vz[i] = (b.vz[i] + b.fz[i] * imdt) * damp;
+
+        float adamp = std::max(0.0f, 1.0f - b.angularDrag[i] * dt);
+        float l[3] = {(b.lx[i] + b.tx[i] * dt) * adamp,
+                      (b.ly[i] + b.ty[i] * dt) * adamp,
+                      (b.lz[i] + b.tz[i] * dt) * adamp};
+        b.lx[i] = l[0];
+        b.ly[i] = l[1];
+        b.lz[i] = l[2];
+
+        const float ixx = b.invInertia[0][i], ixy = b.invInertia[1][i], ixz = b.invInertia[2][i];
+        const float iyy = b.invInertia[3][i], iyz = b.invInertia[4][i], izz = b.invInertia[5][i];
+        b.wx[i] = ixx * l[0] + ixy * l[1] + ixz * l[2];
+        b.wy[i] = ixy * l[0] + iyy * l[1] + iyz * l[2];
+        b.wz[i] = ixz * l[0] + iyz * l[1] + izz * l[2];
+    }
+}
+
+void BatchIntegrator::IntegratePositions(BodyBatch &b, float fixedDeltaTime)
+{
+    const float dt = fixedDeltaTime;
+    for (size_t i = 0; i < b.Size(); i++)
+    {
+        b.px[i] += b.vx[i] * dt;
+        b.py[i] += b.vy[i] * dt;
+        b.pz[i] += b.vz[i] * dt;
+
+        float ox = b.wx[i], oy = b.wy[i], oz = b.wz[i];
+        if (ox * ox + oy * oy + oz * oz <= 0.0f)
+            continue;
+        Quat4f rot(b.qw[i], b.qx[i], b.qy[i], b.qz[i]);
+        rot = rot + (Quat4f(0, ox, oy, oz) * rot) * (0.5f * dt);
+        rot.normalize();
+        b.qw[i] = rot.w();
+        b.qx[i] = rot.x();
+        b.qy[i] = rot.y();
+        b.qz[i] = rot.z();
+    }
+}
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+struct RigidbodyComponent;
+class TransformComponent;
+
+// 打包的刚体状态 (SoA), 长度补齐到 SIMD 宽度, 补齐部分为零质量的单位姿态
+struct BodyBatch
+{
+    static constexpr int WIDTH = 4;
+
+    std::vector<RigidbodyComponent *> rbs;
+    std::vector<TransformComponent *> tfs;
+
+    std::vector<float> px, py, pz;
+    std::vector<float> qw, qx, qy, qz;
+    std::vector<float> sx, sy, sz;
+    std::vector<float> vx, vy, vz;
+    std::vector<float> wx, wy, wz; // 角速度
+    std::vector<float> lx, ly, lz; // 角动量
+    std::vector<float> fx, fy, fz;
+    std::vector<float> tx, ty, tz;
+    std::vector<float> invMass, drag, angularDrag;
+    // 世界系逆惯性张量 (对称), 依次为 xx xy xz yy yz zz
+    std::vector<float> invInertia[6];
+
+    size_t Size() const { return rbs.size(); }
+    size_t PaddedSize() const { return px.size(); }
+    void Clear();
+    // 追加一个刚体, 读取速度/受力/TRS
+    void Add(RigidbodyComponent *rb, TransformComponent *tf);
+    // 所有刚体追加完后调用, 补齐到 WIDTH 的倍数
+    void Finalize();
+
+    // 重新读取速度 (接触求解器改写之后)
+    void GatherVelocities();
+    // CCD 推进过的物体重新读取位置, 平移速度置零
+    void SyncContinuous();
+    // 写回速度/角速度/角动量, 供接触求解器使用
+    void ScatterVelocities() const;
+    // 写回最终 TRS, 刷新世界系逆惯性并清空受力
+    void ScatterTransforms() const;
+};
+
+// 每次处理 WIDTH 个刚体, 无 SSE 时退化为标量
+namespace BatchIntegrator
+{
+    void IntegrateVelocities(BodyBatch &batch, float fixedDeltaTime);
+    void IntegratePositions(BodyBatch &batch, float fixedDeltaTime);
+}
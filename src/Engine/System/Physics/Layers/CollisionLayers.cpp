@@ -0,0 +1,127 @@
+#include "CollisionLayers.h"
+#include <iostream>
+
+void CollisionLayers::Clear()
+{
+    m_names.clear();
+    m_names.push_back("Default");
+    for (int i = 0; i < MAX_LAYERS; i++)
+        m_matrix[i] = ALL;
+}
+
+void CollisionLayers::Initialize(const json &config)
+{
+    Clear();
+    if (config.contains("names"))
+    {
+        for (const auto &name : config["names"])
+            GetOrAddLayer(name.get<std::string>());
+    }
+    if (config.contains("ignore"))
+    {
+        for (const auto &pair : config["ignore"])
+        {
+            if (!pair.is_array() || pair.size() != 2)
+            {
+                std::cerr << "[CollisionLayers]: ignore entry must be a pair of layers" << std::endl;
+                continue;
+            }
+            int a = ParseLayer(pair[0]);
+            int b = ParseLayer(pair[1]);
+            if (a >= 0 && b >= 0)
+                SetCollision(a, b, false);
+        }
+    }
+}
+
+int CollisionLayers::FindLayer(const std::string &name) const
+{
+    for (size_t i = 0; i < m_names.size(); i++)
+    {
+        if (m_names[i] == name)
+            return (int)i;
+    }
+    return -1;
+}
+
+int CollisionLayers::GetOrAddLayer(const std::string &name)
+{
+    int layer = FindLayer(name);
+    if (layer >= 0)
+        return layer;
+    if ((int)m_names.size() >= MAX_LAYERS)
+    {
+        std::cerr << "[CollisionLayers]: Too many layers, " << name << " ignored" << std::endl;
+        return -1;
+    }
+    m_names.push_back(name);
+    return (int)m_names.size() - 1;
+}
+
+int CollisionLayers::ParseLayer(const json &value)
+{
+    if (value.is_number_integer())
+    {
+        int layer = value.get<int>();
+        if (layer >= 0 && layer < MAX_LAYERS)
+            return layer;
+        std::cerr << "[CollisionLayers]: Layer index out of range: " << layer << std::endl;
+        return -1;
+    }
+    if (value.is_string())
+        return GetOrAddLayer(value.get<std::string>());
+    std::cerr << "[CollisionLayers]: Invalid layer: " << value.dump() << std::endl;
+    return -1;
+}
+
+void CollisionLayers::ParseBodyLayer(const json &config, int &layer, uint32_t &mask)
+{
+    if (config.contains("collisionLayer"))
+    {
+        int parsed = ParseLayer(config["collisionLayer"]);
+        if (parsed >= 0)
+            layer = parsed;
+    }
+    if (config.contains("collisionMask"))
+        mask = ParseMask(config["collisionMask"]);
+}
+
+uint32_t CollisionLayers::ParseMask(const json &value)
+{
+    if (value.is_number_integer())
+        return value.get<uint32_t>();
+    if (value.is_string() && value.get<std::string>() == "all")
+        return ALL;
+    if (value.is_string())
+    {
+        int layer = ParseLayer(value);
+        return layer >= 0 ? LayerBit(layer) : 0u;
+    }
+    if (value.is_array())
+    {
+        uint32_t mask = 0;
+        for (const auto &item : value)
+        {
+            int layer = ParseLayer(item);
+            if (layer >= 0)
+                mask |= LayerBit(layer);
+        }
+        return mask;
+    }
+    std::cerr << "[CollisionLayers]: Invalid mask: " << value.dump() << std::endl;
+    return ALL;
+}
+
+void CollisionLayers::SetCollision(int layerA, int layerB, bool collide)
+{
+    if (collide)
+    {
+        m_matrix[layerA] |= LayerBit(layerB);
+        m_matrix[layerB] |= LayerBit(layerA);
+    }
+    else
+    {
+        m_matrix[layerA] &= ~LayerBit(layerB);
+        m_matrix[layerB] &= ~LayerBit(layerA);
+    }
+}
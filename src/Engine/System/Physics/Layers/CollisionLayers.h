@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+// 碰撞层与层矩阵
+// 每个刚体属于一层 (0~31), 并带一个掩码; 两物体相互检测需满足
+//   1. 双方掩码都包含对方所在层
+//   2. 场景层矩阵允许这两层相互检测
+// 层名在首次出现时自动注册, 第 0 层固定为 "Default"
+class CollisionLayers
+{
+public:
+    static constexpr int MAX_LAYERS = 32;
+    static constexpr uint32_t ALL = 0xFFFFFFFFu;
+
+    CollisionLayers() { Clear(); }
+
+    // "layers": {"names": [...], "ignore": [["bullet", "bullet"], ...]}
+    void Initialize(const json &config);
+    void Clear();
+
+    // 不存在时注册, 层数用尽返回 -1
+    int GetOrAddLayer(const std::string &name);
+    int FindLayer(const std::string &name) const;
+    const std::string &GetLayerName(int layer) const { return m_names[layer]; }
+    int GetLayerCount() const { return (int)m_names.size(); }
+
+    // 层名或层号
+    int ParseLayer(const json &value);
+    // 整数, 层名, 或层名数组; "all" 表示全部层
+    uint32_t ParseMask(const json &value);
+    // 刚体配置中的 "collisionLayer" / "collisionMask", 未配置或无效时保留原值
+    void ParseBodyLayer(const json &config, int &layer, uint32_t &mask);
+
+    void SetCollision(int layerA, int layerB, bool collide);
+    // 该层在层矩阵中允许检测的层
+    uint32_t GetMatrixRow(int layer) const { return m_matrix[layer]; }
+    // 刚体掩码与层矩阵合并后的有效掩码
+    uint32_t GetEffectiveMask(int layer, uint32_t mask) const { return mask & m_matrix[layer]; }
+
+    static uint32_t LayerBit(int layer) { return 1u << layer; }
+    // 有效掩码已包含层矩阵, 双向检查保证对称
+    static bool ShouldCollide(int layerA, uint32_t effectiveMaskA, int layerB, uint32_t effectiveMaskB)
+    {
+        return (effectiveMaskA & LayerBit(layerB)) && (effectiveMaskB & LayerBit(layerA));
+    }
+
+private:
+    std::vector<std::string> m_names;
+    uint32_t m_matrix[MAX_LAYERS];
+};
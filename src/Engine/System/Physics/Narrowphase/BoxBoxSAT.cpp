@@ -0,0 +1,186 @@
+#include "BoxBoxSAT.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include <cstring>
+#include <limits>
+
+#ifdef NW_MATH_SSE
+namespace
+{
+    // 候选轴编号: 0-2 A 的面, 3-5 B 的面, 6-14 A 的边 x B 的边 (6 + i * 3 + j)
+    // 每组 4 条轴, 用到时才构造, 前面的组找到分离轴就不再构造后面的边轴
+    constexpr int GROUP_COUNT = 4;
+    constexpr int GROUP_AXES[GROUP_COUNT][4] = {{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}, {12, 13, 14, -1}};
+
+    // 盒子的分量拷贝, 避免逐分量调用 Vector3f 的访问函数
+    struct BoxData
+    {
+        float axes[3][3];
+        float extent[3];
+        float center[3];
+
+        explicit BoxData(const HitBox &box)
+        {
+            static_assert(sizeof(Vector3f) == 3 * sizeof(float), "Vector3f must be three packed floats");
+            std::memcpy(axes, box.axes, sizeof(axes));
+            std::memcpy(extent, &box.halfExtents, sizeof(extent));
+            std::memcpy(center, &box.center, sizeof(center));
+        }
+    };
+
+    inline __m128 Abs(__m128 x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+    // x0 * y0 + x1 * y1 + x2 * y2, 与 Vector3f 点积的求值顺序一致
+    inline __m128 Dot(__m128 x0, __m128 x1, __m128 x2, __m128 y0, __m128 y1, __m128 y2)
+    {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, y0), _mm_mul_ps(x1, y1)), _mm_mul_ps(x2, y2));
+    }
+
+    // 盒子在各通道轴上的投影半径, 对应 HitBox::GetProjectionRadius
+    struct BoxLanes
+    {
+        __m128 ax[3], ay[3], az[3];
+        __m128 extent[3];
+
+        explicit BoxLanes(const BoxData &box)
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                ax[i] = _mm_set1_ps(box.axes[i][0]);
+                ay[i] = _mm_set1_ps(box.axes[i][1]);
+                az[i] = _mm_set1_ps(box.axes[i][2]);
+                extent[i] = _mm_set1_ps(box.extent[i]);
+            }
+        }
+        __m128 Radius(__m128 nx, __m128 ny, __m128 nz) const
+        {
+            __m128 r = _mm_setzero_ps();
+            for (int i = 0; i < 3; i++)
+                r = _mm_add_ps(r, _mm_mul_ps(extent[i], Abs(Dot(ax[i], ay[i], az[i], nx, ny, nz))));
+            return r;
+        }
+    };
+
+    // 第 index 条候选轴 (未归一化), 边轴与 Vector3f 叉乘的公式一致; -1 为补齐用的零向量
+    inline void GetAxis(const BoxData &a, const BoxData &b, int index, float out[3])
+    {
+        if (index < 0)
+        {
+            out[0] = out[1] = out[2] = 0.0f;
+            return;
+        }
+        if (index < 6)
+        {
+            const float *axis = index < 3 ? a.axes[index] : b.axes[index - 3];
+            out[0] = axis[0];
+            out[1] = axis[1];
+            out[2] = axis[2];
+            return;
+        }
+        const float *u = a.axes[(index - 6) / 3];
+        const float *v = b.axes[(index - 6) % 3];
+        out[0] = u[1] * v[2] - u[2] * v[1];
+        out[1] = u[2] * v[0] - u[0] * v[2];
+        out[2] = u[0] * v[1] - u[1] * v[0];
+    }
+
+    // 返回 false 表示存在分离轴; 否则给出最小穿透的单位轴 (未定向) 及其编号
+    bool FindAxis(const HitBox &boxA, const HitBox &boxB, Vector3f &outAxis, float &outPenetration, int &outIndex)
+    {
+        const BoxData a(boxA), b(boxB);
+        const BoxLanes lanesA(a), lanesB(b);
+        const __m128 dx = _mm_set1_ps(b.center[0] - a.center[0]);
+        const __m128 dy = _mm_set1_ps(b.center[1] - a.center[1]);
+        const __m128 dz = _mm_set1_ps(b.center[2] - a.center[2]);
+        const __m128 minLengthSq = _mm_set1_ps(0.0001f);
+        const __m128 separation = _mm_set1_ps(0.05f);
+
+        // 每个通道记录各自的最小穿透与编号, 最后跨通道归约
+        __m128 bestPen = _mm_set1_ps(std::numeric_limits<float>::max());
+        __m128 bestIndex = _mm_set1_ps(-1.0f);
+        for (int g = 0; g < GROUP_COUNT; g++)
+        {
+            alignas(16) float axes[4][4];
+            for (int lane = 0; lane < 4; lane++)
+                GetAxis(a, b, GROUP_AXES[g][lane], axes[lane]);
+            __m128 x = _mm_load_ps(axes[0]), y = _mm_load_ps(axes[1]), z = _mm_load_ps(axes[2]), w = _mm_load_ps(axes[3]);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            __m128 lengthSq = Dot(x, y, z, x, y, z);
+            // 退化轴 (平行的边) 不参与测试
+            __m128 valid = _mm_cmpge_ps(lengthSq, minLengthSq);
+            __m128 length = _mm_sqrt_ps(lengthSq);
+            x = _mm_div_ps(x, length);
+            y = _mm_div_ps(y, length);
+            z = _mm_div_ps(z, length);
+
+            __m128 dist = Abs(Dot(dx, dy, dz, x, y, z));
+            __m128 pen = _mm_sub_ps(_mm_add_ps(lanesA.Radius(x, y, z), lanesB.Radius(x, y, z)), dist);
+            if (_mm_movemask_ps(_mm_and_ps(valid, _mm_cmple_ps(pen, separation))))
+                return false;
+
+            __m128 index = _mm_setr_ps((float)GROUP_AXES[g][0], (float)GROUP_AXES[g][1], (float)GROUP_AXES[g][2], (float)GROUP_AXES[g][3]);
+            __m128 better = _mm_and_ps(valid, _mm_cmplt_ps(pen, bestPen));
+            bestPen = _mm_or_ps(_mm_and_ps(better, pen), _mm_andnot_ps(better, bestPen));
+            bestIndex = _mm_or_ps(_mm_and_ps(better, index), _mm_andnot_ps(better, bestIndex));
+        }
+
+        // 穿透相同时取编号小的轴, 与逐轴测试的结果一致
+        alignas(16) float pens[4], indices[4];
+        _mm_store_ps(pens, bestPen);
+        _mm_store_ps(indices, bestIndex);
+        int best = -1;
+        float minPen = std::numeric_limits<float>::max();
+        for (int lane = 0; lane < 4; lane++)
+        {
+            if (indices[lane] < 0.0f)
+                continue;
+            if (best < 0 || pens[lane] < minPen || (pens[lane] == minPen && (int)indices[lane] < best))
+            {
+                minPen = pens[lane];
+                best = (int)indices[lane];
+            }
+        }
+        if (best < 0)
+            return false;
+        float axis[3];
+        GetAxis(a, b, best, axis);
+        outAxis = Vector3f(axis[0], axis[1], axis[2]);
+        outAxis.Normalize();
+        outPenetration = minPen;
+        outIndex = best;
+        return true;
+    }
+}
+
+bool BoxBoxSAT::Collide(const HitBox &a, const HitBox &b, Vector3f &normal, float &penetration, Vector3f &hitPoint)
+{
+    Vector3f axis;
+    float pen;
+    int index;
+    if (!FindAxis(a, b, axis, pen, index))
+        return false;
+    penetration = pen;
+    normal = axis;
+    if (normal * (b.center - a.center) < 0)
+        normal = -normal;
+    hitPoint = HitBox::GetBoxBoxContactPoint(a, b, normal, index);
+    return true;
+}
+#else
+bool BoxBoxSAT::Collide(const HitBox &a, const HitBox &b, Vector3f &normal, float &penetration, Vector3f &hitPoint)
+{
+    return HitBox::GetCollisionInfoBOXBOX(a, b, normal, penetration, hitPoint);
+}
+#endif
+
+size_t BoxBoxSAT::CollideBatch(const HitBox *a, const HitBox *b, size_t count, BoxContact *out)
+{
+    size_t hits = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        BoxContact &contact = out[i];
+        contact.hit = GetCollisionInfo(a[i], b[i], contact.normal, contact.penetration, contact.hitPoint);
+        if (contact.hit)
+            hits++;
+    }
+    return hits;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Math.h"
+#include <cstddef>
+
+// 一对碰撞盒的窄检测结果
+struct BoxContact
+{
+    bool hit = false;
+    Vector3f normal; // a->b
+    float penetration = 0.0f;
+    Vector3f hitPoint;
+};
+
+// OBB-OBB 分离轴测试: 15 条候选轴排成 4 组, 每组 4 条轴在 SSE 的 4 个通道中同时测试, 任一组出现分离轴即返回
+// 轴的构造与运算顺序与 HitBox::GetCollisionInfoBOXBOX 一致, 结果逐位相同; 无 SSE 时直接调用后者
+namespace BoxBoxSAT
+{
+    // 与 HitBox::GetCollisionInfoBOXBOX 相同的语义
+    bool Collide(const HitBox &a, const HitBox &b, Vector3f &normal, float &penetration, Vector3f &hitPoint);
+    // 双方都是 BOX 时走 Collide, 其余组合交给 HitBox::GetCollisionInfo
+    inline bool GetCollisionInfo(const HitBox &a, const HitBox &b, Vector3f &normal, float &penetration, Vector3f &hitPoint)
+    {
+        if (a.colliderType == ColliderType::BOX && b.colliderType == ColliderType::BOX)
+            return Collide(a, b, normal, penetration, hitPoint);
+        return HitBox::GetCollisionInfo(a, b, normal, penetration, hitPoint);
+    }
+    // 批量检测 a[i] 与 b[i] (任意碰撞体组合), 结果写入 out[i], 返回接触数
+    size_t CollideBatch(const HitBox *a, const HitBox *b, size_t count, BoxContact *out);
+}
@@ -3,4 +3,5 @@
 #include "Engine/System/Physics/Stages/CollisionStage.h"
 #include "Engine/System/Physics/Stages/CollisionEvent.h"
 #include "Engine/System/Physics/Stages/GravityStage.h"
+#include "Engine/System/Physics/Stages/FlightDynamicsStage.h"
 #include "Engine/System/Physics/PhysicsStageFactory.h"
\ No newline at end of file
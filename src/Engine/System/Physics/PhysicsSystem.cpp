@@ -3,94 +3,327 @@
 #include "Engine/Core/Components/TransformComponent.h"
 #include "Engine/Core/Components/RigidBodyComponent.h"
 #include "Engine/Math/Math.h"
+#include "Engine/System/Ray/mRay.h"
+#include "Engine/Config/Config.h"
+#include <algorithm>
+#include <iostream>
 #include <limits>
-void PhysicsSystem::AddStage(std::unique_ptr<IPhysicsStage> stage)
+
+namespace
+{
+    // 系统内置阶段, 统计槽位排在各 IPhysicsStage 之后
+    enum BuiltinStage
+    {
+        INTEGRATE,
+        ISLANDS,
+        EVENTS,
+        BUILTIN_COUNT,
+    };
+    const char *const BUILTIN_NAMES[BUILTIN_COUNT] = {"Integrate", "Islands", "Events"};
+}
+
+PhysicsSystem::PhysicsSystem()
+{
+    m_raycastScene.SetStaticGeometry(&m_staticGeometry);
+}
+
+PhysicsSystem::~PhysicsSystem()
+{
+    WriteTrace();
+}
+
+void PhysicsSystem::AddStage(std::unique_ptr<IPhysicsStage> stage, const std::string &name)
 {
     m_stages.push_back(std::move(stage));
+    m_stageNames.push_back(name);
+    ResetStats();
 }
 
 void PhysicsSystem::ClearStages()
 {
+    WriteTrace();
     m_stages.clear();
+    m_stageNames.clear();
+    m_contactSolver.Clear();
+    m_trace.Clear();
+    ResetStats();
+}
+
+void PhysicsSystem::InitializeProfiling(const json &config)
+{
+    m_profiling = config.value("enable", true);
+    m_trace.SetCapacity((size_t)std::max(0, config.value("trace", 0)));
+    m_traceFile = config.value("file", "");
+}
+
+void PhysicsSystem::ResetStats()
+{
+    m_stats.stages.resize(m_stages.size() + BUILTIN_COUNT);
+    for (size_t i = 0; i < m_stages.size(); i++)
+        m_stats.stages[i].name = m_stageNames[i];
+    for (int i = 0; i < BUILTIN_COUNT; i++)
+        m_stats.stages[m_stages.size() + i].name = BUILTIN_NAMES[i];
+    for (auto &stage : m_stats.stages)
+        stage.Reset();
+}
+
+void PhysicsSystem::WriteTrace()
+{
+    if (m_traceFile.empty() || m_trace.Size() == 0)
+        return;
+    if (m_trace.Dump(m_traceFile) && __SHOWINFO__)
+        std::cout << "[PhysicsSystem]: Physics trace (" << m_trace.Size() << " steps) written to " << m_traceFile << std::endl;
 }
 
 void PhysicsSystem::Update(GameWorld &world, float fixedDeltaTime)
 {
+    const bool profiling = m_profiling;
+    if (m_stats.stages.size() != m_stages.size() + BUILTIN_COUNT)
+        ResetStats();
+    PhysicsTimer stepTimer;
+    PhysicsTimer timer;
 
-    for (auto &stage : m_stages)
+    m_contactSolver.BeginStep();
+    m_islandManager.BeginStep();
+    m_islandManager.WakeDisturbed(world);
+    for (size_t i = 0; i < m_stages.size(); i++)
     {
-        stage->Execute(world, fixedDeltaTime);
+        m_stages[i]->Execute(world, fixedDeltaTime);
+        if (profiling)
+        {
+            StageStats &stats = m_stats.stages[i];
+            stats.Reset();
+            stats.totalMs = timer.Lap();
+            m_stages[i]->GetStats(stats);
+        }
     }
 
-    Integrate(world, fixedDeltaTime);
+    StageStats &integrate = m_stats.stages[m_stages.size() + INTEGRATE];
+    if (profiling)
+    {
+        integrate.Reset();
+        timer.Lap();
+    }
+    if (m_integrator == IntegratorType::BATCH)
+    {
+        GatherBatch(world);
+        BatchIntegrator::IntegrateVelocities(m_batch, fixedDeltaTime);
+        m_batch.ScatterVelocities();
+        m_integratedCount = m_batch.Size();
+        if (profiling)
+            integrate.AddSection("velocity", timer.Lap());
+        m_contactSolver.Solve(fixedDeltaTime);
+        if (profiling)
+            integrate.AddSection("solver", timer.Lap());
+        SolveContinuous(world, fixedDeltaTime);
+        if (profiling)
+            integrate.AddSection("ccd", timer.Lap());
+        // 求解器或 CCD 改写过速度时重新读取
+        if (m_contactSolver.HasContacts() || m_continuousCollision.GetStats().hits > 0)
+            m_batch.GatherVelocities();
+        if (m_continuousCollision.GetStats().hits > 0)
+            m_batch.SyncContinuous();
+        BatchIntegrator::IntegratePositions(m_batch, fixedDeltaTime);
+        m_batch.ScatterTransforms();
+        if (profiling)
+            integrate.AddSection("position", timer.Lap());
+    }
+    else
+    {
+        IntegrateVelocities(world, fixedDeltaTime);
+        if (profiling)
+            integrate.AddSection("velocity", timer.Lap());
+        m_contactSolver.Solve(fixedDeltaTime);
+        if (profiling)
+            integrate.AddSection("solver", timer.Lap());
+        SolveContinuous(world, fixedDeltaTime);
+        if (profiling)
+            integrate.AddSection("ccd", timer.Lap());
+        IntegratePositions(world, fixedDeltaTime);
+        if (profiling)
+            integrate.AddSection("position", timer.Lap());
+    }
+    m_islandManager.Update(world, fixedDeltaTime);
+    const double islandMs = profiling ? timer.Lap() : 0.0;
+    const size_t events = m_contactSolver.EmitEvents(world.GetEventManager());
+
+    if (!profiling)
+        return;
+    for (const auto &section : integrate.sections)
+        integrate.totalMs += section.ms;
+    integrate.AddCounter("bodies", m_integratedCount);
+    integrate.AddCounter("manifolds", m_contactSolver.GetManifoldCount());
+    integrate.AddCounter("ccdSwept", m_continuousCollision.GetStats().sweptBodies);
+    integrate.AddCounter("ccdHits", m_continuousCollision.GetStats().hits);
+
+    StageStats &islands = m_stats.stages[m_stages.size() + ISLANDS];
+    islands.Reset();
+    islands.totalMs = islandMs;
+    islands.AddCounter("islands", m_islandManager.GetIslandCount());
+    islands.AddCounter("sleeping", m_islandManager.GetSleepingCount());
+
+    StageStats &emit = m_stats.stages[m_stages.size() + EVENTS];
+    emit.Reset();
+    emit.totalMs = timer.Lap();
+    emit.AddCounter("events", events);
+
+    m_stats.step++;
+    m_stats.totalMs = stepTimer.Lap();
+    m_trace.Record(m_stats);
+}
+
+void PhysicsSystem::SolveContinuous(GameWorld &world, float fixedDeltaTime)
+{
+    m_continuousCollision.Solve(world.GetActivateGameObjects(), fixedDeltaTime, &m_collisionLayers, &m_staticGeometry,
+                                &world.GetEventManager());
+}
+
+bool PhysicsSystem::ShouldIntegrate(RigidbodyComponent &rb)
+{
+    // 如果质量为0，不移动
+    if (std::abs(rb.mass) <= std::numeric_limits<float>::min())
+        return false;
+    // 休眠物体的速度被外部改写时唤醒
+    if (rb.isSleeping)
+    {
+        if (rb.velocity.LengthSquared() > 0.0f || rb.angularMomentum.LengthSquared() > 0.0f)
+            rb.WakeUp();
+        else
+            return false;
+    }
+    return true;
+}
+
+void PhysicsSystem::GatherBatch(GameWorld &world)
+{
+    m_batch.Clear();
+    for (auto *object : world.GetActivateGameObjects())
+    {
+        if (object->HasComponent<RigidbodyComponent>() && object->HasComponent<TransformComponent>())
+        {
+            auto &rb = object->GetComponent<RigidbodyComponent>();
+            if (ShouldIntegrate(rb))
+                m_batch.Add(&rb, &object->GetComponent<TransformComponent>());
+        }
+    }
+    m_batch.Finalize();
 }
 
-void PhysicsSystem::Integrate(GameWorld &world, float fixedDeltaTime)
+void PhysicsSystem::IntegrateVelocities(GameWorld &world, float fixedDeltaTime)
 {
+    m_integratedCount = 0;
     for (auto *object : world.GetActivateGameObjects())
     {
         if (object->HasComponent<RigidbodyComponent>() && object->HasComponent<TransformComponent>())
         {
             auto &rb = object->GetComponent<RigidbodyComponent>();
-            auto &tf = object->GetComponent<TransformComponent>();
+            if (ShouldIntegrate(rb))
+            {
+                IntegrateBodyVelocity(rb, object->GetComponent<TransformComponent>(), fixedDeltaTime);
+                m_integratedCount++;
+            }
+        }
+    }
+}
 
-            // 1. F = ma  =>  a = F / m
-            // 如果质量为0，不移动
-            if (std::abs(rb.mass) <= std::numeric_limits<float>::min())
+void PhysicsSystem::IntegratePositions(GameWorld &world, float fixedDeltaTime)
+{
+    for (auto *object : world.GetActivateGameObjects())
+    {
+        if (object->HasComponent<RigidbodyComponent>() && object->HasComponent<TransformComponent>())
+        {
+            auto &rb = object->GetComponent<RigidbodyComponent>();
+            if (std::abs(rb.mass) <= std::numeric_limits<float>::min() || rb.isSleeping)
                 continue;
+            IntegrateBodyPosition(rb, object->GetComponent<TransformComponent>(), fixedDeltaTime);
+        }
+    }
+}
 
-            Vector3f acceleration = rb.accumulatedForces / rb.mass;
-
-            // 2. v = v + a * t
-            rb.velocity += acceleration * fixedDeltaTime;
+void PhysicsSystem::IntegrateBodyVelocity(RigidbodyComponent &rb, TransformComponent &tf, float fixedDeltaTime)
+{
+    // 朝向可能在物理步之外被脚本、网络同步或传送改写, 按当前朝向刷新世界系逆惯性
+    rb.UpdateWorldInertia(tf.GetWorldRotation());
 
-            // v = v * (1 - drag * t)
-            float dragFactor = 1.0f - (rb.drag * fixedDeltaTime);
-            if (dragFactor < 0)
-                dragFactor = 0;
-            rb.velocity *= dragFactor;
+    // 1. F = ma  =>  a = F / m
+    Vector3f acceleration = rb.accumulatedForces / rb.mass;
 
-            // 4. p = p + v * t
+    // 2. v = v + a * t
+    rb.velocity += acceleration * fixedDeltaTime;
 
-            Vector3f pos = tf.GetWorldPosition();
-            Quat4f rot = tf.GetWorldRotation();
-            Vector3f scale = tf.GetWorldScale();
-            pos += rb.velocity * fixedDeltaTime;
-            // tf.SetLocalPosition(tf.GetLocalPosition() + rb.velocity * fixedDeltaTime);
-            tf.SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scale));
+    // v = v * (1 - drag * t)
+    float dragFactor = 1.0f - (rb.drag * fixedDeltaTime);
+    if (dragFactor < 0)
+        dragFactor = 0;
+    rb.velocity *= dragFactor;
 
-            // angluar velocity
-            Matrix3f rotationMatrix = rot.toMatrix();
-            Matrix3f worldInverseInertia = rotationMatrix * rb.inverseInertiaTensor * rotationMatrix.transposed();
+    // angluar velocity
+    rb.angularMomentum += rb.accumulatedTorques * fixedDeltaTime;
 
-            rb.angularMomentum += rb.accumulatedTorques * fixedDeltaTime;
+    float angularDragFactor = 1.0f - (rb.angularDrag * fixedDeltaTime);
+    if (angularDragFactor < 0)
+        angularDragFactor = 0;
+    rb.angularMomentum *= angularDragFactor;
 
-            float angularDragFactor = 1.0f - (rb.angularDrag * fixedDeltaTime);
-            if (angularDragFactor < 0)
-                angularDragFactor = 0;
-            rb.angularMomentum *= angularDragFactor;
+    rb.angularVelocity = rb.worldInverseInertia * rb.angularMomentum;
+}
 
-            rb.angularVelocity = worldInverseInertia * rb.angularMomentum;
+void PhysicsSystem::IntegrateBodyPosition(RigidbodyComponent &rb, TransformComponent &tf, float fixedDeltaTime)
+{
+    // 4. p = p + v * t
 
-            if (rb.angularVelocity.Length() > std::numeric_limits<float>::min())
-            {
-                // 角速度四元数 (0, ωx, ωy, ωz)
-                Quat4f omegaQuat(0, rb.angularVelocity.x(), rb.angularVelocity.y(), rb.angularVelocity.z());
+    Vector3f pos = tf.GetWorldPosition();
+    Quat4f rot = tf.GetWorldRotation();
+    Vector3f scale = tf.GetWorldScale();
+    // CCD 已推进过位置
+    if (!rb.ccdIntegrated)
+        pos += rb.velocity * fixedDeltaTime;
+    rb.ccdIntegrated = false;
 
-                // dq/dt = 0.5 * w * q
-                // 世界系w左乘
-                Quat4f dq = (omegaQuat * rot) * 0.5f;
+    if (rb.angularVelocity.Length() > std::numeric_limits<float>::min())
+    {
+        // 角速度四元数 (0, ωx, ωy, ωz)
+        Quat4f omegaQuat(0, rb.angularVelocity.x(), rb.angularVelocity.y(), rb.angularVelocity.z());
 
-                // 欧拉方法积分 q(t+dt) = q(t) + dq*dt
-                rot = rot + dq * fixedDeltaTime;
+        // dq/dt = 0.5 * w * q
+        // 世界系w左乘
+        Quat4f dq = (omegaQuat * rot) * 0.5f;
 
-                // 归一化
-                rot.normalize();
+        // 欧拉方法积分 q(t+dt) = q(t) + dq*dt
+        rot = rot + dq * fixedDeltaTime;
 
-                tf.SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scale));
-            }
-            // 5. 清理受力
-            rb.ClearForces();
-        }
+        // 归一化
+        rot.normalize();
     }
-}
\ No newline at end of file
+    tf.SetWorldMatrix(Matrix4f::CreateTransform(pos, rot, scale));
+    // 下一步积分前的检测阶段 (接触、重力地面) 也读世界系逆惯性, 朝向变化后立即刷新
+    rb.UpdateWorldInertia(rot);
+
+    // 5. 清理受力
+    rb.ClearForces();
+}
+
+const RaycastScene &PhysicsSystem::SyncRaycastScene(GameWorld &world)
+{
+    m_raycastScene.Sync(world.GetActivateGameObjects());
+    return m_raycastScene;
+}
+
+int PhysicsSystem::OverlapSphere(GameWorld &world, const Vector3f &center, float radius, GameObject **outResults, int capacity,
+                                 GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic)
+{
+    return SyncRaycastScene(world).OverlapSphere(center, radius, outResults, capacity, ignoreEntity, layerMask, outStatic);
+}
+
+int PhysicsSystem::OverlapBox(GameWorld &world, const Vector3f &center, const Vector3f &halfExtents, const Quat4f &rotation,
+                              GameObject **outResults, int capacity, GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic)
+{
+    return SyncRaycastScene(world).OverlapBox(center, halfExtents, rotation, outResults, capacity, ignoreEntity, layerMask, outStatic);
+}
+
+bool PhysicsSystem::SphereCast(GameWorld &world, const Vector3f &origin, const Vector3f &direction, float radius, float maxDistance,
+                               mRaycastHit &outHit, GameObject *ignoreEntity, uint32_t layerMask)
+{
+    outHit = SyncRaycastScene(world).SphereCast(origin, direction, radius, maxDistance, ignoreEntity, layerMask);
+    return outHit.hit;
+}
@@ -1,18 +1,112 @@
 #pragma once
 #include "IPhysicsStage.h"
+#include "Solver/ContactSolver.h"
+#include "Sleep/IslandManager.h"
+#include "Integrator/BatchIntegrator.h"
+#include "Layers/CollisionLayers.h"
+#include "Static/StaticGeometry.h"
+#include "CCD/ContinuousCollision.h"
+#include "Engine/System/Ray/RaycastScene.h"
+#include "Profiling/PhysicsStats.h"
+#include "Profiling/PhysicsTrace.h"
 #include <vector>
 #include <memory>
+#include <string>
+
+struct RigidbodyComponent;
+class TransformComponent;
+
+enum class IntegratorType
+{
+    SCALAR, // 逐物体
+    BATCH,  // 打包后 SIMD 批量积分
+};
 
 class PhysicsSystem {
 public:
+    PhysicsSystem();
+    ~PhysicsSystem();
     void Update(GameWorld& world, float fixedDeltaTime);
-    void AddStage(std::unique_ptr<IPhysicsStage> stage);
+    // name 用于统计与跟踪输出
+    void AddStage(std::unique_ptr<IPhysicsStage> stage, const std::string &name = "Stage");
     void ClearStages();
+    // 按类型查找已添加的阶段, 没有时返回 nullptr
+    template <typename T>
+    T *FindStage() const
+    {
+        for (const auto &stage : m_stages)
+        {
+            if (auto *found = dynamic_cast<T *>(stage.get()))
+                return found;
+        }
+        return nullptr;
+    }
+
+    // "profile": {"enable": true, "trace": 600, "file": "physics_trace.csv"}
+    // file 非空时在清空阶段 (切换场景) 与析构时写出跟踪
+    void InitializeProfiling(const json &config);
+    void SetProfiling(bool enabled) { m_profiling = enabled; }
+    bool IsProfiling() const { return m_profiling; }
+    // 最近一步的统计, 仅在开启 profiling 时更新
+    const PhysicsStepStats &GetStats() const { return m_stats; }
+    PhysicsTrace &GetTrace() { return m_trace; }
+    bool DumpTrace(const std::string &path) const { return m_trace.Dump(path); }
+
+    // 各阶段上报接触, 在速度积分后统一求解
+    ContactSolver &GetContactSolver() { return m_contactSolver; }
+    IslandManager &GetIslandManager() { return m_islandManager; }
+    CollisionLayers &GetCollisionLayers() { return m_collisionLayers; }
+    StaticGeometry &GetStaticGeometry() { return m_staticGeometry; }
+    ContinuousCollision &GetContinuousCollision() { return m_continuousCollision; }
+    // mRay 查询用的 BVH, 由 GameWorld 标记失效; 查询同时检测 StaticGeometry
+    RaycastScene &GetRaycastScene() { return m_raycastScene; }
+    // 失效时先重建, 之后的查询只读
+    const RaycastScene &SyncRaycastScene(GameWorld &world);
+
+    // 场景查询: 结果写入调用方提供的缓冲区, 不分配内存; 两次物理步之间可多线程调用
+    // 静态几何命中时 entity 为空; Overlap 的 outStatic 非空时写入是否与静态几何重叠
+    int OverlapSphere(GameWorld &world, const Vector3f &center, float radius, GameObject **outResults, int capacity,
+                      GameObject *ignoreEntity = nullptr, uint32_t layerMask = CollisionLayers::ALL, bool *outStatic = nullptr);
+    int OverlapBox(GameWorld &world, const Vector3f &center, const Vector3f &halfExtents, const Quat4f &rotation,
+                   GameObject **outResults, int capacity, GameObject *ignoreEntity = nullptr, uint32_t layerMask = CollisionLayers::ALL,
+                   bool *outStatic = nullptr);
+    bool SphereCast(GameWorld &world, const Vector3f &origin, const Vector3f &direction, float radius, float maxDistance,
+                    mRaycastHit &outHit, GameObject *ignoreEntity = nullptr, uint32_t layerMask = CollisionLayers::ALL);
+
+    void SetIntegrator(IntegratorType type) { m_integrator = type; }
+    IntegratorType GetIntegrator() const { return m_integrator; }
+
+    // 单个刚体的积分步骤, 逐物体路径与基准测试共用
+    static void IntegrateBodyVelocity(RigidbodyComponent &rb, TransformComponent &tf, float fixedDeltaTime);
+    static void IntegrateBodyPosition(RigidbodyComponent &rb, TransformComponent &tf, float fixedDeltaTime);
 
 private:
     // 不同物理规则
     std::vector<std::unique_ptr<IPhysicsStage>> m_stages;
+    std::vector<std::string> m_stageNames;
+    ContactSolver m_contactSolver;
+    IslandManager m_islandManager;
+    CollisionLayers m_collisionLayers;
+    StaticGeometry m_staticGeometry;
+    ContinuousCollision m_continuousCollision;
+    RaycastScene m_raycastScene;
+    IntegratorType m_integrator = IntegratorType::SCALAR;
+    BodyBatch m_batch;
+
+    bool m_profiling = false;
+    PhysicsStepStats m_stats;
+    PhysicsTrace m_trace;
+    std::string m_traceFile;
+    size_t m_integratedCount = 0;
     
-    // 半euler积分
-    void Integrate(GameWorld& world, float fixedDeltaTime);
+    // 半euler积分, 拆为速度/位置两步, 中间插入接触求解
+    void IntegrateVelocities(GameWorld& world, float fixedDeltaTime);
+    void IntegratePositions(GameWorld& world, float fixedDeltaTime);
+    // 收集需要积分的刚体, 返回 false 表示跳过 (静态或休眠)
+    static bool ShouldIntegrate(RigidbodyComponent &rb);
+    void GatherBatch(GameWorld& world);
+    void SolveContinuous(GameWorld& world, float fixedDeltaTime);
+    // 阶段列表变化后重建统计槽位, 内置阶段排在最后
+    void ResetStats();
+    void WriteTrace();
 };
\ No newline at end of file
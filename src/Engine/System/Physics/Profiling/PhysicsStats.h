@@ -0,0 +1,63 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 一个阶段一步内的耗时与计数
+// 分段名与计数名使用字符串字面量, 容器每步清空复用, 稳定后不再分配
+struct StageStats
+{
+    struct Section
+    {
+        const char *name;
+        double ms;
+    };
+    struct Counter
+    {
+        const char *name;
+        size_t value;
+    };
+
+    std::string name;
+    double totalMs = 0.0;
+    std::vector<Section> sections;
+    std::vector<Counter> counters;
+
+    void Reset()
+    {
+        totalMs = 0.0;
+        sections.clear();
+        counters.clear();
+    }
+    void AddSection(const char *sectionName, double ms) { sections.push_back({sectionName, ms}); }
+    void AddCounter(const char *counterName, size_t value) { counters.push_back({counterName, value}); }
+};
+
+// PhysicsSystem::Update 一步的统计, stages 依次为各 IPhysicsStage 与系统内置阶段
+struct PhysicsStepStats
+{
+    uint64_t step = 0;
+    double totalMs = 0.0;
+    std::vector<StageStats> stages;
+};
+
+// 分段计时, Lap 返回距上次 Lap 的毫秒数
+class PhysicsTimer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    PhysicsTimer() : m_last(Clock::now()) {}
+    double Lap()
+    {
+        Clock::time_point now = Clock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - m_last).count();
+        m_last = now;
+        return ms;
+    }
+
+private:
+    Clock::time_point m_last;
+};
@@ -0,0 +1,126 @@
+#include "PhysicsTrace.h"
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+void PhysicsTrace::SetCapacity(size_t capacity)
+{
+    m_capacity = capacity;
+    m_steps.assign(capacity, PhysicsStepStats());
+    m_head = 0;
+    m_count = 0;
+}
+
+void PhysicsTrace::Clear()
+{
+    m_head = 0;
+    m_count = 0;
+}
+
+void PhysicsTrace::Record(const PhysicsStepStats &stats)
+{
+    if (m_capacity == 0)
+        return;
+    // 赋值复用槽位已有的容量
+    m_steps[m_head] = stats;
+    m_head = (m_head + 1) % m_capacity;
+    if (m_count < m_capacity)
+        m_count++;
+}
+
+bool PhysicsTrace::Dump(const std::string &path) const
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        std::cerr << "[PhysicsTrace]: Failed to open trace file: " << path << std::endl;
+        return false;
+    }
+    const bool csv = path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+    if (csv)
+        WriteCSV(file);
+    else
+        WriteJSON(file);
+    return true;
+}
+
+void PhysicsTrace::WriteJSON(std::ostream &out) const
+{
+    json steps = json::array();
+    for (size_t i = 0; i < m_count; i++)
+    {
+        const PhysicsStepStats &step = At(i);
+        json stages = json::object();
+        for (const auto &stage : step.stages)
+        {
+            json sections = json::object();
+            for (const auto &section : stage.sections)
+                sections[section.name] = section.ms;
+            json counters = json::object();
+            for (const auto &counter : stage.counters)
+                counters[counter.name] = counter.value;
+            stages[stage.name] = {{"ms", stage.totalMs}, {"sections", sections}, {"counters", counters}};
+        }
+        steps.push_back({{"step", step.step}, {"ms", step.totalMs}, {"stages", stages}});
+    }
+    out << json{{"steps", steps}}.dump(2) << std::endl;
+}
+
+void PhysicsTrace::WriteCSV(std::ostream &out) const
+{
+    // 列按首次出现的顺序排列, 中途增删阶段时旧行对应列留空
+    std::vector<std::string> columns;
+    std::unordered_map<std::string, size_t> columnIndex;
+    auto column = [&](const std::string &name)
+    {
+        auto it = columnIndex.find(name);
+        if (it != columnIndex.end())
+            return it->second;
+        columnIndex[name] = columns.size();
+        columns.push_back(name);
+        return columns.size() - 1;
+    };
+
+    std::vector<std::vector<std::pair<size_t, double>>> rows(m_count);
+    for (size_t i = 0; i < m_count; i++)
+    {
+        const PhysicsStepStats &step = At(i);
+        for (const auto &stage : step.stages)
+        {
+            rows[i].push_back({column(stage.name + ".ms"), stage.totalMs});
+            for (const auto &section : stage.sections)
+                rows[i].push_back({column(stage.name + "." + section.name + ".ms"), section.ms});
+            for (const auto &counter : stage.counters)
+                rows[i].push_back({column(stage.name + "." + counter.name), (double)counter.value});
+        }
+    }
+
+    out << "step,ms";
+    for (const auto &name : columns)
+        out << "," << name;
+    out << "\n";
+    std::vector<double> values;
+    std::vector<bool> present;
+    for (size_t i = 0; i < m_count; i++)
+    {
+        values.assign(columns.size(), 0.0);
+        present.assign(columns.size(), false);
+        for (const auto &[index, value] : rows[i])
+        {
+            values[index] = value;
+            present[index] = true;
+        }
+        const PhysicsStepStats &step = At(i);
+        out << step.step << "," << step.totalMs;
+        for (size_t c = 0; c < columns.size(); c++)
+        {
+            out << ",";
+            if (present[c])
+                out << values[c];
+        }
+        out << "\n";
+    }
+}
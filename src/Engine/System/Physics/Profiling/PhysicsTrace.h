@@ -0,0 +1,32 @@
+#pragma once
+#include "PhysicsStats.h"
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// 最近 capacity 步统计的环形缓冲, 可导出为 JSON 或 CSV
+class PhysicsTrace
+{
+public:
+    void SetCapacity(size_t capacity);
+    size_t GetCapacity() const { return m_capacity; }
+    size_t Size() const { return m_count; }
+    void Clear();
+
+    void Record(const PhysicsStepStats &stats);
+
+    // 按扩展名选择格式 (.csv 为 CSV, 其余为 JSON)
+    bool Dump(const std::string &path) const;
+    void WriteJSON(std::ostream &out) const;
+    // 每步一行, 列为 "阶段.ms" / "阶段.分段.ms" / "阶段.计数", 缺失的列留空
+    void WriteCSV(std::ostream &out) const;
+
+private:
+    // 由旧到新的第 i 步
+    const PhysicsStepStats &At(size_t i) const { return m_steps[(m_head + m_capacity - m_count + i) % m_capacity]; }
+
+    size_t m_capacity = 0;
+    size_t m_head = 0; // 下一个写入位置
+    size_t m_count = 0;
+    std::vector<PhysicsStepStats> m_steps;
+};
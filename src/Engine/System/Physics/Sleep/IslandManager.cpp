@@ -0,0 +1,210 @@
+#include "IslandManager.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    template <typename T>
+    bool SameBits(const T &x, const T &y) { return std::memcmp(&x, &y, sizeof(T)) == 0; }
+}
+
+void IslandManager::Initialize(const json &config)
+{
+    m_enabled = config.value("enable", false);
+    m_linearThreshold = config.value("linearThreshold", 0.05f);
+    m_angularThreshold = config.value("angularThreshold", 0.05f);
+    m_timeToSleep = config.value("timeToSleep", 0.5f);
+}
+
+void IslandManager::BeginStep()
+{
+    m_contacts.clear();
+}
+
+void IslandManager::WakeDisturbed(GameWorld &world)
+{
+    m_present.clear();
+    if (!m_enabled || (m_sleepingCount == 0 && m_sleepContacts.empty()))
+        return;
+    for (auto *object : world.GetActivateGameObjects())
+    {
+        if (!object->HasComponent<RigidbodyComponent>() || !object->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        if (!rb.Collidable)
+            continue;
+        m_present.emplace_back(object->GetID(), object);
+        if (!rb.isSleeping)
+            continue;
+        // 缓存的包围盒已失效
+        const auto &tf = object->GetComponent<TransformComponent>();
+        if (!SameBits(tf.GetLocalPosition(), rb.sleepingPosition) || !SameBits(tf.GetLocalRotation(), rb.sleepingRotation))
+            rb.WakeUp();
+    }
+    std::sort(m_present.begin(), m_present.end());
+
+    // 失去支撑的一方醒来, 下落后与同岛物体的接触会唤醒整个岛
+    for (const auto &[idA, idB] : m_sleepContacts)
+    {
+        GameObject *a = FindPresent(idA);
+        GameObject *b = FindPresent(idB);
+        if (a && !b)
+            a->GetComponent<RigidbodyComponent>().WakeUp();
+        if (b && !a)
+            b->GetComponent<RigidbodyComponent>().WakeUp();
+    }
+}
+
+GameObject *IslandManager::FindPresent(unsigned int id) const
+{
+    auto it = std::lower_bound(m_present.begin(), m_present.end(), std::make_pair(id, (GameObject *)nullptr));
+    return it != m_present.end() && it->first == id ? it->second : nullptr;
+}
+
+int IslandManager::IndexOf(GameObject *object) const
+{
+    const int i = object->GetComponent<RigidbodyComponent>().islandIndex;
+    return i >= 0 && i < (int)m_bodies.size() && m_bodies[i] == object ? i : -1;
+}
+
+void IslandManager::AddContact(GameObject *a, GameObject *b)
+{
+    if (!m_enabled)
+        return;
+    m_contacts.emplace_back(a, b);
+}
+
+int IslandManager::Find(int i)
+{
+    while (m_parent[i] != i)
+    {
+        m_parent[i] = m_parent[m_parent[i]];
+        i = m_parent[i];
+    }
+    return i;
+}
+
+void IslandManager::Union(int a, int b)
+{
+    a = Find(a);
+    b = Find(b);
+    if (a == b)
+        return;
+    // 小下标为根, 保证结果与接触顺序无关
+    if (a < b)
+        m_parent[b] = a;
+    else
+        m_parent[a] = b;
+}
+
+void IslandManager::Update(GameWorld &world, float fixedDeltaTime)
+{
+    if (!m_enabled)
+        return;
+
+    m_bodies.clear();
+    for (auto *object : world.GetActivateGameObjects())
+    {
+        if (!object->HasComponent<RigidbodyComponent>() || !object->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        if (rb.mass <= std::numeric_limits<float>::min())
+            continue;
+        rb.islandIndex = (int)m_bodies.size();
+        m_bodies.push_back(object);
+    }
+
+    const int n = (int)m_bodies.size();
+    m_parent.resize(n);
+    for (int i = 0; i < n; i++)
+        m_parent[i] = i;
+    for (const auto &[a, b] : m_contacts)
+    {
+        const int ia = IndexOf(a);
+        const int ib = IndexOf(b);
+        if (ia >= 0 && ib >= 0)
+            Union(ia, ib);
+    }
+
+    // 单体能量判据, 岛的计时取最小值
+    const float linear2 = m_linearThreshold * m_linearThreshold;
+    const float angular2 = m_angularThreshold * m_angularThreshold;
+    m_islandTimer.assign(n, std::numeric_limits<float>::max());
+    for (int i = 0; i < n; i++)
+    {
+        auto &rb = m_bodies[i]->GetComponent<RigidbodyComponent>();
+        if (!rb.isSleeping)
+        {
+            if (rb.canSleep && rb.velocity.LengthSquared() < linear2 && rb.angularVelocity.LengthSquared() < angular2)
+                rb.sleepTimer += fixedDeltaTime;
+            else
+                rb.sleepTimer = 0.0f;
+        }
+        float timer = rb.isSleeping ? std::numeric_limits<float>::max() : rb.sleepTimer;
+        int root = Find(i);
+        m_islandTimer[root] = std::min(m_islandTimer[root], timer);
+    }
+
+    m_sleepingCount = 0;
+    m_islandCount = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int root = Find(i);
+        if (root == i)
+            m_islandCount++;
+        auto &rb = m_bodies[i]->GetComponent<RigidbodyComponent>();
+        if (m_islandTimer[root] >= m_timeToSleep)
+        {
+            if (!rb.isSleeping)
+            {
+                rb.isSleeping = true;
+                rb.velocity = Vector3f::ZERO;
+                rb.angularVelocity = Vector3f::ZERO;
+                rb.angularMomentum = Vector3f::ZERO;
+                rb.ClearForces();
+                rb.sleepingAABB = m_bodies[i]->GetWorldAABB();
+                const auto &tf = m_bodies[i]->GetComponent<TransformComponent>();
+                rb.sleepingPosition = tf.GetLocalPosition();
+                rb.sleepingRotation = tf.GetLocalRotation();
+            }
+            m_sleepingCount++;
+        }
+        else
+        {
+            rb.WakeUp();
+        }
+    }
+    RecordSleepContacts();
+}
+
+void IslandManager::RecordSleepContacts()
+{
+    // 静止接触在相邻步之间可能时有时无, 从开始低能量计时起就累积, 入睡那一步没有接触也不会漏掉支撑物
+    auto isResting = [](GameObject *object)
+    {
+        const auto &rb = object->GetComponent<RigidbodyComponent>();
+        return rb.isSleeping || rb.sleepTimer > 0.0f;
+    };
+    m_nextSleepContacts.clear();
+    // 上一份记录中两端仍在 (m_present 为本步开始时的快照) 且至少一方仍静止的保留
+    for (const auto &[idA, idB] : m_sleepContacts)
+    {
+        GameObject *a = FindPresent(idA);
+        GameObject *b = FindPresent(idB);
+        if (a && b && (isResting(a) || isResting(b)))
+            m_nextSleepContacts.emplace_back(idA, idB);
+    }
+    for (const auto &[a, b] : m_contacts)
+    {
+        if (!isResting(a) && !isResting(b))
+            continue;
+        const unsigned int idA = a->GetID(), idB = b->GetID();
+        m_nextSleepContacts.emplace_back(std::min(idA, idB), std::max(idA, idB));
+    }
+    std::sort(m_nextSleepContacts.begin(), m_nextSleepContacts.end());
+    m_nextSleepContacts.erase(std::unique(m_nextSleepContacts.begin(), m_nextSleepContacts.end()), m_nextSleepContacts.end());
+    m_sleepContacts.swap(m_nextSleepContacts);
+}
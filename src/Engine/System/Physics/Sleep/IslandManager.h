@@ -0,0 +1,56 @@
+#pragma once
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameObject;
+class GameWorld;
+
+// 休眠与岛
+// 由接触连通的动态物体组成一个岛, 岛内全部物体低能量持续 timeToSleep 后整体休眠,
+// 任一物体被唤醒或仍在运动时整岛保持清醒
+class IslandManager
+{
+public:
+    void Initialize(const json &config);
+    bool IsEnabled() const { return m_enabled; }
+
+    void BeginStep();
+    // 各阶段之前调用: 唤醒被传送的休眠物体, 以及接触对象已销毁、停用或关闭碰撞的休眠物体
+    void WakeDisturbed(GameWorld &world);
+    // 两个物体本步存在接触; 静态物体不参与连通
+    void AddContact(GameObject *a, GameObject *b);
+    // 位置积分之后调用
+    void Update(GameWorld &world, float fixedDeltaTime);
+
+    size_t GetSleepingCount() const { return m_sleepingCount; }
+    size_t GetIslandCount() const { return m_islandCount; }
+
+private:
+    int Find(int i);
+    void Union(int a, int b);
+    // 本步的物体下标, 不在本步列表中返回 -1
+    int IndexOf(GameObject *object) const;
+    GameObject *FindPresent(unsigned int id) const;
+    void RecordSleepContacts();
+
+    bool m_enabled = false;
+    float m_linearThreshold = 0.05f;
+    float m_angularThreshold = 0.05f;
+    float m_timeToSleep = 0.5f;
+
+    std::vector<std::pair<GameObject *, GameObject *>> m_contacts;
+    std::vector<GameObject *> m_bodies;
+    std::vector<int> m_parent;
+    std::vector<float> m_islandTimer;
+    // 至少一方休眠或处于低能量计时的接触 (idA < idB); 休眠物体之间不再检测, 靠这份记录发现支撑物消失
+    std::vector<std::pair<unsigned int, unsigned int>> m_sleepContacts;
+    std::vector<std::pair<unsigned int, unsigned int>> m_nextSleepContacts;
+    // (id, 物体), 按 id 排序, 本步开始时仍激活且可碰撞的刚体
+    std::vector<std::pair<unsigned int, GameObject *>> m_present;
+
+    size_t m_sleepingCount = 0;
+    size_t m_islandCount = 0;
+};
@@ -0,0 +1,385 @@
+#include "ContactSolver.h"
+#include "Engine/Core/GameObject/GameObject.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Core/Events/EventManager.h"
+#include "Engine/System/Physics/Stages/CollisionEvent.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    float InverseMass(const RigidbodyComponent &rb)
+    {
+        if (rb.mass <= std::numeric_limits<float>::min())
+            return 0.0f;
+        return 1.0f / rb.mass;
+    }
+    // 由法线确定的固定切向基, 保证摩擦冲量跨步可复用
+    void TangentBasis(const Vector3f &n, Vector3f &t1, Vector3f &t2)
+    {
+        if (std::fabs(n.x()) >= 0.57735f)
+            t1 = Vector3f(n.y(), -n.x(), 0.0f);
+        else
+            t1 = Vector3f(0.0f, n.z(), -n.y());
+        t1.Normalize();
+        t2 = n ^ t1;
+    }
+    constexpr uint32_t STATIC_ID = 0xFFFFFFFFu;
+}
+
+void ContactSolver::Initialize(const json &config)
+{
+    m_iterations = std::max(1, config.value("iterations", 10));
+    m_warmStarting = config.value("warmStarting", true);
+    m_baumgarte = config.value("baumgarte", 0.2f);
+    m_slop = config.value("slop", 0.005f);
+    m_restitutionThreshold = config.value("restitutionThreshold", 1.0f);
+    m_matchDistance = config.value("matchDistance", 0.05f);
+    m_breakDistance = config.value("breakDistance", 0.02f);
+}
+
+uint64_t ContactSolver::MakeKey(GameObject *a, GameObject *b)
+{
+    uint64_t idA = a->GetID();
+    uint64_t idB = b ? b->GetID() : STATIC_ID;
+    return (idA << 32) | idB;
+}
+
+void ContactSolver::BeginStep()
+{
+    m_pending.clear();
+}
+
+void ContactSolver::Clear()
+{
+    m_manifolds.clear();
+    m_nextManifolds.clear();
+    m_pending.clear();
+    m_bodies.clear();
+}
+
+// 用当前位姿重新计算旧接触点的穿透深度, 分离或滑开过远的点丢弃
+void ContactSolver::RefreshPoints(ContactManifold &m)
+{
+    auto &tfA = m.a->GetComponent<TransformComponent>();
+    Vector3f posA = tfA.GetWorldPosition();
+    Matrix3f rotA = tfA.GetWorldRotation().toMatrix();
+    Vector3f posB;
+    Matrix3f rotB = Matrix3f::identity();
+    if (m.b)
+    {
+        auto &tfB = m.b->GetComponent<TransformComponent>();
+        posB = tfB.GetWorldPosition();
+        rotB = tfB.GetWorldRotation().toMatrix();
+    }
+
+    int count = 0;
+    for (int i = 0; i < m.pointCount; i++)
+    {
+        ManifoldPoint &p = m.points[i];
+        Vector3f worldA = posA + rotA * p.localA;
+        Vector3f worldB = m.b ? posB + rotB * p.localB : p.localB;
+        Vector3f d = worldA - worldB;
+        float dn = d * p.normal;
+        float penetration = p.penetration + dn;
+        Vector3f drift = d - p.normal * dn;
+        if (penetration < -m_breakDistance || drift.LengthSquared() > m_breakDistance * m_breakDistance)
+            continue;
+        p.penetration = penetration;
+        m.points[count++] = p;
+    }
+    m.pointCount = count;
+}
+
+void ContactSolver::AddPoint(ContactManifold &m, const ManifoldPoint &p)
+{
+    if (m.pointCount < ContactManifold::MAX_POINTS)
+    {
+        m.points[m.pointCount] = p;
+        m.newestPoint = m.pointCount++;
+        return;
+    }
+
+    // 已满: 保留最深点与新点, 从其余点中去掉与其他点距离和最小 (最不贡献面积) 的一个
+    int deepest = 0;
+    for (int i = 1; i < m.pointCount; i++)
+        if (m.points[i].penetration > m.points[deepest].penetration)
+            deepest = i;
+
+    int remove = -1;
+    float minSpread = std::numeric_limits<float>::max();
+    for (int i = 0; i < m.pointCount; i++)
+    {
+        if (i == deepest)
+            continue;
+        float spread = (m.points[i].localA - p.localA).Length();
+        for (int j = 0; j < m.pointCount; j++)
+            if (j != i)
+                spread += (m.points[i].localA - m.points[j].localA).Length();
+        if (spread < minSpread)
+        {
+            minSpread = spread;
+            remove = i;
+        }
+    }
+    m.points[remove] = p;
+    m.newestPoint = remove;
+}
+
+void ContactSolver::AddContact(GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                               float friction, float restitution, bool emitEvents)
+{
+    Vector3f n = normal;
+    if (b && b->GetID() < a->GetID())
+    {
+        std::swap(a, b);
+        n = -n;
+    }
+    m_pending.push_back({MakeKey(a, b), a, b, n, penetration, hitPoint, friction, restitution, emitEvents});
+}
+
+void ContactSolver::MergeContacts()
+{
+    // 同一对的接触保持上报顺序
+    std::stable_sort(m_pending.begin(), m_pending.end(), [](const PendingContact &x, const PendingContact &y)
+                     { return x.key < y.key; });
+    m_nextManifolds.clear();
+    size_t previous = 0;
+    for (size_t i = 0; i < m_pending.size();)
+    {
+        const PendingContact &first = m_pending[i];
+        while (previous < m_manifolds.size() && m_manifolds[previous].key < first.key)
+            previous++;
+        m_nextManifolds.emplace_back();
+        ContactManifold &m = m_nextManifolds.back();
+        if (previous < m_manifolds.size() && m_manifolds[previous].key == first.key)
+            m = m_manifolds[previous];
+        m.a = first.a;
+        m.b = first.b;
+        m.key = first.key;
+        m.emitEvents = false;
+        m.newestPoint = -1;
+        if (m.pointCount > 0)
+            RefreshPoints(m);
+        for (; i < m_pending.size() && m_pending[i].key == first.key; i++)
+            AddToManifold(m, m_pending[i]);
+    }
+    m_manifolds.swap(m_nextManifolds);
+    m_pending.clear();
+}
+
+void ContactSolver::AddToManifold(ContactManifold &m, const PendingContact &c)
+{
+    m.friction = c.friction;
+    m.restitution = c.restitution;
+    m.emitEvents = m.emitEvents || c.emitEvents;
+
+    auto &tfA = c.a->GetComponent<TransformComponent>();
+    Matrix3f rotA = tfA.GetWorldRotation().toMatrix();
+    ManifoldPoint p;
+    p.localA = rotA.transposed() * (c.hitPoint - tfA.GetWorldPosition());
+    if (c.b)
+    {
+        auto &tfB = c.b->GetComponent<TransformComponent>();
+        p.localB = tfB.GetWorldRotation().toMatrix().transposed() * (c.hitPoint - tfB.GetWorldPosition());
+    }
+    else
+        p.localB = c.hitPoint;
+    p.normal = c.normal;
+    p.penetration = c.penetration;
+
+    // 与旧点重合则继承累积冲量
+    for (int i = 0; i < m.pointCount; i++)
+    {
+        ManifoldPoint &old = m.points[i];
+        if ((old.localA - p.localA).LengthSquared() < m_matchDistance * m_matchDistance)
+        {
+            p.normalImpulse = old.normalImpulse;
+            p.tangentImpulse[0] = old.tangentImpulse[0];
+            p.tangentImpulse[1] = old.tangentImpulse[1];
+            old = p;
+            m.newestPoint = i;
+            return;
+        }
+    }
+    AddPoint(m, p);
+}
+
+int ContactSolver::GetBody(GameObject *go)
+{
+    if (!go)
+        return -1;
+    auto &rb = go->GetComponent<RigidbodyComponent>();
+    // 下标可能是以前步骤留下的, 与本步列表核对
+    if (rb.solverIndex >= 0 && rb.solverIndex < (int)m_bodies.size() && m_bodies[rb.solverIndex].rb == &rb)
+        return rb.solverIndex;
+
+    auto &tf = go->GetComponent<TransformComponent>();
+    SolverBody body;
+    body.rb = &rb;
+    body.invMass = InverseMass(rb);
+    body.velocity = rb.velocity;
+    body.angularVelocity = rb.angularVelocity;
+    body.initialAngularVelocity = rb.angularVelocity;
+    if (body.invMass > 0.0f)
+    {
+        body.invInertia = rb.worldInverseInertia;
+        body.inertia = rb.GetWorldInertia(tf.GetWorldRotation());
+    }
+    int index = (int)m_bodies.size();
+    m_bodies.push_back(body);
+    rb.solverIndex = index;
+    return index;
+}
+
+void ContactSolver::PreStep(float fixedDeltaTime)
+{
+    const float invDt = fixedDeltaTime > 0.0f ? 1.0f / fixedDeltaTime : 0.0f;
+    SolverBody ground;
+
+    for (auto &manifold : m_manifolds)
+    {
+        ContactManifold *m = &manifold;
+        m->bodyA = GetBody(m->a);
+        m->bodyB = GetBody(m->b);
+        SolverBody &A = m_bodies[m->bodyA];
+        SolverBody &B = m->bodyB >= 0 ? m_bodies[m->bodyB] : ground;
+
+        auto &tfA = m->a->GetComponent<TransformComponent>();
+        Vector3f posA = tfA.GetWorldPosition();
+        Matrix3f rotA = tfA.GetWorldRotation().toMatrix();
+        Vector3f posB;
+        if (m->b)
+            posB = m->b->GetComponent<TransformComponent>().GetWorldPosition();
+
+        for (int i = 0; i < m->pointCount; i++)
+        {
+            ManifoldPoint &p = m->points[i];
+            const Vector3f &n = p.normal;
+            p.rA = rotA * p.localA;
+            p.position = posA + p.rA;
+            p.rB = m->b ? p.position - posB : Vector3f::ZERO;
+
+            Vector3f raxn = p.rA ^ n;
+            Vector3f rbxn = p.rB ^ n;
+            float k = A.invMass + B.invMass + raxn * (A.invInertia * raxn) + rbxn * (B.invInertia * rbxn);
+            p.normalMass = k > 0.0f ? 1.0f / k : 0.0f;
+
+            TangentBasis(n, p.tangent[0], p.tangent[1]);
+            for (int t = 0; t < 2; t++)
+            {
+                Vector3f raxt = p.rA ^ p.tangent[t];
+                Vector3f rbxt = p.rB ^ p.tangent[t];
+                float kt = A.invMass + B.invMass + raxt * (A.invInertia * raxt) + rbxt * (B.invInertia * rbxt);
+                p.tangentMass[t] = kt > 0.0f ? 1.0f / kt : 0.0f;
+            }
+
+            p.relativeVelocity = B.velocity + (B.angularVelocity ^ p.rB) - A.velocity - (A.angularVelocity ^ p.rA);
+            float vn = p.relativeVelocity * n;
+            // 目标分离速度: Baumgarte 位置修正与恢复系数取大者
+            p.bias = m_baumgarte * invDt * std::max(p.penetration - m_slop, 0.0f);
+            if (vn < -m_restitutionThreshold)
+                p.bias = std::max(p.bias, -m->restitution * vn);
+
+            if (m_warmStarting)
+                ApplyImpulse(*m, p, n * p.normalImpulse + p.tangent[0] * p.tangentImpulse[0] + p.tangent[1] * p.tangentImpulse[1]);
+            else
+            {
+                p.normalImpulse = 0.0f;
+                p.tangentImpulse[0] = p.tangentImpulse[1] = 0.0f;
+            }
+        }
+    }
+}
+
+void ContactSolver::ApplyImpulse(ContactManifold &m, const ManifoldPoint &p, const Vector3f &impulse)
+{
+    SolverBody &A = m_bodies[m.bodyA];
+    A.velocity -= impulse * A.invMass;
+    A.angularVelocity -= A.invInertia * (p.rA ^ impulse);
+    if (m.bodyB >= 0)
+    {
+        SolverBody &B = m_bodies[m.bodyB];
+        B.velocity += impulse * B.invMass;
+        B.angularVelocity += B.invInertia * (p.rB ^ impulse);
+    }
+}
+
+void ContactSolver::Solve(float fixedDeltaTime)
+{
+    m_bodies.clear();
+    // 归并后按键有序, 求解顺序固定
+    MergeContacts();
+    if (m_manifolds.empty())
+        return;
+
+    PreStep(fixedDeltaTime);
+
+    SolverBody ground;
+    for (int iter = 0; iter < m_iterations; iter++)
+    {
+        for (auto &manifold : m_manifolds)
+        {
+            ContactManifold *m = &manifold;
+            for (int i = 0; i < m->pointCount; i++)
+            {
+                ManifoldPoint &p = m->points[i];
+                SolverBody &A = m_bodies[m->bodyA];
+                const SolverBody &B = m->bodyB >= 0 ? m_bodies[m->bodyB] : ground;
+
+                // 摩擦: 库仑锥近似为以当前法向冲量为界的方盒
+                Vector3f rV = B.velocity + (B.angularVelocity ^ p.rB) - A.velocity - (A.angularVelocity ^ p.rA);
+                float maxFriction = m->friction * p.normalImpulse;
+                for (int t = 0; t < 2; t++)
+                {
+                    float lambda = -p.tangentMass[t] * (rV * p.tangent[t]);
+                    float old = p.tangentImpulse[t];
+                    p.tangentImpulse[t] = std::max(-maxFriction, std::min(maxFriction, old + lambda));
+                    ApplyImpulse(*m, p, p.tangent[t] * (p.tangentImpulse[t] - old));
+                }
+
+                // 法向: 累积冲量非负
+                rV = B.velocity + (B.angularVelocity ^ p.rB) - A.velocity - (A.angularVelocity ^ p.rA);
+                float lambda = p.normalMass * (p.bias - rV * p.normal);
+                float old = p.normalImpulse;
+                p.normalImpulse = std::max(old + lambda, 0.0f);
+                ApplyImpulse(*m, p, p.normal * (p.normalImpulse - old));
+            }
+        }
+    }
+
+    WriteBack();
+}
+
+void ContactSolver::WriteBack()
+{
+    for (auto &body : m_bodies)
+    {
+        if (body.invMass <= 0.0f)
+            continue;
+        RigidbodyComponent &rb = *body.rb;
+        if (rb.velocity != body.velocity || rb.angularVelocity != body.angularVelocity)
+            rb.WakeUp();
+        rb.velocity = body.velocity;
+        rb.angularVelocity = body.angularVelocity;
+        // 角动量同步, 保持与积分器 L -> ω 的一致性
+        rb.angularMomentum += body.inertia * (body.angularVelocity - body.initialAngularVelocity);
+    }
+}
+
+size_t ContactSolver::EmitEvents(EventManager &eventManager)
+{
+    size_t count = 0;
+    for (const auto &manifold : m_manifolds)
+    {
+        const ContactManifold *m = &manifold;
+        if (!m->emitEvents || !m->b || m->newestPoint < 0)
+            continue;
+        const ManifoldPoint &p = m->points[m->newestPoint];
+        if (p.normalImpulse <= 0.0f)
+            continue;
+        eventManager.Post(CollisionEvent(m->a, m->b, p.normal, p.penetration, p.position, p.relativeVelocity, p.normalImpulse));
+        count++;
+    }
+    return count;
+}
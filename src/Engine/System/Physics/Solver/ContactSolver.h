@@ -0,0 +1,126 @@
+#pragma once
+#include "Engine/Math/Math.h"
+#include <cstdint>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameObject;
+class EventManager;
+struct RigidbodyComponent;
+class TransformComponent;
+
+// 持久接触点: 锚点保存在各自物体的局部坐标系, 跨步保留累积冲量用于 warm starting
+struct ManifoldPoint
+{
+    Vector3f localA;
+    Vector3f localB; // b 为静态世界时存世界坐标
+    Vector3f normal; // A->B
+    float penetration = 0.0f;
+
+    float normalImpulse = 0.0f;
+    float tangentImpulse[2] = {0.0f, 0.0f};
+
+    // 每步预计算
+    Vector3f position; // 世界坐标接触点
+    Vector3f rA, rB;
+    Vector3f tangent[2];
+    float normalMass = 0.0f;
+    float tangentMass[2] = {0.0f, 0.0f};
+    float bias = 0.0f;
+    Vector3f relativeVelocity; // 求解前的相对速度
+};
+
+struct ContactManifold
+{
+    static constexpr int MAX_POINTS = 4;
+
+    GameObject *a = nullptr;
+    GameObject *b = nullptr; // nullptr 表示静态世界 (地面)
+    uint64_t key = 0;
+    float friction = 0.5f;
+    float restitution = 0.0f;
+    bool emitEvents = false;
+    int newestPoint = -1;  // 本步新加入/更新的点, 用于事件
+    int bodyA = -1, bodyB = -1;
+
+    ManifoldPoint points[MAX_POINTS];
+    int pointCount = 0;
+};
+
+// Sequential impulse 接触求解器
+// 各阶段只上报接触, 由 PhysicsSystem 在速度积分之后、位置积分之前统一求解
+class ContactSolver
+{
+public:
+    void Initialize(const json &config);
+
+    // 每步开始时调用, 清空上报的接触
+    void BeginStep();
+    // normal 由 a 指向 b; b 为 nullptr 时视为静态地面
+    void AddContact(GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                    float friction, float restitution, bool emitEvents);
+    void Solve(float fixedDeltaTime);
+    // 求解后触发 CollisionEvent, 按 id 顺序, 返回触发的事件数
+    size_t EmitEvents(EventManager &eventManager);
+    void Clear();
+
+    // 求解后有效: 本步参与求解的流形与刚体数
+    bool HasContacts() const { return !m_manifolds.empty(); }
+    size_t GetManifoldCount() const { return m_manifolds.size(); }
+    size_t GetBodyCount() const { return m_bodies.size(); }
+    int GetIterations() const { return m_iterations; }
+
+private:
+    struct SolverBody
+    {
+        RigidbodyComponent *rb = nullptr;
+        float invMass = 0.0f;
+        Matrix3f invInertia;
+        Matrix3f inertia;
+        Vector3f velocity;
+        Vector3f angularVelocity;
+        Vector3f initialAngularVelocity;
+    };
+
+    // 本步上报的一个接触, a 的 id 小于 b
+    struct PendingContact
+    {
+        uint64_t key;
+        GameObject *a;
+        GameObject *b;
+        Vector3f normal;
+        float penetration;
+        Vector3f hitPoint;
+        float friction;
+        float restitution;
+        bool emitEvents;
+    };
+
+    static uint64_t MakeKey(GameObject *a, GameObject *b);
+    // 本步接触与上一步的流形按键归并, 只保留本步有接触的流形
+    void MergeContacts();
+    void AddToManifold(ContactManifold &m, const PendingContact &c);
+    void RefreshPoints(ContactManifold &m);
+    void AddPoint(ContactManifold &m, const ManifoldPoint &p);
+    int GetBody(GameObject *go);
+    void PreStep(float fixedDeltaTime);
+    void ApplyImpulse(ContactManifold &m, const ManifoldPoint &p, const Vector3f &impulse);
+    void WriteBack();
+
+    // 按键有序, 与 CollisionStage 的刚体对记录相同的布局; 求解后即为本步参与求解的流形
+    std::vector<ContactManifold> m_manifolds;
+    std::vector<ContactManifold> m_nextManifolds;
+    std::vector<PendingContact> m_pending;
+    // 刚体在本步的下标存于 RigidbodyComponent::solverIndex, 与 m_bodies 核对
+    std::vector<SolverBody> m_bodies;
+
+    int m_iterations = 10;
+    bool m_warmStarting = true;
+    float m_baumgarte = 0.2f;
+    float m_slop = 0.005f;
+    float m_restitutionThreshold = 1.0f;
+    float m_matchDistance = 0.05f;
+    float m_breakDistance = 0.02f;
+};
@@ -21,4 +21,49 @@ struct CollisionEvent : public IEvent
         penetration(penetration),
         hitpoint(hitpoint),
         relativeVelocity(relativeVelocity), impulse(j) {}
+};
+
+// CollisionStage 跨步记录接触中的刚体对: 开始接触的一步发 ContactBeginEvent, 之后每步 ContactStayEvent,
+// 分开 (或一方离开模拟) 的一步发 ContactEndEvent. 两个都在休眠的物体保持接触状态, 不发 Stay.
+// 烘焙进静态几何的刚体同样记录, 与休眠物体接触时也保持状态
+// m_object1 为 id 较小的一方, normal 由 1 指向 2, relativeVelocity 为求解前 2 相对 1 的速度
+struct ContactEventData
+{
+  GameObject *m_object1;
+  GameObject *m_object2;
+  Vector3f normal;
+  float penetration;
+  Vector3f hitpoint;
+  Vector3f relativeVelocity;
+
+  ContactEventData(GameObject *object1, GameObject *object2, const Vector3f &normal, float penetration,
+                   const Vector3f &hitpoint, const Vector3f &relativeVelocity)
+      : m_object1(object1), m_object2(object2), normal(normal), penetration(penetration),
+        hitpoint(hitpoint), relativeVelocity(relativeVelocity) {}
+};
+
+struct ContactBeginEvent : public IEvent, public ContactEventData
+{
+  EVENT_TYPE(ContactBeginEvent)
+  using ContactEventData::ContactEventData;
+};
+
+struct ContactStayEvent : public IEvent, public ContactEventData
+{
+  EVENT_TYPE(ContactStayEvent)
+  using ContactEventData::ContactEventData;
+};
+
+struct ContactEndEvent : public IEvent
+{
+  EVENT_TYPE(ContactEndEvent)
+
+  // 已销毁/停用 (不再参与碰撞) 的一方为 nullptr, 仍可用 id 区分
+  GameObject *m_object1;
+  GameObject *m_object2;
+  unsigned int id1;
+  unsigned int id2;
+
+  ContactEndEvent(GameObject *object1, GameObject *object2, unsigned int id1, unsigned int id2)
+      : m_object1(object1), m_object2(object2), id1(id1), id2(id2) {}
 };
\ No newline at end of file
@@ -2,27 +2,47 @@
 #include "CollisionEvent.h"
 #include "Engine/Core/GameWorld.h"
 #include "Engine/Core/Components/Components.h"
+#include "Engine/System/Physics/Narrowphase/BoxBoxSAT.h"
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #if !defined(PLATFORM_WEB)
 #include <omp.h>
 #endif
 
-void CollisionStage::Initialize(const json &config) {};
+void CollisionStage::Initialize(const json &config)
+{
+    std::string broadphase = config.value("broadphase", "brute");
+    if (broadphase == "sap")
+        m_broadphase = BroadphaseType::SAP;
+    else if (broadphase == "brute")
+        m_broadphase = BroadphaseType::BRUTE;
+    else
+        std::cerr << "[CollisionStage]: Unknown broadphase: " << broadphase << ", fallback to brute" << std::endl;
+    m_sap.SetAxis(config.value("sapAxis", 0));
+    m_showStats = config.value("showStats", false);
+    m_useSolver = config.value("contactSolver", false);
+    m_friction = config.value("friction", 0.5f);
+};
+
+CollisionStage::CollisionCandidate CollisionStage::MakeCandidate(GameObject *go, RigidbodyComponent &rb, const CollisionLayers &layers)
+{
+    const bool isStatic = rb.mass <= std::numeric_limits<float>::min();
+    // 休眠物体不动, 直接用入睡时缓存的包围盒
+    return {go,
+            &rb,
+            &go->GetComponent<TransformComponent>(),
+            rb.isSleeping ? rb.sleepingAABB : go->GetWorldAABB(),
+            rb.isSleeping || isStatic,
+            rb.collisionLayer,
+            layers.GetEffectiveMask(rb.collisionLayer, rb.collisionMask)};
+}
 
-void CollisionStage::Execute(GameWorld &world, float fixedDeltaTime)
+void CollisionStage::GatherCandidates(GameWorld &world)
 {
     const auto &gameObjects = world.GetEntitiesWith<RigidbodyComponent, TransformComponent>();
-    size_t n = gameObjects.size();
-    if (n < 2)
-        return;
-    struct CollisionCandidate
-    {
-        GameObject *go;
-        RigidbodyComponent *rb;
-        TransformComponent *tf;
-        AABB aabb;
-    };
-    static std::vector<CollisionCandidate> candidates;
+    const auto &layers = world.GetPhysicsSystem().GetCollisionLayers();
+    auto &candidates = m_candidates;
     candidates.clear();
     candidates.reserve(gameObjects.size());
 
@@ -31,12 +51,9 @@ void CollisionStage::Execute(GameWorld &world, float fixedDeltaTime)
     {
         auto *go = gameObjects[i];
         auto &rb = go->GetComponent<RigidbodyComponent>();
-        if (rb.Collidable)
+        if (rb.Collidable && !rb.isStatic)
         {
-            candidates.push_back({go,
-                                  &rb,
-                                  &go->GetComponent<TransformComponent>(),
-                                  go->GetWorldAABB()});
+            candidates.push_back(MakeCandidate(go, rb, layers));
         }
     }
 #else
@@ -50,12 +67,9 @@ void CollisionStage::Execute(GameWorld &world, float fixedDeltaTime)
         {
             auto *go = gameObjects[i];
             auto &rb = go->GetComponent<RigidbodyComponent>();
-            if (rb.Collidable)
+            if (rb.Collidable && !rb.isStatic)
             {
-                local_candidates.push_back({go,
-                                            &rb,
-                                            &go->GetComponent<TransformComponent>(),
-                                            go->GetWorldAABB()});
+                local_candidates.push_back(MakeCandidate(go, rb, layers));
             }
         }
 
@@ -67,34 +81,542 @@ void CollisionStage::Execute(GameWorld &world, float fixedDeltaTime)
         }
     }
 #endif
+}
 
-    for (size_t i = 0; i < candidates.size(); i++)
+void CollisionStage::BroadphaseBrute()
+{
+    const auto &candidates = m_candidates;
+    for (uint32_t i = 0; i < candidates.size(); i++)
     {
-        for (size_t j = i + 1; j < candidates.size(); j++)
+        for (uint32_t j = i + 1; j < candidates.size(); j++)
         {
-            auto &c1 = candidates[i];
-            auto &c2 = candidates[j];
+            // 层过滤只比较两个整数, 先于包围盒测试
+            if (PassFilter(candidates[i], candidates[j]) && AABB::IsCollide(candidates[i].aabb, candidates[j].aabb))
+                m_pairs.emplace_back(i, j);
+        }
+    }
+    m_broadphaseStats = SweepAndPrune::Stats();
+    m_broadphaseStats.proxyCount = candidates.size();
+    m_broadphaseStats.pairCount = m_pairs.size();
+}
 
-            if (!AABB::IsCollide(c1.aabb, c2.aabb))
-                continue;
+void CollisionStage::BroadphaseSAP()
+{
+    m_candidateObjects.clear();
+    m_candidateAABBs.clear();
+    for (const auto &c : m_candidates)
+    {
+        m_candidateObjects.push_back(c.go);
+        m_candidateAABBs.push_back(c.aabb);
+    }
+    m_sap.Update(m_candidateObjects, m_candidateAABBs, m_pairs);
+    m_broadphaseStats = m_sap.GetStats();
+    // SAP 只看包围盒, 被层过滤的配对在进入窄检测前剔除
+    m_pairs.erase(std::remove_if(m_pairs.begin(), m_pairs.end(),
+                                 [this](const BroadphasePair &pair)
+                                 { return !PassFilter(m_candidates[pair.first], m_candidates[pair.second]); }),
+                  m_pairs.end());
+    m_broadphaseStats.pairCount = m_pairs.size();
+}
 
-            Vector3f normal;
-            Vector3f hitPoint;
-            float penetration = 0.0f;
+namespace
+{
+    // 逐字节比较, 只要有一点移动就重新检测
+    template <typename T>
+    bool SameBits(const T &x, const T &y) { return std::memcmp(&x, &y, sizeof(T)) == 0; }
+}
+
+int CollisionStage::FindPreviousPair(uint64_t key) const
+{
+    auto it = std::lower_bound(m_pairCache.begin(), m_pairCache.end(), key, [](const PairCacheEntry &entry, uint64_t k)
+                               { return entry.key < k; });
+    return it != m_pairCache.end() && it->key == key ? (int)(it - m_pairCache.begin()) : -1;
+}
 
-            HitBox box1(*c1.tf, *c1.rb);
-            HitBox box2(*c2.tf, *c2.rb);
+void CollisionStage::Narrowphase()
+{
+    // 统一 a 为 id 较小的一方, 保证同一对物体的检测结果不受候选顺序影响; 按键排序后接触与记录都有序
+    for (auto &pair : m_pairs)
+    {
+        if (m_candidates[pair.first].go->GetID() > m_candidates[pair.second].go->GetID())
+            std::swap(pair.first, pair.second);
+    }
+    std::sort(m_pairs.begin(), m_pairs.end(), [this](const BroadphasePair &x, const BroadphasePair &y)
+              { return PairKey(m_candidates[x.first].go->GetID(), m_candidates[x.second].go->GetID()) <
+                       PairKey(m_candidates[y.first].go->GetID(), m_candidates[y.second].go->GetID()); });
+
+    // 并行阶段只读上一步的记录; 按块处理, 需要重新检测的配对打包后批量窄检测
+    const int pairCount = (int)m_pairs.size();
+    m_pairResults.resize(pairCount);
+    const int blockCount = (pairCount + NARROWPHASE_BLOCK - 1) / NARROWPHASE_BLOCK;
+#if !defined(PLATFORM_WEB)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int block = 0; block < blockCount; ++block)
+    {
+        HitBox boxesA[NARROWPHASE_BLOCK], boxesB[NARROWPHASE_BLOCK];
+        BoxContact found[NARROWPHASE_BLOCK];
+        int pending[NARROWPHASE_BLOCK];
+        size_t count = 0;
+        const int end = std::min(pairCount, (block + 1) * NARROWPHASE_BLOCK);
+        for (int k = block * NARROWPHASE_BLOCK; k < end; ++k)
+        {
+            const auto &pair = m_pairs[k];
+            const auto &c1 = m_candidates[pair.first];
+            const auto &c2 = m_candidates[pair.second];
+            PairResult &result = m_pairResults[k];
+            result.previous = FindPreviousPair(PairKey(c1.go->GetID(), c2.go->GetID()));
+            // 双方都休眠或静态 (含静态与静态) 时无需检测
+            result.idle = c1.idle && c2.idle;
+            if (result.idle)
+                continue;
 
-            if (HitBox::GetCollisionInfo(box1, box2, normal, penetration, hitPoint))
+            if (result.previous >= 0)
             {
-                if (c1.rb->collisionCallback)
-                    c1.rb->collisionCallback(c2.go);
-                if (c2.rb->collisionCallback)
-                    c2.rb->collisionCallback(c1.go);
-                ResolveCollision(world, c1.go, c2.go, normal, penetration, hitPoint);
+                const PairCacheEntry &entry = m_pairCache[result.previous];
+                if (SameBits(entry.aabbA, c1.aabb) && SameBits(entry.aabbB, c2.aabb) &&
+                    SameBits(entry.posA, c1.tf->GetLocalPosition()) && SameBits(entry.posB, c2.tf->GetLocalPosition()) &&
+                    SameBits(entry.rotA, c1.tf->GetLocalRotation()) && SameBits(entry.rotB, c2.tf->GetLocalRotation()))
+                {
+                    result.touching = entry.touching;
+                    result.cached = true;
+                    result.normal = entry.normal;
+                    result.penetration = entry.penetration;
+                    result.hitPoint = entry.hitPoint;
+                    continue;
+                }
             }
+            boxesA[count] = HitBox(*c1.tf, *c1.rb);
+            boxesB[count] = HitBox(*c2.tf, *c2.rb);
+            pending[count++] = k;
+        }
+
+        BoxBoxSAT::CollideBatch(boxesA, boxesB, count, found);
+        for (size_t i = 0; i < count; i++)
+        {
+            PairResult &result = m_pairResults[pending[i]];
+            result.cached = false;
+            result.touching = found[i].hit;
+            result.normal = found[i].normal;
+            result.penetration = found[i].penetration;
+            result.hitPoint = found[i].hitPoint;
+        }
+    }
+
+    // 串行生成本步记录; 休眠的刚体对原样保留上一步的记录, 不发 Stay. 接触点处的相对速度在解算前取
+    m_contacts.clear();
+    m_nextPairCache.clear();
+    m_pairCacheHits = 0;
+    size_t kept = 0;
+    for (int k = 0; k < pairCount; ++k)
+    {
+        const auto pair = m_pairs[k];
+        const auto &c1 = m_candidates[pair.first];
+        const auto &c2 = m_candidates[pair.second];
+        const PairResult &result = m_pairResults[k];
+        if (result.idle)
+        {
+            if (result.previous >= 0)
+                m_nextPairCache.push_back(m_pairCache[result.previous]);
+            continue;
+        }
+        m_pairs[kept++] = pair;
+        if (result.cached)
+            m_pairCacheHits++;
+
+        const unsigned int idA = c1.go->GetID(), idB = c2.go->GetID();
+        if (result.touching)
+        {
+            NarrowphaseContact contact;
+            contact.a = pair.first;
+            contact.b = pair.second;
+            contact.idA = idA;
+            contact.idB = idB;
+            contact.normal = result.normal;
+            contact.penetration = result.penetration;
+            contact.hitPoint = result.hitPoint;
+            contact.began = result.previous < 0 || !m_pairCache[result.previous].touching;
+            Vector3f rA = result.hitPoint - c1.tf->GetWorldPosition();
+            Vector3f rB = result.hitPoint - c2.tf->GetWorldPosition();
+            contact.contactVelocity = c2.rb->velocity + (c2.rb->angularVelocity ^ rB) - c1.rb->velocity - (c1.rb->angularVelocity ^ rA);
+            m_contacts.push_back(contact);
+        }
+
+        PairCacheEntry entry;
+        entry.key = PairKey(idA, idB);
+        entry.aabbA = c1.aabb;
+        entry.aabbB = c2.aabb;
+        entry.posA = c1.tf->GetLocalPosition();
+        entry.posB = c2.tf->GetLocalPosition();
+        entry.rotA = c1.tf->GetLocalRotation();
+        entry.rotB = c2.tf->GetLocalRotation();
+        entry.normal = result.normal;
+        entry.penetration = result.penetration;
+        entry.hitPoint = result.hitPoint;
+        entry.touching = result.touching;
+        m_nextPairCache.push_back(entry);
+    }
+    m_pairs.resize(kept);
+
+    CollectEndedPairs();
+    m_pairCache.swap(m_nextPairCache);
+}
+
+void CollisionStage::CollectEndedPairs()
+{
+    // 两份记录都按键有序, 归并一遍即可, 结束事件也按键有序
+    m_endedPairs.clear();
+    size_t next = 0;
+    for (const auto &entry : m_pairCache)
+    {
+        while (next < m_nextPairCache.size() && m_nextPairCache[next].key < entry.key)
+            next++;
+        const bool stillTouching = next < m_nextPairCache.size() && m_nextPairCache[next].key == entry.key &&
+                                   m_nextPairCache[next].touching;
+        if (entry.touching && !stillTouching)
+            m_endedPairs.push_back(entry.key);
+    }
+}
+
+void CollisionStage::EmitContactEvents(GameWorld &world)
+{
+    auto &eventManager = world.GetEventManager();
+    const bool beginEvents = eventManager.HasSubscribers<ContactBeginEvent>();
+    const bool stayEvents = eventManager.HasSubscribers<ContactStayEvent>();
+    m_beginCount = m_stayCount = 0;
+    m_endCount = m_endedPairs.size();
+    for (const auto &contact : m_contacts)
+    {
+        auto &c1 = m_candidates[contact.a];
+        auto &c2 = m_candidates[contact.b];
+        if (!contact.began)
+        {
+            m_stayCount++;
+            if (stayEvents)
+                eventManager.Post(ContactStayEvent(c1.go, c2.go, contact.normal, contact.penetration, contact.hitPoint,
+                                                   contact.contactVelocity));
+            continue;
+        }
+        m_beginCount++;
+        // 异步物理步中事件与回调推迟到主线程分发
+        if (c1.rb->collisionCallback)
+            eventManager.Defer([callback = c1.rb->collisionCallback, other = c2.go]()
+                               { callback(other); });
+        if (c2.rb->collisionCallback)
+            eventManager.Defer([callback = c2.rb->collisionCallback, other = c1.go]()
+                               { callback(other); });
+        if (beginEvents)
+            eventManager.Post(ContactBeginEvent(c1.go, c2.go, contact.normal, contact.penetration, contact.hitPoint,
+                                                contact.contactVelocity));
+    }
+    for (const auto &contact : m_staticBodyContacts)
+    {
+        if (!contact.began)
+        {
+            m_stayCount++;
+            if (stayEvents)
+                eventManager.Post(ContactStayEvent(contact.object1, contact.object2, contact.normal, contact.penetration,
+                                                   contact.hitPoint, contact.relativeVelocity));
+            continue;
+        }
+        m_beginCount++;
+        for (GameObject *self : {contact.object1, contact.object2})
+        {
+            GameObject *other = self == contact.object1 ? contact.object2 : contact.object1;
+            if (auto &callback = self->GetComponent<RigidbodyComponent>().collisionCallback)
+                eventManager.Defer([callback, other]()
+                                   { callback(other); });
+        }
+        if (beginEvents)
+            eventManager.Post(ContactBeginEvent(contact.object1, contact.object2, contact.normal, contact.penetration,
+                                                contact.hitPoint, contact.relativeVelocity));
+    }
+
+    m_endCount += m_endedStaticPairs.size();
+    if ((m_endedPairs.empty() && m_endedStaticPairs.empty()) || !eventManager.HasSubscribers<ContactEndEvent>())
+        return;
+    // 已不在候选中的一方 (销毁、停用或关闭碰撞) 记为 nullptr
+    BuildCandidateIds();
+    auto findObject = [this](unsigned int id) -> GameObject *
+    {
+        int candidate = FindCandidate(id);
+        return candidate >= 0 ? m_candidates[candidate].go : nullptr;
+    };
+    for (uint64_t key : m_endedPairs)
+    {
+        unsigned int idA = (unsigned int)(key >> 32), idB = (unsigned int)(key & 0xFFFFFFFFu);
+        eventManager.Post(ContactEndEvent(findObject(idA), findObject(idB), idA, idB));
+    }
+    // 烘焙的刚体不在候选中, 从世界中找回
+    for (const auto &pair : m_endedStaticPairs)
+    {
+        unsigned int idA = (unsigned int)(pair.key >> 32), idB = (unsigned int)(pair.key & 0xFFFFFFFFu);
+        GameObject *objectA = idA == pair.id ? findObject(idA) : world.FindGameObject(idA);
+        GameObject *objectB = idB == pair.id ? findObject(idB) : world.FindGameObject(idB);
+        eventManager.Post(ContactEndEvent(objectA, objectB, idA, idB));
+    }
+}
+
+void CollisionStage::BuildCandidateIds()
+{
+    if (m_candidateIdsReady)
+        return;
+    m_candidateIds.clear();
+    for (uint32_t i = 0; i < m_candidates.size(); i++)
+        m_candidateIds.emplace_back(m_candidates[i].go->GetID(), i);
+    std::sort(m_candidateIds.begin(), m_candidateIds.end());
+    m_candidateIdsReady = true;
+}
+
+int CollisionStage::FindCandidate(unsigned int id) const
+{
+    auto it = std::lower_bound(m_candidateIds.begin(), m_candidateIds.end(), std::make_pair(id, 0u));
+    return it != m_candidateIds.end() && it->first == id ? (int)it->second : -1;
+}
+
+void CollisionStage::StaticPhase(const StaticGeometry &geometry)
+{
+    m_staticContacts.clear();
+    if (geometry.IsEmpty())
+        return;
+#if defined(PLATFORM_WEB)
+    const int threadCount = 1;
+#else
+    const int threadCount = omp_get_max_threads();
+#endif
+    if ((int)m_threadStaticContacts.size() < threadCount)
+    {
+        m_threadStaticContacts.resize(threadCount);
+        m_threadStaticFound.resize(threadCount);
+    }
+
+    const int candidateCount = (int)m_candidates.size();
+#if !defined(PLATFORM_WEB)
+#pragma omp parallel num_threads(threadCount)
+#endif
+    {
+#if defined(PLATFORM_WEB)
+        const int thread = 0;
+#else
+        const int thread = omp_get_thread_num();
+#endif
+        auto &localContacts = m_threadStaticContacts[thread];
+        auto &found = m_threadStaticFound[thread];
+        localContacts.clear();
+
+#if !defined(PLATFORM_WEB)
+#pragma omp for schedule(dynamic, 64) nowait
+#endif
+        for (int i = 0; i < candidateCount; ++i)
+        {
+            const auto &c = m_candidates[i];
+            if (c.idle)
+                continue;
+            found.clear();
+            geometry.Collide(HitBox(*c.tf, *c.rb), c.aabb, found, c.layer, c.mask);
+            for (const auto &contact : found)
+                localContacts.push_back({(uint32_t)i, c.go->GetID(), contact});
+        }
+    }
+
+    for (int t = 0; t < threadCount; ++t)
+        m_staticContacts.insert(m_staticContacts.end(), m_threadStaticContacts[t].begin(), m_threadStaticContacts[t].end());
+    // 同一物体的接触由同一线程按固定顺序生成, 稳定排序后与线程数无关
+    std::stable_sort(m_staticContacts.begin(), m_staticContacts.end(), [](const StaticPhaseContact &x, const StaticPhaseContact &y)
+                     { return x.id < y.id; });
+}
+
+void CollisionStage::ResolveStaticContacts(GameWorld &world)
+{
+    m_staticBodyContacts.clear();
+    const auto &geometry = world.GetPhysicsSystem().GetStaticGeometry();
+    auto &solver = world.GetPhysicsSystem().GetContactSolver();
+
+    // 同一物体与同一图元的多个角点合并为一个接触: 逐对冲量时避免重复施加冲量, 烘焙刚体的接触事件也按此上报
+    size_t begin = 0;
+    while (begin < m_staticContacts.size())
+    {
+        size_t end = begin + 1;
+        while (end < m_staticContacts.size() && m_staticContacts[end].candidate == m_staticContacts[begin].candidate &&
+               m_staticContacts[end].contact.primitive == m_staticContacts[begin].contact.primitive)
+            end++;
+
+        const uint32_t candidate = m_staticContacts[begin].candidate;
+        auto &c = m_candidates[candidate];
+        const StaticContact &first = m_staticContacts[begin].contact;
+        // 烘焙的刚体作为接触另一方, 场景文件中的图元为 nullptr
+        GameObject *body = geometry.GetBody(first.primitive);
+        Vector3f hitPoint = Vector3f::ZERO;
+        float penetration = 0.0f;
+        for (size_t k = begin; k < end; k++)
+        {
+            const StaticContact &contact = m_staticContacts[k].contact;
+            hitPoint += contact.hitPoint;
+            penetration = std::max(penetration, contact.penetration);
+            // 求解器按刚体对合并角点; body 无质量, 视为静态一方, CollisionEvent 由求解器给出
+            if (m_useSolver)
+                solver.AddContact(c.go, body, contact.normal, contact.penetration, contact.hitPoint,
+                                  contact.material.friction, c.rb->elasticity * contact.material.restitution, body != nullptr);
+        }
+        hitPoint /= (float)(end - begin);
+        begin = end;
+
+        Vector3f relativeVelocity = -c.rb->velocity - (c.rb->angularVelocity ^ (hitPoint - c.tf->GetWorldPosition()));
+        float impulse = 0.0f;
+        bool resolved = false;
+        if (!m_useSolver)
+            resolved = ResolveStaticCollision(c.go, first.normal, penetration, hitPoint, first.material, relativeVelocity, impulse);
+        if (!body)
+            continue;
+
+        StaticBodyContact contact;
+        contact.candidate = candidate;
+        contact.penetration = penetration;
+        contact.hitPoint = hitPoint;
+        contact.impulse = impulse;
+        contact.resolved = resolved;
+        if (c.go->GetID() < body->GetID())
+        {
+            contact.object1 = c.go;
+            contact.object2 = body;
+            contact.normal = first.normal;
+            contact.relativeVelocity = relativeVelocity;
+        }
+        else
+        {
+            contact.object1 = body;
+            contact.object2 = c.go;
+            contact.normal = -first.normal;
+            contact.relativeVelocity = -relativeVelocity;
         }
+        contact.key = PairKey(contact.object1->GetID(), contact.object2->GetID());
+        m_staticBodyContacts.push_back(contact);
+    }
+}
+
+void CollisionStage::TrackStaticBodyPairs()
+{
+    std::sort(m_staticBodyContacts.begin(), m_staticBodyContacts.end(), [](const StaticBodyContact &x, const StaticBodyContact &y)
+              { return x.key < y.key; });
+    m_nextStaticBodyPairs.clear();
+    m_endedStaticPairs.clear();
+    if (!m_staticBodyPairs.empty())
+        BuildCandidateIds();
+    // 本步未检测到的记录: 运动一方仍在候选中且休眠或静止则保持接触, 否则结束
+    auto carryOrEnd = [this](const StaticBodyPair &pair)
+    {
+        int candidate = FindCandidate(pair.id);
+        if (candidate >= 0 && m_candidates[candidate].idle)
+            m_nextStaticBodyPairs.push_back(pair);
+        else
+            m_endedStaticPairs.push_back(pair);
+    };
+
+    size_t previous = 0;
+    for (auto &contact : m_staticBodyContacts)
+    {
+        while (previous < m_staticBodyPairs.size() && m_staticBodyPairs[previous].key < contact.key)
+            carryOrEnd(m_staticBodyPairs[previous++]);
+        contact.began = previous >= m_staticBodyPairs.size() || m_staticBodyPairs[previous].key != contact.key;
+        if (!contact.began)
+            previous++;
+        m_nextStaticBodyPairs.push_back({contact.key, m_candidates[contact.candidate].go->GetID()});
     }
+    while (previous < m_staticBodyPairs.size())
+        carryOrEnd(m_staticBodyPairs[previous++]);
+    m_staticBodyPairs.swap(m_nextStaticBodyPairs);
+}
+
+void CollisionStage::Execute(GameWorld &world, float fixedDeltaTime)
+{
+    PhysicsTimer timer;
+    GatherCandidates(world);
+    m_candidateIdsReady = false;
+    m_timing.gather = timer.Lap();
+    m_pairs.clear();
+    if (m_broadphase == BroadphaseType::SAP)
+    {
+        // 候选不足两个时仍需同步, 以便移除已回收的代理
+        BroadphaseSAP();
+    }
+    else if (m_candidates.size() >= 2)
+    {
+        BroadphaseBrute();
+    }
+    else
+    {
+        m_broadphaseStats = SweepAndPrune::Stats();
+        m_broadphaseStats.proxyCount = m_candidates.size();
+    }
+
+    if (m_showStats && __SHOWINFO__)
+        std::cout << "[CollisionStage]: proxies " << m_broadphaseStats.proxyCount
+                  << ", pairs " << m_broadphaseStats.pairCount
+                  << ", swaps " << m_broadphaseStats.swapCount << std::endl;
+
+    m_timing.broadphase = timer.Lap();
+
+    Narrowphase();
+
+    // 按实体 id 排序后串行解算, 结果与线程数无关
+    std::sort(m_contacts.begin(), m_contacts.end(), [](const NarrowphaseContact &x, const NarrowphaseContact &y)
+              { return x.idA != y.idA ? x.idA < y.idA : x.idB < y.idB; });
+    auto &islands = world.GetPhysicsSystem().GetIslandManager();
+    for (const auto &contact : m_contacts)
+        islands.AddContact(m_candidates[contact.a].go, m_candidates[contact.b].go);
+    m_timing.narrowphase = timer.Lap();
+
+    StaticPhase(world.GetPhysicsSystem().GetStaticGeometry());
+    ResolveStaticContacts(world);
+    TrackStaticBodyPairs();
+    m_timing.staticPhase = timer.Lap();
+
+    if (m_useSolver)
+    {
+        // 冲量与 CollisionEvent 由 ContactSolver 在求解后给出
+        auto &solver = world.GetPhysicsSystem().GetContactSolver();
+        for (const auto &contact : m_contacts)
+        {
+            auto &c1 = m_candidates[contact.a];
+            auto &c2 = m_candidates[contact.b];
+            solver.AddContact(c1.go, c2.go, contact.normal, contact.penetration, contact.hitPoint,
+                              m_friction, c1.rb->elasticity * c2.rb->elasticity, true);
+        }
+    }
+    else
+    {
+        for (auto &contact : m_contacts)
+        {
+            auto &c1 = m_candidates[contact.a];
+            auto &c2 = m_candidates[contact.b];
+            contact.resolved = ResolveCollision(c1.go, c2.go, contact.normal, contact.penetration, contact.hitPoint,
+                                                contact.relativeVelocity, contact.impulse);
+        }
+    }
+
+    m_timing.resolve = timer.Lap();
+
+    // 回调与事件在全部解算之后统一触发, 回调只在开始接触时调用
+    EmitContactEvents(world);
+    m_eventCount = 0;
+    auto &eventManager = world.GetEventManager();
+    for (const auto &contact : m_contacts)
+    {
+        if (!contact.resolved)
+            continue;
+        eventManager.Post(CollisionEvent(m_candidates[contact.a].go, m_candidates[contact.b].go, contact.normal,
+                                         contact.penetration, contact.hitPoint, contact.relativeVelocity, contact.impulse));
+        m_eventCount++;
+    }
+    for (const auto &contact : m_staticBodyContacts)
+    {
+        if (!contact.resolved)
+            continue;
+        eventManager.Post(CollisionEvent(contact.object1, contact.object2, contact.normal, contact.penetration,
+                                         contact.hitPoint, contact.relativeVelocity, contact.impulse));
+        m_eventCount++;
+    }
+    m_timing.events = timer.Lap();
 
     // for (size_t i = 0; i < gameObjects.size(); i++)
     // {
@@ -155,7 +677,8 @@ float GetInverseMass(const RigidbodyComponent &rb)
         return 0.0f;
     return 1.0f / rb.mass;
 }
-void CollisionStage::ResolveCollision(GameWorld &world, GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint)
+bool CollisionStage::ResolveCollision(GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                                      Vector3f &outRelativeVelocity, float &outImpulse)
 {
     // normal:A->B为正
 
@@ -173,11 +696,11 @@ void CollisionStage::ResolveCollision(GameWorld &world, GameObject *a, GameObjec
     auto rB = hitPoint - tfB.GetWorldPosition();
 
     if (invMassA + invMassB <= std::numeric_limits<float>::min())
-        return;
+        return false;
     Vector3f rV = rbB.velocity + (rbB.angularVelocity ^ rB) - rbA.velocity - (rbA.angularVelocity ^ rA);
     float nrV = rV * normal;
     if (nrV > 0.0f)
-        return;
+        return false;
 
     // TODO 根据材料采取不同恢复系数表达式
     float e = rbA.elasticity * rbB.elasticity;
@@ -185,14 +708,8 @@ void CollisionStage::ResolveCollision(GameWorld &world, GameObject *a, GameObjec
     auto raxn = rA ^ normal;
     auto rbxn = rB ^ normal;
 
-    Matrix3f rotA = tfA.GetWorldRotation().toMatrix();
-    Matrix3f rotB = tfB.GetWorldRotation().toMatrix();
-
-    auto worldInverseInertiaTensorA = rotA * rbA.inverseInertiaTensor * rotA.transposed();
-    auto worldInverseInertiaTensorB = rotB * rbB.inverseInertiaTensor * rotB.transposed();
-
-    float termA = raxn * (worldInverseInertiaTensorA * raxn);
-    float termB = rbxn * (worldInverseInertiaTensorB * rbxn);
+    float termA = raxn * (rbA.worldInverseInertia * raxn);
+    float termB = rbxn * (rbB.worldInverseInertia * rbxn);
 
     float j = i / (invMassA + invMassB + termA + termB);
 
@@ -219,5 +736,76 @@ void CollisionStage::ResolveCollision(GameWorld &world, GameObject *a, GameObjec
     tfA.SetWorldMatrix(Matrix4f::CreateTransform(posA, _rotA, scaleA));
     tfB.SetWorldMatrix(Matrix4f::CreateTransform(posB, _rotB, scaleB));
 
-    world.GetEventManager().Emit(CollisionEvent(a, b, normal, penetration, hitPoint, rV, j));
-}
\ No newline at end of file
+    outRelativeVelocity = rV;
+    outImpulse = j;
+    return true;
+}
+bool CollisionStage::ResolveStaticCollision(GameObject *a, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                                            const StaticMaterial &material, Vector3f &outRelativeVelocity, float &outImpulse)
+{
+    // normal:A->静态几何为正
+    auto &rbA = a->GetComponent<RigidbodyComponent>();
+    auto &tfA = a->GetComponent<TransformComponent>();
+    float invMassA = GetInverseMass(rbA);
+    if (invMassA <= std::numeric_limits<float>::min())
+        return false;
+
+    Vector3f posA = tfA.GetWorldPosition();
+    Quat4f rotA = tfA.GetWorldRotation();
+    auto rA = hitPoint - posA;
+    Vector3f rV = -rbA.velocity - (rbA.angularVelocity ^ rA);
+    float nrV = rV * normal;
+    outRelativeVelocity = rV;
+    outImpulse = 0.0f;
+
+    const Matrix3f &worldInverseInertiaTensorA = rbA.worldInverseInertia;
+
+    if (nrV <= 0.0f)
+    {
+        float e = rbA.elasticity * material.restitution;
+        auto raxn = rA ^ normal;
+        float termA = raxn * (worldInverseInertiaTensorA * raxn);
+        float j = -(1.0f + e) * nrV / (invMassA + termA);
+        rbA.AddImpulse(-j * normal, rA);
+        outImpulse = j;
+
+        // 库仑摩擦, 切向冲量不超过 mu * j
+        Vector3f tangent = rV - normal * nrV;
+        if (tangent.LengthSquared() > 1e-8f)
+        {
+            tangent.Normalize();
+            auto raxt = rA ^ tangent;
+            float jt = -(rV * tangent) / (invMassA + raxt * (worldInverseInertiaTensorA * raxt));
+            float maxFriction = material.friction * j;
+            jt = std::max(-maxFriction, std::min(jt, maxFriction));
+            rbA.AddImpulse(-jt * tangent, rA);
+        }
+    }
+
+    // 位置修正全部由动态物体承担
+    const float percent = 0.6f;
+    const float slop = 0.0001f;
+    Vector3f correction = std::max(penetration - slop, 0.0f) * percent * normal;
+    tfA.SetWorldMatrix(Matrix4f::CreateTransform(posA - correction, rotA, tfA.GetWorldScale()));
+    return outImpulse > 0.0f;
+}
+
+void CollisionStage::GetStats(StageStats &outStats) const
+{
+    outStats.AddSection("gather", m_timing.gather);
+    outStats.AddSection("broadphase", m_timing.broadphase);
+    outStats.AddSection("narrowphase", m_timing.narrowphase);
+    outStats.AddSection("static", m_timing.staticPhase);
+    outStats.AddSection("resolve", m_timing.resolve);
+    outStats.AddSection("events", m_timing.events);
+    outStats.AddCounter("candidates", m_candidates.size());
+    outStats.AddCounter("pairs", m_pairs.size());
+    outStats.AddCounter("contacts", m_contacts.size());
+    outStats.AddCounter("staticContacts", m_staticContacts.size());
+    outStats.AddCounter("events", m_eventCount);
+    outStats.AddCounter("pairCache", m_pairCache.size());
+    outStats.AddCounter("pairCacheHits", m_pairCacheHits);
+    outStats.AddCounter("contactBegin", m_beginCount);
+    outStats.AddCounter("contactStay", m_stayCount);
+    outStats.AddCounter("contactEnd", m_endCount);
+}
@@ -2,23 +2,184 @@
 #include "Engine/System/Physics/IPhysicsStage.h"
 #include "Engine/Core/Components/Components.h"
 #include "Engine/Math/Math.h"
+#include "Engine/System/Physics/Broadphase/SweepAndPrune.h"
+#include "Engine/System/Physics/Layers/CollisionLayers.h"
+#include "Engine/System/Physics/Static/StaticGeometry.h"
+#include "Engine/System/Physics/Profiling/PhysicsStats.h"
 
+#include <cstdint>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
 class GameWorld;
 
+enum class BroadphaseType
+{
+    BRUTE,
+    SAP,
+};
+
 class CollisionStage : public IPhysicsStage
 {
 public:
     CollisionStage() = default;
 
     void Execute(GameWorld &world, float fixedDeltaTime) override;
-    void ResolveCollision(GameWorld &world, GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint);
+    // 返回 false 表示未施加冲量 (双方静态或正在分离)
+    bool ResolveCollision(GameObject *a, GameObject *b, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                          Vector3f &outRelativeVelocity, float &outImpulse);
+    // 与静态几何的接触, b 视为无穷质量
+    bool ResolveStaticCollision(GameObject *a, const Vector3f &normal, float penetration, const Vector3f &hitPoint,
+                                const StaticMaterial &material, Vector3f &outRelativeVelocity, float &outImpulse);
     void Initialize(const json &config) override;
 
+    // 最近一步的粗检测统计 (候选数、配对数、排序交换次数)
+    const SweepAndPrune::Stats &GetBroadphaseStats() const { return m_broadphaseStats; }
+    // 分段: gather / broadphase / narrowphase / static / resolve / events
+    void GetStats(StageStats &outStats) const override;
+    // 当前跨步记录的刚体对数 (含包围盒相交但未接触的)
+    size_t GetPairCacheSize() const { return m_pairCache.size(); }
+
 private:
+    struct CollisionCandidate
+    {
+        GameObject *go;
+        RigidbodyComponent *rb;
+        TransformComponent *tf;
+        AABB aabb;
+        bool idle; // 休眠或静态, 两个 idle 物体之间不做检测
+        int layer;
+        uint32_t mask; // 已合并层矩阵的有效掩码
+    };
+    // 窄检测结果, a/b 为 m_candidates 下标, idA < idB
+    struct NarrowphaseContact
+    {
+        uint32_t a, b;
+        unsigned int idA, idB;
+        Vector3f normal;
+        float penetration = 0.0f;
+        Vector3f hitPoint;
+        Vector3f relativeVelocity;
+        float impulse = 0.0f;
+        bool resolved = false;
+        bool began = false;       // 上一步未接触
+        Vector3f contactVelocity; // 解算前 b 相对 a 在接触点的速度
+    };
+    // 跨步记录的刚体对, 按键 (idA << 32) | idB 有序存放
+    // 双方位姿与包围盒都未变时直接复用上一步的窄检测结果
+    struct PairCacheEntry
+    {
+        uint64_t key = 0;
+        AABB aabbA, aabbB;
+        Vector3f posA, posB;
+        Quat4f rotA, rotB;
+        Vector3f normal;
+        float penetration = 0.0f;
+        Vector3f hitPoint;
+        bool touching = false;
+    };
+    // 并行窄检测的逐对结果
+    struct PairResult
+    {
+        int previous = -1; // 上一步记录中的下标
+        bool idle = false;
+        bool touching = false;
+        bool cached = false;
+        Vector3f normal;
+        float penetration = 0.0f;
+        Vector3f hitPoint;
+    };
+    struct StaticPhaseContact
+    {
+        uint32_t candidate;
+        unsigned int id;
+        StaticContact contact;
+    };
+    // 与烘焙进静态几何的刚体的接触, 每个物体与每个刚体合并为一个
+    // object1 为 id 较小的一方, normal 由 1 指向 2, relativeVelocity 为解算前 2 相对 1 的速度
+    struct StaticBodyContact
+    {
+        uint32_t candidate;
+        GameObject *object1, *object2;
+        uint64_t key;
+        Vector3f normal;
+        float penetration = 0.0f;
+        Vector3f hitPoint;
+        Vector3f relativeVelocity;
+        float impulse = 0.0f;
+        bool resolved = false;
+        bool began = false;
+    };
+    // 跨步记录的静态刚体接触, 按键有序; id 为运动一方
+    struct StaticBodyPair
+    {
+        uint64_t key;
+        unsigned int id;
+    };
+    void GatherCandidates(GameWorld &world);
+    void BroadphaseBrute();
+    void BroadphaseSAP();
+    static CollisionCandidate MakeCandidate(GameObject *go, RigidbodyComponent &rb, const CollisionLayers &layers);
+    bool PassFilter(const CollisionCandidate &c1, const CollisionCandidate &c2) const
+    {
+        return CollisionLayers::ShouldCollide(c1.layer, c1.mask, c2.layer, c2.mask);
+    }
+    static constexpr int NARROWPHASE_BLOCK = 32;
+    static uint64_t PairKey(unsigned int idA, unsigned int idB) { return ((uint64_t)idA << 32) | idB; }
+    // 并行窄检测写入逐对结果, 再串行生成本步的刚体对记录与接触
+    void Narrowphase();
+    // 上一步接触中、本步分开或未再出现的刚体对记为结束
+    void CollectEndedPairs();
+    int FindPreviousPair(uint64_t key) const;
+    void EmitContactEvents(GameWorld &world);
+    // 运动物体查询静态几何 BVH, 静止与休眠物体不查询
+    void StaticPhase(const StaticGeometry &geometry);
+    void ResolveStaticContacts(GameWorld &world);
+    // 与上一步的静态刚体接触归并, 得到开始与结束的接触; 休眠物体的接触保留
+    void TrackStaticBodyPairs();
+    void BuildCandidateIds();
+    int FindCandidate(unsigned int id) const;
+
     float epsilon = 0.0001f;
+
+    BroadphaseType m_broadphase = BroadphaseType::BRUTE;
+    SweepAndPrune m_sap;
+    SweepAndPrune::Stats m_broadphaseStats;
+    bool m_showStats = false;
+    // 最近一步各分段耗时 (ms)
+    struct Timing
+    {
+        double gather = 0.0, broadphase = 0.0, narrowphase = 0.0, staticPhase = 0.0, resolve = 0.0, events = 0.0;
+    };
+    Timing m_timing;
+    size_t m_eventCount = 0;
+    size_t m_pairCacheHits = 0;
+    size_t m_beginCount = 0, m_stayCount = 0, m_endCount = 0;
+    // true 时接触交给 ContactSolver, 不再逐对施加冲量
+    bool m_useSolver = false;
+    float m_friction = 0.5f;
+
+    std::vector<CollisionCandidate> m_candidates;
+    std::vector<GameObject *> m_candidateObjects;
+    std::vector<AABB> m_candidateAABBs;
+    std::vector<BroadphasePair> m_pairs;
+    std::vector<PairResult> m_pairResults;
+    std::vector<NarrowphaseContact> m_contacts;
+    // 上一步与本步的刚体对记录, 每步交换, 稳定后不再分配
+    std::vector<PairCacheEntry> m_pairCache;
+    std::vector<PairCacheEntry> m_nextPairCache;
+    std::vector<uint64_t> m_endedPairs;
+    // (id, 候选下标), 按 id 排序, 用于找回结束接触的物体
+    std::vector<std::pair<unsigned int, uint32_t>> m_candidateIds;
+    bool m_candidateIdsReady = false;
+    std::vector<std::vector<StaticPhaseContact>> m_threadStaticContacts;
+    // 每线程查询静态几何的临时结果, 跨步复用
+    std::vector<std::vector<StaticContact>> m_threadStaticFound;
+    std::vector<StaticPhaseContact> m_staticContacts;
+    std::vector<StaticBodyContact> m_staticBodyContacts;
+    std::vector<StaticBodyPair> m_staticBodyPairs;
+    std::vector<StaticBodyPair> m_nextStaticBodyPairs;
+    std::vector<StaticBodyPair> m_endedStaticPairs;
 };
 struct CollisionEntry
 {
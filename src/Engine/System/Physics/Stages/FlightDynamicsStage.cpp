@@ -0,0 +1,207 @@
+#ifdef _MSC_VER
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4305)
+#endif
+
+#include "FlightDynamicsStage.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include <algorithm>
+#include <cmath>
+
+void AircraftBatch::Clear()
+{
+    rbs.clear();
+    aircraft.clear();
+    for (auto *v : {&vx, &vy, &vz, &rx, &ry, &rz, &ux, &uy, &uz, &fwx, &fwy, &fwz, &liftK, &dragK, &thrust,
+                    &pitch, &yaw, &roll, &invControlSpeed, &fx, &fy, &fz, &tx, &ty, &tz, &airspeed})
+        v->clear();
+}
+
+void AircraftBatch::Finalize()
+{
+    const size_t padded = (Size() + WIDTH - 1) / WIDTH * WIDTH;
+    for (auto *v : {&vx, &vy, &vz, &rx, &ry, &rz, &ux, &uy, &uz, &fwx, &fwy, &fwz, &liftK, &dragK, &thrust,
+                    &pitch, &yaw, &roll, &invControlSpeed})
+        v->resize(padded, 0.0f);
+    for (auto *v : {&fx, &fy, &fz, &tx, &ty, &tz, &airspeed})
+        v->resize(padded);
+}
+
+void FlightDynamicsStage::Gather(GameWorld &world)
+{
+    AircraftBatch &b = m_batch;
+    b.Clear();
+    for (auto &gameObject : world.GetActivateGameObjects())
+    {
+        if (!gameObject->HasComponent<AircraftComponent>() || !gameObject->HasComponent<RigidbodyComponent>() ||
+            !gameObject->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = gameObject->GetComponent<RigidbodyComponent>();
+        if (rb.isStatic || rb.mass <= 0.0f)
+            continue;
+        auto &ac = gameObject->GetComponent<AircraftComponent>();
+        // 未指定面积时按碰撞盒估算, 只算一次
+        if (ac.wingArea <= 0.0f || ac.frontalArea <= 0.0f)
+        {
+            Vector3f size = rb.localAABB.max - rb.localAABB.min;
+            if (ac.wingArea <= 0.0f)
+                ac.wingArea = size.x() * size.z();
+            if (ac.frontalArea <= 0.0f)
+                ac.frontalArea = size.x() * size.y();
+        }
+        const Matrix4f &m = gameObject->GetComponent<TransformComponent>().GetWorldMatrix();
+        Vector3f right = m.getCol(0).xyz().Normalized();
+        Vector3f up = m.getCol(1).xyz().Normalized();
+        Vector3f forward = m.getCol(2).xyz().Normalized();
+
+        b.rbs.push_back(&rb);
+        b.aircraft.push_back(&ac);
+        b.vx.push_back(rb.velocity.x());
+        b.vy.push_back(rb.velocity.y());
+        b.vz.push_back(rb.velocity.z());
+        b.rx.push_back(right.x());
+        b.ry.push_back(right.y());
+        b.rz.push_back(right.z());
+        b.ux.push_back(up.x());
+        b.uy.push_back(up.y());
+        b.uz.push_back(up.z());
+        b.fwx.push_back(forward.x());
+        b.fwy.push_back(forward.y());
+        b.fwz.push_back(forward.z());
+        b.liftK.push_back(ac.wingArea * ac.liftCoefficient);
+        b.dragK.push_back(ac.frontalArea * ac.dragCoefficient);
+        b.thrust.push_back(ac.maxThrust * ac.throttle);
+        b.pitch.push_back(ac.pitch * ac.pitchPower);
+        b.yaw.push_back(ac.yaw * ac.yawPower);
+        b.roll.push_back(ac.roll * ac.rollPower);
+        b.invControlSpeed.push_back(ac.controlSpeed > 0.0f ? 1.0f / ac.controlSpeed : 0.0f);
+    }
+    b.Finalize();
+}
+
+void FlightDynamicsStage::Scatter()
+{
+    AircraftBatch &b = m_batch;
+    for (size_t i = 0; i < b.Size(); i++)
+    {
+        // AddForce 在有受力时唤醒休眠的刚体
+        b.rbs[i]->AddForce(Vector3f(b.fx[i], b.fy[i], b.fz[i]));
+        b.rbs[i]->AddTorque(Vector3f(b.tx[i], b.ty[i], b.tz[i]));
+        b.aircraft[i]->airspeed = b.airspeed[i];
+    }
+}
+
+void FlightDynamicsStage::Execute(GameWorld &world, float fixedDeltaTime)
+{
+    PhysicsTimer timer;
+    Gather(world);
+    m_gatherMs = timer.Lap();
+    ComputeForces(m_batch);
+    m_forceMs = timer.Lap();
+    Scatter();
+    m_scatterMs = timer.Lap();
+}
+
+void FlightDynamicsStage::GetStats(StageStats &outStats) const
+{
+    outStats.AddSection("gather", m_gatherMs);
+    outStats.AddSection("forces", m_forceMs);
+    outStats.AddSection("scatter", m_scatterMs);
+    outStats.AddCounter("aircraft", m_batch.Size());
+}
+
+// 升力 L = v^2 * S * Cl * sin(2α), 沿机体上方
+// 阻力 D = v^2 * S * Cd + L0 * sin(α) * 0.5, 沿速度反方向 (L0 为未乘攻角因子的升力)
+// cos(α) = 前向·速度方向, sin(2α) = 2 sin(α) cos(α), 不需要反三角函数
+// 操纵力矩在机体系给出, 按 min(v / controlSpeed, 1) 衰减后转到世界系
+#ifdef NW_MATH_SSE
+namespace
+{
+    inline __m128 Load(const std::vector<float> &v, size_t i) { return _mm_loadu_ps(v.data() + i); }
+    inline void Store(std::vector<float> &v, size_t i, __m128 x) { _mm_storeu_ps(v.data() + i, x); }
+    inline __m128 Madd(__m128 a, __m128 b, __m128 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    inline __m128 Select(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+}
+
+void FlightDynamicsStage::ComputeForces(AircraftBatch &b)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 negOne = _mm_set1_ps(-1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 minSpeed = _mm_set1_ps(MIN_AIRSPEED);
+    for (size_t i = 0; i < b.PaddedSize(); i += AircraftBatch::WIDTH)
+    {
+        __m128 vx = Load(b.vx, i), vy = Load(b.vy, i), vz = Load(b.vz, i);
+        __m128 fwx = Load(b.fwx, i), fwy = Load(b.fwy, i), fwz = Load(b.fwz, i);
+        __m128 ux = Load(b.ux, i), uy = Load(b.uy, i), uz = Load(b.uz, i);
+
+        __m128 v2 = Madd(vx, vx, Madd(vy, vy, _mm_mul_ps(vz, vz)));
+        __m128 speed = _mm_sqrt_ps(v2);
+        __m128 moving = _mm_cmpgt_ps(speed, minSpeed);
+        __m128 invSpeed = _mm_div_ps(one, _mm_max_ps(speed, minSpeed));
+        __m128 dx = Select(moving, _mm_mul_ps(vx, invSpeed), fwx);
+        __m128 dy = Select(moving, _mm_mul_ps(vy, invSpeed), fwy);
+        __m128 dz = Select(moving, _mm_mul_ps(vz, invSpeed), fwz);
+
+        __m128 cosA = Madd(fwx, dx, Madd(fwy, dy, _mm_mul_ps(fwz, dz)));
+        cosA = _mm_min_ps(one, _mm_max_ps(negOne, cosA));
+        __m128 sinA = _mm_sqrt_ps(_mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(cosA, cosA))));
+
+        __m128 liftMag = _mm_mul_ps(v2, Load(b.liftK, i));
+        __m128 lift = _mm_mul_ps(liftMag, _mm_mul_ps(two, _mm_mul_ps(sinA, cosA)));
+        __m128 drag = Madd(v2, Load(b.dragK, i), _mm_mul_ps(_mm_mul_ps(liftMag, sinA), half));
+        __m128 thrust = Load(b.thrust, i);
+
+        Store(b.fx, i, _mm_sub_ps(Madd(ux, lift, _mm_mul_ps(fwx, thrust)), _mm_mul_ps(dx, drag)));
+        Store(b.fy, i, _mm_sub_ps(Madd(uy, lift, _mm_mul_ps(fwy, thrust)), _mm_mul_ps(dy, drag)));
+        Store(b.fz, i, _mm_sub_ps(Madd(uz, lift, _mm_mul_ps(fwz, thrust)), _mm_mul_ps(dz, drag)));
+
+        __m128 control = _mm_min_ps(one, _mm_mul_ps(speed, Load(b.invControlSpeed, i)));
+        __m128 p = _mm_mul_ps(Load(b.pitch, i), control);
+        __m128 y = _mm_mul_ps(Load(b.yaw, i), control);
+        __m128 r = _mm_mul_ps(Load(b.roll, i), control);
+        Store(b.tx, i, Madd(Load(b.rx, i), p, Madd(ux, y, _mm_mul_ps(fwx, r))));
+        Store(b.ty, i, Madd(Load(b.ry, i), p, Madd(uy, y, _mm_mul_ps(fwy, r))));
+        Store(b.tz, i, Madd(Load(b.rz, i), p, Madd(uz, y, _mm_mul_ps(fwz, r))));
+        Store(b.airspeed, i, speed);
+    }
+}
+#else
+void FlightDynamicsStage::ComputeForces(AircraftBatch &b)
+{
+    for (size_t i = 0; i < b.Size(); i++)
+    {
+        float v2 = b.vx[i] * b.vx[i] + b.vy[i] * b.vy[i] + b.vz[i] * b.vz[i];
+        float speed = std::sqrt(v2);
+        float dx = b.fwx[i], dy = b.fwy[i], dz = b.fwz[i];
+        if (speed > MIN_AIRSPEED)
+        {
+            dx = b.vx[i] / speed;
+            dy = b.vy[i] / speed;
+            dz = b.vz[i] / speed;
+        }
+        float cosA = std::clamp(b.fwx[i] * dx + b.fwy[i] * dy + b.fwz[i] * dz, -1.0f, 1.0f);
+        float sinA = std::sqrt(std::max(0.0f, 1.0f - cosA * cosA));
+
+        float liftMag = v2 * b.liftK[i];
+        float lift = liftMag * 2.0f * sinA * cosA;
+        float drag = v2 * b.dragK[i] + liftMag * sinA * 0.5f;
+        float thrust = b.thrust[i];
+        b.fx[i] = b.ux[i] * lift + b.fwx[i] * thrust - dx * drag;
+        b.fy[i] = b.uy[i] * lift + b.fwy[i] * thrust - dy * drag;
+        b.fz[i] = b.uz[i] * lift + b.fwz[i] * thrust - dz * drag;
+
+        float control = std::min(1.0f, speed * b.invControlSpeed[i]);
+        float p = b.pitch[i] * control, y = b.yaw[i] * control, r = b.roll[i] * control;
+        b.tx[i] = b.rx[i] * p + b.ux[i] * y + b.fwx[i] * r;
+        b.ty[i] = b.ry[i] * p + b.uy[i] * y + b.fwy[i] * r;
+        b.tz[i] = b.rz[i] * p + b.uz[i] * y + b.fwz[i] * r;
+        b.airspeed[i] = speed;
+    }
+}
+#endif
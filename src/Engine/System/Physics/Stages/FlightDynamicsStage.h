@@ -0,0 +1,66 @@
+#pragma once
+#include "Engine/System/Physics/IPhysicsStage.h"
+#include "Engine/System/Physics/Profiling/PhysicsStats.h"
+
+#include <vector>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameWorld;
+struct RigidbodyComponent;
+struct AircraftComponent;
+
+// 打包的飞行器状态 (SoA), 长度补齐到 SIMD 宽度, 补齐部分参数为零, 不产生受力
+struct AircraftBatch
+{
+    static constexpr int WIDTH = 4;
+
+    std::vector<RigidbodyComponent *> rbs;
+    std::vector<AircraftComponent *> aircraft;
+
+    std::vector<float> vx, vy, vz;
+    // 世界姿态的三个轴: 右/上/前
+    std::vector<float> rx, ry, rz;
+    std::vector<float> ux, uy, uz;
+    std::vector<float> fwx, fwy, fwz;
+    // 系数已乘面积: liftK = S * Cl, dragK = S * Cd
+    std::vector<float> liftK, dragK, thrust;
+    // 操纵力矩 = 输入 * 灵敏度, 按空速衰减前
+    std::vector<float> pitch, yaw, roll, invControlSpeed;
+
+    // 输出
+    std::vector<float> fx, fy, fz;
+    std::vector<float> tx, ty, tz;
+    std::vector<float> airspeed;
+
+    size_t Size() const { return rbs.size(); }
+    size_t PaddedSize() const { return vx.size(); }
+    void Clear();
+    void Finalize();
+};
+
+// 对所有带 AircraftComponent 的刚体一次性计算升力/阻力/推力/操纵力矩
+// "FlightDynamicsStage": {"enable": true}
+class FlightDynamicsStage : public IPhysicsStage
+{
+public:
+    FlightDynamicsStage() = default;
+
+    void Execute(GameWorld &world, float fixedDeltaTime) override;
+    // 分段: gather / forces / scatter
+    void GetStats(StageStats &outStats) const override;
+
+    // 只计算, 不读写组件, 基准测试直接调用
+    static void ComputeForces(AircraftBatch &batch);
+
+private:
+    void Gather(GameWorld &world);
+    void Scatter();
+
+    // 空速低于该值时以机头方向代替速度方向
+    static constexpr float MIN_AIRSPEED = 0.01f;
+
+    AircraftBatch m_batch;
+
+    double m_gatherMs = 0.0, m_forceMs = 0.0, m_scatterMs = 0.0;
+};
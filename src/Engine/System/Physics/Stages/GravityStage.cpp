@@ -22,6 +22,9 @@ void GravityStage::Initialize(const json &config)
     ground = config.value("ground", 0.0);
     e_ground = config.value("e_ground", 0.5);
     mu = config.value("mu", 0.1);
+    m_useSolver = config.value("contactSolver", false);
+    m_groundLayerName = config.value("groundLayer", "");
+    m_groundEnabled = config.value("enableGround", true);
 }
 void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
 {
@@ -33,15 +36,27 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
             std::cout << "[Gravity Stage]:Empty Game World" << std::endl;
         return;
     }
+    // 地面视为掩码全开的静态物体
+    const auto &layers = world.GetPhysicsSystem().GetCollisionLayers();
+    const int groundLayer = m_groundLayerName.empty() ? -1 : layers.FindLayer(m_groundLayerName);
+    m_bodyCount = 0;
+    m_groundedCount = 0;
     for (auto &gameObject : gameObjects)
     {
         if (gameObject->HasComponent<RigidbodyComponent>())
         {
             auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-            if (rb.mass <= 0.001f)
+            if (rb.mass <= 0.001f || rb.isSleeping)
                 continue;
             auto &tf = gameObject->GetComponent<TransformComponent>();
             rb.AddForce(m_gravity * rb.mass);
+            m_bodyCount++;
+            if (!m_groundEnabled)
+                continue;
+            if (groundLayer >= 0 &&
+                !CollisionLayers::ShouldCollide(rb.collisionLayer, layers.GetEffectiveMask(rb.collisionLayer, rb.collisionMask),
+                                                groundLayer, layers.GetMatrixRow(groundLayer)))
+                continue;
             Vector3f corners[8];
 
             float lowy = 0.0f;
@@ -55,9 +70,19 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
                 AABB aabb = gameObject->GetWorldAABB();
                 lowy = aabb.min.y();
             }
+            if (m_useSolver)
+            {
+                if (lowy < ground + slop)
+                {
+                    AddSolverContacts(world, gameObject, rb, corners);
+                    m_groundedCount++;
+                }
+                continue;
+            }
             Vector3f normal = Vector3f(0.0f, 1.0f, 0.0f);
             if (lowy < ground)
             {
+                m_groundedCount++;
                 float penetration = ground - lowy;
                 if (penetration > slop)
                 {
@@ -95,9 +120,7 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
                         float e = (fabs(nrV) < 0.2f) ? 0.0f : rb.elasticity * e_ground;
                         float i = -(1.0f + e) * nrV;
                         auto raxn = cp.r ^ normal;
-                        auto rot = tf.GetWorldRotation().toMatrix();
-                        auto worldInverseInertia = rot * rb.inverseInertiaTensor * rot.transposed();
-                        float term = raxn * (worldInverseInertia * raxn);
+                        float term = raxn * (rb.worldInverseInertia * raxn);
                         float j = i / (term + invMass);
                         auto impulse = j * normal / div;
                         rb.AddImpulse(impulse, cp.r);
@@ -109,7 +132,7 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
                             tangent.Normalize();
                             float vt = rV * tangent;
                             Vector3f raxt = cp.r ^ tangent;
-                            float angularTermT = raxt * (worldInverseInertia * raxt);
+                            float angularTermT = raxt * (rb.worldInverseInertia * raxt);
                             float jt = -vt / (invMass + angularTermT);
                             jt = std::max(-j * mu, std::min(j * mu, jt));
 
@@ -133,3 +156,31 @@ void GravityStage::Execute(GameWorld &world, float fixedDeltaTime)
         }
     }
 }
+
+void GravityStage::AddSolverContacts(GameWorld &world, GameObject *gameObject, const RigidbodyComponent &rb, const Vector3f *corners)
+{
+    auto &solver = world.GetPhysicsSystem().GetContactSolver();
+    // 法线由物体指向地面
+    const Vector3f normal = Vector3f(0.0f, -1.0f, 0.0f);
+    const float e = rb.elasticity * e_ground;
+    if (rb.colliderType == ColliderType::BOX)
+    {
+        for (size_t i = 0; i < 8; i++)
+        {
+            if (corners[i].y() < ground + slop)
+                solver.AddContact(gameObject, nullptr, normal, ground - corners[i].y(), corners[i], mu, e, false);
+        }
+    }
+    else if (rb.colliderType == ColliderType::SPHERE)
+    {
+        Vector3f pos = gameObject->GetComponent<TransformComponent>().GetWorldPosition();
+        Vector3f hitPoint = pos - Vector3f(0.0f, rb.boudingRadius, 0.0f);
+        solver.AddContact(gameObject, nullptr, normal, ground - hitPoint.y(), hitPoint, mu, e, false);
+    }
+}
+
+void GravityStage::GetStats(StageStats &outStats) const
+{
+    outStats.AddCounter("bodies", m_bodyCount);
+    outStats.AddCounter("grounded", m_groundedCount);
+}
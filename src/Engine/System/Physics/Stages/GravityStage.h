@@ -1,8 +1,10 @@
 #pragma once
 #include "Engine/System/Physics/IPhysicsStage.h"
+#include "Engine/System/Physics/Profiling/PhysicsStats.h"
 #include "Engine/Core/Components/Components.h"
 #include "Engine/Math/Math.h"
 
+#include <string>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
@@ -15,8 +17,17 @@ public:
     void Execute(GameWorld &world, float fixedDeltaTime) override;
 
     void Initialize(const json &config) override;
+    void GetStats(StageStats &outStats) const override;
+
+    const Vector3f &GetGravity() const { return m_gravity; }
+    // 地面为 y = ground 的水平面
+    bool IsGroundEnabled() const { return m_groundEnabled; }
+    float GetGround() const { return ground; }
+    const std::string &GetGroundLayerName() const { return m_groundLayerName; }
 
 private:
+    void AddSolverContacts(GameWorld &world, GameObject *gameObject, const RigidbodyComponent &rb, const Vector3f *corners);
+
     float ground = 0.0f;
     float e_ground = 1.0f;
     float mu = 0.1f;
@@ -25,4 +36,14 @@ private:
     Vector3f m_gravity = Vector3f(0.0f, -9.8f, 0.0f);
     float baumgarte = 0.9f;
     float slop = 0.01f;
+    // 地面接触交给 PhysicsSystem 的 ContactSolver
+    bool m_useSolver = false;
+    // false 时只施加重力, 地面改由 StaticGeometry 中的平面/高度场处理
+    bool m_groundEnabled = true;
+    // 地面所在碰撞层, 为空时所有物体都与地面碰撞
+    std::string m_groundLayerName;
+
+    // 最近一步受重力的物体数与触地物体数
+    size_t m_bodyCount = 0;
+    size_t m_groundedCount = 0;
 };
\ No newline at end of file
@@ -0,0 +1,725 @@
+#include "StaticGeometry.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/System/Physics/CCD/SweepTests.h"
+#include "Engine/System/Physics/Narrowphase/BoxBoxSAT.h"
+#include "Engine/Utils/JsonParser.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace
+{
+    StaticMaterial ParseMaterial(const json &config)
+    {
+        StaticMaterial material;
+        material.friction = config.value("friction", material.friction);
+        material.restitution = config.value("restitution", material.restitution);
+        return material;
+    }
+
+    AABB Merge(const AABB &a, const AABB &b)
+    {
+        return AABB(Vector3f(std::min(a.min.x(), b.min.x()), std::min(a.min.y(), b.min.y()), std::min(a.min.z(), b.min.z())),
+                    Vector3f(std::max(a.max.x(), b.max.x()), std::max(a.max.y(), b.max.y()), std::max(a.max.z(), b.max.z())));
+    }
+
+    // Real-Time Collision Detection 5.1.5
+    Vector3f ClosestPointOnTriangle(const Vector3f &p, const Vector3f &a, const Vector3f &b, const Vector3f &c)
+    {
+        Vector3f ab = b - a, ac = c - a, ap = p - a;
+        float d1 = ab * ap, d2 = ac * ap;
+        if (d1 <= 0.0f && d2 <= 0.0f)
+            return a;
+        Vector3f bp = p - b;
+        float d3 = ab * bp, d4 = ac * bp;
+        if (d3 >= 0.0f && d4 <= d3)
+            return b;
+        float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+            return a + ab * (d1 / (d1 - d3));
+        Vector3f cp = p - c;
+        float d5 = ab * cp, d6 = ac * cp;
+        if (d6 >= 0.0f && d5 <= d6)
+            return c;
+        float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+            return a + ac * (d2 / (d2 - d6));
+        float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+            return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        float denom = 1.0f / (va + vb + vc);
+        return a + ab * (vb * denom) + ac * (vc * denom);
+    }
+
+    void BoxCorners(const HitBox &box, Vector3f *corners)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            corners[i] = box.center +
+                         box.axes[0] * ((i & 1) ? box.halfExtents[0] : -box.halfExtents[0]) +
+                         box.axes[1] * ((i & 2) ? box.halfExtents[1] : -box.halfExtents[1]) +
+                         box.axes[2] * ((i & 4) ? box.halfExtents[2] : -box.halfExtents[2]);
+        }
+    }
+
+    // p 沿法线投影后是否落在三角形内
+    bool ProjectsInsideTriangle(const Vector3f &p, const Vector3f &a, const Vector3f &b, const Vector3f &c, const Vector3f &n)
+    {
+        return ((b - a) ^ (p - a)) * n >= 0.0f &&
+               ((c - b) ^ (p - b)) * n >= 0.0f &&
+               ((a - c) ^ (p - c)) * n >= 0.0f;
+    }
+}
+
+void StaticGeometry::Clear()
+{
+    m_planes.clear();
+    m_shapes.clear();
+    m_triangles.clear();
+    m_heightfields.clear();
+    m_primitives.clear();
+    m_nodes.clear();
+    m_built = false;
+    m_world = nullptr;
+}
+
+void StaticGeometry::Load(const json &config)
+{
+    if (config.contains("planes"))
+    {
+        for (const auto &plane : config["planes"])
+            AddPlane(JsonParser::ToVector3f(plane.value("normal", json::array({0.0f, 1.0f, 0.0f}))),
+                     plane.value("offset", 0.0f), ParseMaterial(plane));
+    }
+    if (config.contains("boxes"))
+    {
+        for (const auto &box : config["boxes"])
+        {
+            Vector3f center = JsonParser::ToVector3f(box.value("center", json::array({0.0f, 0.0f, 0.0f})));
+            Quat4f rotation = Quat4f::XYZRotate(DEG2RAD * JsonParser::ToVector3f(box.value("rotation", json::array({0.0f, 0.0f, 0.0f}))));
+            HitBox shape;
+            if (box.contains("radius"))
+                shape.setHitboxSphere(center, rotation, box["radius"].get<float>());
+            else
+            {
+                Vector3f size = JsonParser::ToVector3f(box.value("size", json::array({1.0f, 1.0f, 1.0f})));
+                shape.setHitboxBox(center, rotation, AABB(-size / 2.0f, size / 2.0f));
+            }
+            AddShape(shape, ParseMaterial(box));
+        }
+    }
+    if (config.contains("heightfields"))
+    {
+        for (const auto &field : config["heightfields"])
+        {
+            Vector2f cellSize = JsonParser::ToVector2f(field.value("cellSize", json::array({1.0f, 1.0f})));
+            float heightScale = field.value("heightScale", 1.0f);
+            std::vector<float> heights = field.value("heights", std::vector<float>());
+            for (auto &h : heights)
+                h *= heightScale;
+            AddHeightfield(JsonParser::ToVector3f(field.value("origin", json::array({0.0f, 0.0f, 0.0f}))),
+                           cellSize.x(), cellSize.y(), field.value("cols", 0), field.value("rows", 0), heights, ParseMaterial(field));
+        }
+    }
+    if (config.contains("meshes"))
+    {
+        for (const auto &mesh : config["meshes"])
+        {
+            Vector3f position = JsonParser::ToVector3f(mesh.value("position", json::array({0.0f, 0.0f, 0.0f})));
+            Quat4f rotation = Quat4f::XYZRotate(DEG2RAD * JsonParser::ToVector3f(mesh.value("rotation", json::array({0.0f, 0.0f, 0.0f}))));
+            Vector3f scale = JsonParser::ToVector3f(mesh.value("scale", json::array({1.0f, 1.0f, 1.0f})));
+            StaticMaterial material = ParseMaterial(mesh);
+
+            std::vector<Vector3f> vertices;
+            for (const auto &v : mesh.value("vertices", json::array()))
+                vertices.push_back(position + rotation * (JsonParser::ToVector3f(v) & scale));
+            std::vector<int> indices = mesh.value("indices", std::vector<int>());
+            if (indices.size() % 3 != 0)
+                std::cerr << "[StaticGeometry]: Mesh index count is not a multiple of 3" << std::endl;
+            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            {
+                int a = indices[i], b = indices[i + 1], c = indices[i + 2];
+                if (a < 0 || b < 0 || c < 0 || a >= (int)vertices.size() || b >= (int)vertices.size() || c >= (int)vertices.size())
+                {
+                    std::cerr << "[StaticGeometry]: Mesh index out of range" << std::endl;
+                    continue;
+                }
+                AddTriangle(vertices[a], vertices[b], vertices[c], material);
+            }
+        }
+    }
+}
+
+void StaticGeometry::AddStaticBodies(GameWorld &world)
+{
+    size_t baked = 0;
+    m_world = &world;
+    const auto &layers = world.GetPhysicsSystem().GetCollisionLayers();
+    for (auto *object : world.GetEntitiesWith<RigidbodyComponent, TransformComponent>())
+    {
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        auto &tf = object->GetComponent<TransformComponent>();
+        if (!rb.Collidable)
+            continue;
+        // 零质量刚体不被积分器移动, 没有脚本与父节点时同样视为静态
+        const bool massless = rb.mass <= std::numeric_limits<float>::min() &&
+                              !object->HasComponent<ScriptComponent>() && tf.GetParent() == nullptr;
+        if (!rb.isStatic && !massless)
+            continue;
+        HitBox shape;
+        if (rb.colliderType == ColliderType::SPHERE)
+            shape.setHitboxSphere(tf.GetWorldPosition(), tf.GetWorldRotation(), rb.boudingRadius);
+        else if (rb.colliderType == ColliderType::BOX)
+            shape.setHitboxBox(tf.GetWorldPosition(), tf.GetWorldRotation(), rb.localAABB);
+        else
+            continue;
+        StaticMaterial material;
+        material.restitution = rb.elasticity;
+        AddShape(shape, material);
+        StaticShape &bakedShape = m_shapes.back();
+        bakedShape.body = object;
+        bakedShape.bodyId = object->GetID();
+        bakedShape.layer = rb.collisionLayer;
+        bakedShape.mask = layers.GetEffectiveMask(rb.collisionLayer, rb.collisionMask);
+        baked++;
+
+        // 静态刚体固定不动
+        rb.isStatic = true;
+        rb.mass = 0.0f;
+        rb.velocity = Vector3f::ZERO;
+        rb.angularVelocity = Vector3f::ZERO;
+        rb.angularMomentum = Vector3f::ZERO;
+    }
+    if (__SHOWINFO__ && baked > 0)
+        std::cout << "[StaticGeometry]: Baked " << baked << " static bodies" << std::endl;
+}
+
+void StaticGeometry::AddPlane(const Vector3f &normal, float offset, const StaticMaterial &material)
+{
+    if (normal.LengthSquared() < 1e-8f)
+    {
+        std::cerr << "[StaticGeometry]: Plane normal is zero" << std::endl;
+        return;
+    }
+    float length = normal.Length();
+    m_planes.push_back({normal / length, offset / length, material});
+}
+
+void StaticGeometry::AddShape(const HitBox &shape, const StaticMaterial &material)
+{
+    m_primitives.push_back({PrimitiveType::SHAPE, (int)m_shapes.size(), GetShapeAABB(shape)});
+    m_shapes.push_back({shape, material});
+    m_built = false;
+}
+
+void StaticGeometry::AddTriangle(const Vector3f &v0, const Vector3f &v1, const Vector3f &v2, const StaticMaterial &material)
+{
+    Vector3f normal = (v1 - v0) ^ (v2 - v0);
+    if (normal.LengthSquared() < 1e-12f)
+        return; // 退化三角形
+    normal.Normalize();
+    AABB aabb(v0, v0);
+    aabb = Merge(aabb, AABB(v1, v1));
+    aabb = Merge(aabb, AABB(v2, v2));
+    m_primitives.push_back({PrimitiveType::TRIANGLE, (int)m_triangles.size(), aabb});
+    m_triangles.push_back({v0, v1, v2, normal, material});
+    m_built = false;
+}
+
+void StaticGeometry::AddHeightfield(const Vector3f &origin, float cellSizeX, float cellSizeZ, int cols, int rows,
+                                    const std::vector<float> &heights, const StaticMaterial &material)
+{
+    if (cols < 2 || rows < 2 || (int)heights.size() != cols * rows || cellSizeX <= 0.0f || cellSizeZ <= 0.0f)
+    {
+        std::cerr << "[StaticGeometry]: Invalid heightfield (" << cols << "x" << rows << ", " << heights.size() << " samples)" << std::endl;
+        return;
+    }
+    auto [minIt, maxIt] = std::minmax_element(heights.begin(), heights.end());
+    AABB aabb(Vector3f(origin.x(), origin.y() + *minIt, origin.z()),
+              Vector3f(origin.x() + cellSizeX * (cols - 1), origin.y() + *maxIt, origin.z() + cellSizeZ * (rows - 1)));
+    m_primitives.push_back({PrimitiveType::HEIGHTFIELD, (int)m_heightfields.size(), aabb});
+    m_heightfields.push_back({origin, cellSizeX, cellSizeZ, cols, rows, heights, material});
+    m_built = false;
+}
+
+AABB StaticGeometry::GetShapeAABB(const HitBox &shape)
+{
+    Vector3f extent;
+    if (shape.colliderType == ColliderType::SPHERE)
+        extent = Vector3f(shape.boudingRadius, shape.boudingRadius, shape.boudingRadius);
+    else
+    {
+        for (int i = 0; i < 3; i++)
+            extent[i] = std::fabs(shape.axes[0][i]) * shape.halfExtents[0] +
+                        std::fabs(shape.axes[1][i]) * shape.halfExtents[1] +
+                        std::fabs(shape.axes[2][i]) * shape.halfExtents[2];
+    }
+    return AABB(shape.center - extent, shape.center + extent);
+}
+
+void StaticGeometry::Build()
+{
+    m_nodes.clear();
+    if (!m_primitives.empty())
+    {
+        m_nodes.reserve(m_primitives.size() * 2);
+        BuildNode(0, (int)m_primitives.size(), 0);
+    }
+    m_built = true;
+    if (__SHOWINFO__)
+        std::cout << "[StaticGeometry]: " << m_planes.size() << " planes, " << m_primitives.size()
+                  << " primitives, " << m_nodes.size() << " nodes" << std::endl;
+}
+
+int StaticGeometry::BuildNode(int begin, int end, int depth)
+{
+    const int nodeIndex = (int)m_nodes.size();
+    m_nodes.emplace_back();
+
+    AABB bounds = m_primitives[begin].aabb;
+    Vector3f cmin = (bounds.min + bounds.max) * 0.5f, cmax = cmin;
+    for (int i = begin + 1; i < end; i++)
+    {
+        bounds = Merge(bounds, m_primitives[i].aabb);
+        Vector3f c = (m_primitives[i].aabb.min + m_primitives[i].aabb.max) * 0.5f;
+        cmin = Vector3f(std::min(cmin.x(), c.x()), std::min(cmin.y(), c.y()), std::min(cmin.z(), c.z()));
+        cmax = Vector3f(std::max(cmax.x(), c.x()), std::max(cmax.y(), c.y()), std::max(cmax.z(), c.z()));
+    }
+    m_nodes[nodeIndex].aabb = bounds;
+
+    if (end - begin <= LEAF_SIZE || depth >= MAX_DEPTH)
+    {
+        m_nodes[nodeIndex].begin = begin;
+        m_nodes[nodeIndex].count = end - begin;
+        return nodeIndex;
+    }
+
+    // 按质心范围最大的轴取中位数划分
+    Vector3f spread = cmax - cmin;
+    int axis = 0;
+    if (spread.y() > spread[axis])
+        axis = 1;
+    if (spread.z() > spread[axis])
+        axis = 2;
+    const int mid = (begin + end) / 2;
+    std::nth_element(m_primitives.begin() + begin, m_primitives.begin() + mid, m_primitives.begin() + end,
+                     [axis](const Primitive &x, const Primitive &y)
+                     { return x.aabb.min[axis] + x.aabb.max[axis] < y.aabb.min[axis] + y.aabb.max[axis]; });
+
+    int left = BuildNode(begin, mid, depth + 1);
+    int right = BuildNode(mid, end, depth + 1);
+    m_nodes[nodeIndex].left = left;
+    m_nodes[nodeIndex].right = right;
+    return nodeIndex;
+}
+
+void StaticGeometry::Query(const AABB &aabb, std::vector<int> &outPrimitives) const
+{
+    if (m_nodes.empty() || !AABB::IsCollide(m_nodes[0].aabb, aabb))
+        return;
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                if (AABB::IsCollide(m_primitives[i].aabb, aabb))
+                    outPrimitives.push_back(i);
+            }
+            continue;
+        }
+        if (AABB::IsCollide(m_nodes[node.right].aabb, aabb))
+            stack[top++] = node.right;
+        if (AABB::IsCollide(m_nodes[node.left].aabb, aabb))
+            stack[top++] = node.left;
+    }
+}
+
+void StaticGeometry::Collide(const HitBox &body, const AABB &bodyAABB, std::vector<StaticContact> &out, int layer, uint32_t mask) const
+{
+    Vector3f corners[8];
+    if (body.colliderType == ColliderType::BOX)
+        BoxCorners(body, corners);
+
+    for (size_t p = 0; p < m_planes.size(); p++)
+    {
+        const Plane &plane = m_planes[p];
+        StaticContact contact;
+        contact.normal = -plane.normal;
+        contact.material = plane.material;
+        contact.primitive = -(int)p - 1;
+        if (body.colliderType == ColliderType::SPHERE)
+        {
+            float dist = plane.normal * body.center - plane.offset;
+            if (dist >= body.boudingRadius)
+                continue;
+            contact.penetration = body.boudingRadius - dist;
+            contact.hitPoint = body.center - plane.normal * dist;
+            out.push_back(contact);
+        }
+        else if (body.colliderType == ColliderType::BOX)
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                float depth = plane.offset - plane.normal * corners[i];
+                if (depth <= 0.0f)
+                    continue;
+                contact.penetration = depth;
+                contact.hitPoint = corners[i];
+                out.push_back(contact);
+            }
+        }
+    }
+
+    if (m_nodes.empty() || !AABB::IsCollide(m_nodes[0].aabb, bodyAABB))
+        return;
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                if (AABB::IsCollide(m_primitives[i].aabb, bodyAABB) && PassLayer(i, layer, mask))
+                    CollidePrimitive(body, corners, i, &out);
+            }
+            continue;
+        }
+        if (AABB::IsCollide(m_nodes[node.right].aabb, bodyAABB))
+            stack[top++] = node.right;
+        if (AABB::IsCollide(m_nodes[node.left].aabb, bodyAABB))
+            stack[top++] = node.left;
+    }
+}
+
+bool StaticGeometry::CollidePrimitive(const HitBox &body, const Vector3f *corners, int primitive, std::vector<StaticContact> *out) const
+{
+    bool found = false;
+    auto emit = [&](const StaticContact &c)
+    {
+        found = true;
+        if (out)
+            out->push_back(c);
+    };
+    const Primitive &prim = m_primitives[primitive];
+    const bool isSphere = body.colliderType == ColliderType::SPHERE;
+    StaticContact contact;
+    contact.primitive = primitive;
+
+    switch (prim.type)
+    {
+    case PrimitiveType::SHAPE:
+    {
+        const StaticShape &shape = m_shapes[prim.index];
+        contact.material = shape.material;
+        if (BoxBoxSAT::GetCollisionInfo(body, shape.shape, contact.normal, contact.penetration, contact.hitPoint))
+            emit(contact);
+        break;
+    }
+    case PrimitiveType::TRIANGLE:
+    {
+        // 单面: 只处理中心位于三角形正面的物体
+        const Triangle &tri = m_triangles[prim.index];
+        contact.material = tri.material;
+        if ((body.center - tri.v0) * tri.normal < 0.0f)
+            break;
+        if (isSphere)
+        {
+            Vector3f closest = ClosestPointOnTriangle(body.center, tri.v0, tri.v1, tri.v2);
+            Vector3f d = closest - body.center;
+            float dist2 = d.LengthSquared();
+            if (dist2 >= body.boudingRadius * body.boudingRadius)
+                break;
+            float dist = std::sqrt(dist2);
+            contact.normal = dist > 1e-6f ? d / dist : -tri.normal;
+            contact.penetration = body.boudingRadius - dist;
+            contact.hitPoint = closest;
+            emit(contact);
+        }
+        else
+        {
+            contact.normal = -tri.normal;
+            for (int i = 0; i < 8; i++)
+            {
+                float depth = -((corners[i] - tri.v0) * tri.normal);
+                if (depth <= 0.0f || !ProjectsInsideTriangle(corners[i], tri.v0, tri.v1, tri.v2, tri.normal))
+                    continue;
+                contact.penetration = depth;
+                contact.hitPoint = corners[i];
+                emit(contact);
+            }
+        }
+        break;
+    }
+    case PrimitiveType::HEIGHTFIELD:
+    {
+        const Heightfield &field = m_heightfields[prim.index];
+        contact.material = field.material;
+        float h;
+        Vector3f n;
+        if (isSphere)
+        {
+            if (!field.Sample(body.center.x(), body.center.z(), h, n))
+                break;
+            float dist = (body.center.y() - h) * n.y();
+            if (dist >= body.boudingRadius)
+                break;
+            contact.normal = -n;
+            contact.penetration = body.boudingRadius - dist;
+            contact.hitPoint = body.center - n * dist;
+            emit(contact);
+        }
+        else
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                if (!field.Sample(corners[i].x(), corners[i].z(), h, n))
+                    continue;
+                float depth = (h - corners[i].y()) * n.y();
+                if (depth <= 0.0f)
+                    continue;
+                contact.normal = -n;
+                contact.penetration = depth;
+                contact.hitPoint = corners[i];
+                emit(contact);
+            }
+        }
+        break;
+    }
+    }
+    return found;
+}
+
+bool StaticGeometry::Overlaps(const HitBox &shape, const AABB &aabb, bool includeBodies) const
+{
+    Vector3f corners[8];
+    if (shape.colliderType == ColliderType::BOX)
+        BoxCorners(shape, corners);
+    for (const auto &plane : m_planes)
+    {
+        if (shape.colliderType == ColliderType::SPHERE && plane.normal * shape.center - plane.offset < shape.boudingRadius)
+            return true;
+        if (shape.colliderType == ColliderType::BOX)
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                if (plane.normal * corners[i] < plane.offset)
+                    return true;
+            }
+        }
+    }
+    if (m_nodes.empty() || !AABB::IsCollide(m_nodes[0].aabb, aabb))
+        return false;
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                if ((includeBodies || !IsBodyPrimitive(i)) && AABB::IsCollide(m_primitives[i].aabb, aabb) &&
+                    CollidePrimitive(shape, corners, i, nullptr))
+                    return true;
+            }
+            continue;
+        }
+        if (AABB::IsCollide(m_nodes[node.right].aabb, aabb))
+            stack[top++] = node.right;
+        if (AABB::IsCollide(m_nodes[node.left].aabb, aabb))
+            stack[top++] = node.left;
+    }
+    return false;
+}
+
+bool StaticGeometry::IsBodyPrimitive(int primitive) const
+{
+    const Primitive &prim = m_primitives[primitive];
+    return prim.type == PrimitiveType::SHAPE && m_shapes[prim.index].body != nullptr;
+}
+bool StaticGeometry::PassLayer(int primitive, int layer, uint32_t mask) const
+{
+    if (!IsBodyPrimitive(primitive))
+        return true;
+    const StaticShape &shape = m_shapes[m_primitives[primitive].index];
+    return CollisionLayers::ShouldCollide(layer, mask, shape.layer, shape.mask);
+}
+GameObject *StaticGeometry::GetBody(int primitive) const
+{
+    if (primitive < 0 || primitive >= (int)m_primitives.size() || !IsBodyPrimitive(primitive) || !m_world)
+        return nullptr;
+    return m_world->FindGameObject(m_shapes[m_primitives[primitive].index].bodyId);
+}
+
+bool StaticGeometry::SweepSphere(const Vector3f &origin, const Vector3f &dir, float maxDist, float radius, StaticSweepHit &outHit,
+                                 bool includeBodies, int layer, uint32_t mask) const
+{
+    bool hit = false;
+    float best = maxDist;
+
+    for (size_t p = 0; p < m_planes.size(); p++)
+    {
+        const Plane &plane = m_planes[p];
+        float s = plane.normal * origin - plane.offset;
+        float denom = plane.normal * dir;
+        if (s < radius || denom >= 0.0f)
+            continue;
+        float t = (s - radius) / -denom;
+        if (t <= best)
+        {
+            best = t;
+            hit = true;
+            outHit.distance = t;
+            outHit.normal = plane.normal;
+            outHit.material = plane.material;
+            outHit.primitive = -(int)p - 1;
+        }
+    }
+
+    if (m_nodes.empty())
+        return hit;
+    const Vector3f invDir = SweepTests::InverseDirection(dir);
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (!SweepTests::RayAABB(node.aabb, origin, invDir, best, radius))
+            continue;
+        if (node.left >= 0)
+        {
+            stack[top++] = node.right;
+            stack[top++] = node.left;
+            continue;
+        }
+        for (int i = node.begin; i < node.begin + node.count; i++)
+        {
+            if ((!includeBodies && IsBodyPrimitive(i)) || !PassLayer(i, layer, mask) ||
+                !SweepTests::RayAABB(m_primitives[i].aabb, origin, invDir, best, radius))
+                continue;
+            float t;
+            Vector3f normal;
+            if (SweepPrimitive(i, origin, dir, best, radius, t, normal) && t <= best)
+            {
+                best = t;
+                hit = true;
+                outHit.distance = t;
+                outHit.normal = normal;
+                outHit.primitive = i;
+                const Primitive &prim = m_primitives[i];
+                outHit.material = prim.type == PrimitiveType::SHAPE      ? m_shapes[prim.index].material
+                                  : prim.type == PrimitiveType::TRIANGLE ? m_triangles[prim.index].material
+                                                                         : m_heightfields[prim.index].material;
+            }
+        }
+    }
+    return hit;
+}
+
+bool StaticGeometry::SweepPrimitive(int primitive, const Vector3f &origin, const Vector3f &dir, float maxDist, float radius,
+                                    float &outDist, Vector3f &outNormal) const
+{
+    const Primitive &prim = m_primitives[primitive];
+    switch (prim.type)
+    {
+    case PrimitiveType::SHAPE:
+        return SweepTests::SweepSphereShape(m_shapes[prim.index].shape, origin, dir, maxDist, radius, outDist, outNormal);
+    case PrimitiveType::TRIANGLE:
+    {
+        // 三角形沿法线外推 radius 后与射线求交, 只处理正面, 忽略边缘圆角
+        const Triangle &tri = m_triangles[prim.index];
+        float denom = tri.normal * dir;
+        float s = (origin - tri.v0) * tri.normal;
+        if (denom >= 0.0f || s < radius)
+            return false;
+        float t = (s - radius) / -denom;
+        if (t > maxDist)
+            return false;
+        Vector3f p = origin + dir * t - tri.normal * radius;
+        if (!ProjectsInsideTriangle(p, tri.v0, tri.v1, tri.v2, tri.normal))
+            return false;
+        outDist = t;
+        outNormal = tri.normal;
+        return true;
+    }
+    case PrimitiveType::HEIGHTFIELD:
+    {
+        // 按半个格子步进, 找到首个穿越地表的区间后二分
+        const Heightfield &field = m_heightfields[prim.index];
+        auto gap = [&](float t, Vector3f &n, bool &inside)
+        {
+            Vector3f p = origin + dir * t;
+            float h;
+            inside = field.Sample(p.x(), p.z(), h, n);
+            return p.y() - radius - h;
+        };
+        const float step = 0.5f * std::min(field.cellSizeX, field.cellSizeZ);
+        Vector3f n;
+        bool inside;
+        float prevT = 0.0f;
+        float prevGap = gap(0.0f, n, inside);
+        if (inside && prevGap <= 0.0f)
+            return false; // 起点在地表以下
+        bool prevInside = inside;
+        for (float t = std::min(step, maxDist);; t = std::min(t + step, maxDist))
+        {
+            float g = gap(t, n, inside);
+            if (inside && prevInside && g <= 0.0f)
+            {
+                float lo = prevT, hi = t;
+                for (int k = 0; k < 8; k++)
+                {
+                    float mid = 0.5f * (lo + hi);
+                    bool midInside;
+                    if (gap(mid, n, midInside) <= 0.0f)
+                        hi = mid;
+                    else
+                        lo = mid;
+                }
+                gap(hi, n, inside);
+                outDist = hi;
+                outNormal = n;
+                return true;
+            }
+            if (t >= maxDist)
+                break;
+            prevT = t;
+            prevInside = inside;
+        }
+        return false;
+    }
+    }
+    return false;
+}
+
+bool StaticGeometry::Heightfield::Sample(float x, float z, float &outHeight, Vector3f &outNormal) const
+{
+    float fx = (x - origin.x()) / cellSizeX;
+    float fz = (z - origin.z()) / cellSizeZ;
+    if (fx < 0.0f || fz < 0.0f || fx > (float)(cols - 1) || fz > (float)(rows - 1))
+        return false;
+    int col = std::min((int)fx, cols - 2);
+    int row = std::min((int)fz, rows - 2);
+    float tx = fx - col, tz = fz - row;
+
+    float h00 = Height(col, row), h10 = Height(col + 1, row);
+    float h01 = Height(col, row + 1), h11 = Height(col + 1, row + 1);
+    outHeight = origin.y() + (h00 * (1.0f - tx) + h10 * tx) * (1.0f - tz) + (h01 * (1.0f - tx) + h11 * tx) * tz;
+
+    float dhdx = ((h10 - h00) * (1.0f - tz) + (h11 - h01) * tz) / cellSizeX;
+    float dhdz = ((h01 - h00) * (1.0f - tx) + (h11 - h10) * tx) / cellSizeZ;
+    outNormal = Vector3f(-dhdx, 1.0f, -dhdz).Normalized();
+    return true;
+}
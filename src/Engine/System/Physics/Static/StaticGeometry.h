@@ -0,0 +1,155 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Math.h"
+#include "Engine/System/Physics/Layers/CollisionLayers.h"
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameWorld;
+class GameObject;
+
+struct StaticMaterial
+{
+    float friction = 0.5f;
+    float restitution = 0.5f;
+};
+
+// 动态物体与静态几何的接触, normal 由动态物体指向静态几何
+struct StaticContact
+{
+    Vector3f normal;
+    float penetration = 0.0f;
+    Vector3f hitPoint;
+    StaticMaterial material;
+    int primitive = 0; // >= 0 为 BVH 图元, < 0 为平面 -(index + 1)
+};
+
+struct StaticSweepHit
+{
+    float distance = 0.0f;
+    Vector3f normal; // 被击中表面的外法线
+    StaticMaterial material;
+    int primitive = 0;
+};
+
+// 静态碰撞几何
+// 平面单独存放 (无界, 每次都测试), 静态盒/球、网格三角形与高度场放进一棵 BVH,
+// 场景加载时 Build 一次, 运行时只读, 可被多个线程同时查询.
+// 物理检测与 CCD 使用全部图元; 场景查询 (RaycastScene) 只补充场景文件中的图元, 烘焙自刚体的仍以物体身份由 RaycastScene 返回.
+// 烘焙自刚体的图元保留该刚体的层与掩码, 检测与扫掠按层过滤; 场景文件中的图元总是参与
+class StaticGeometry
+{
+public:
+    void Clear();
+    // "static": {"planes": [...], "boxes": [...], "heightfields": [...], "meshes": [...]}
+    // 只追加图元, 需要再调用 Build
+    void Load(const json &config);
+    // 把标记为 isStatic 的刚体, 以及没有脚本与父节点的零质量刚体烘焙为静态图元,
+    // 之后 CollisionStage 不再把它们当作候选
+    void AddStaticBodies(GameWorld &world);
+    void Build();
+
+    void AddPlane(const Vector3f &normal, float offset, const StaticMaterial &material = StaticMaterial());
+    void AddShape(const HitBox &shape, const StaticMaterial &material = StaticMaterial());
+    void AddTriangle(const Vector3f &v0, const Vector3f &v1, const Vector3f &v2, const StaticMaterial &material = StaticMaterial());
+    // 高度场以 Y 为高度轴, heights 按行存放 (行沿 Z, 列沿 X), 大小为 rows * cols
+    void AddHeightfield(const Vector3f &origin, float cellSizeX, float cellSizeZ, int cols, int rows,
+                        const std::vector<float> &heights, const StaticMaterial &material = StaticMaterial());
+
+    bool IsEmpty() const { return m_planes.empty() && m_primitives.empty(); }
+    bool IsBuilt() const { return m_built; }
+    size_t GetPrimitiveCount() const { return m_primitives.size(); }
+    size_t GetNodeCount() const { return m_nodes.size(); }
+    size_t GetPlaneCount() const { return m_planes.size(); }
+
+    // 与包围盒重叠的 BVH 图元下标
+    void Query(const AABB &aabb, std::vector<int> &outPrimitives) const;
+    // 生成 body 与全部静态几何的接触, 追加到 out; layer/mask 为 body 的层与有效掩码
+    void Collide(const HitBox &body, const AABB &bodyAABB, std::vector<StaticContact> &out,
+                 int layer = 0, uint32_t mask = CollisionLayers::ALL) const;
+    // 与 shape 是否重叠; includeBodies 为 false 时跳过烘焙自刚体的图元
+    bool Overlaps(const HitBox &shape, const AABB &aabb, bool includeBodies = true) const;
+    // 球沿单位方向 dir 扫掠 maxDist, 返回最近命中; radius 为 0 即射线检测
+    bool SweepSphere(const Vector3f &origin, const Vector3f &dir, float maxDist, float radius, StaticSweepHit &outHit,
+                     bool includeBodies = true, int layer = 0, uint32_t mask = CollisionLayers::ALL) const;
+    // 图元烘焙自的刚体对象, 用作碰撞事件的另一方; 场景文件中的图元或对象已销毁时返回 nullptr
+    GameObject *GetBody(int primitive) const;
+
+    static AABB GetShapeAABB(const HitBox &shape);
+
+private:
+    enum class PrimitiveType
+    {
+        SHAPE,
+        TRIANGLE,
+        HEIGHTFIELD,
+    };
+    struct Primitive
+    {
+        PrimitiveType type;
+        int index;
+        AABB aabb;
+    };
+    struct Node
+    {
+        AABB aabb;
+        int left = -1, right = -1; // -1 为叶子
+        int begin = 0, count = 0;  // 叶子在 m_primitives 中的范围
+    };
+    struct Plane
+    {
+        Vector3f normal;
+        float offset; // normal * x = offset
+        StaticMaterial material;
+    };
+    struct Triangle
+    {
+        Vector3f v0, v1, v2;
+        Vector3f normal;
+        StaticMaterial material;
+    };
+    struct Heightfield
+    {
+        Vector3f origin;
+        float cellSizeX, cellSizeZ;
+        int cols, rows;
+        std::vector<float> heights;
+        StaticMaterial material;
+
+        float Height(int col, int row) const { return heights[row * cols + col]; }
+        // 双线性插值高度与法线, 点在范围外返回 false
+        bool Sample(float x, float z, float &outHeight, Vector3f &outNormal) const;
+    };
+    struct StaticShape
+    {
+        HitBox shape;
+        StaticMaterial material;
+        GameObject *body = nullptr; // 烘焙自该刚体, 场景文件中的图元为空; 只作标记, 不解引用
+        unsigned int bodyId = 0;    // 对象经 GetBody 按 id 找回
+        int layer = 0;
+        uint32_t mask = CollisionLayers::ALL; // 已合并层矩阵的有效掩码
+    };
+
+    int BuildNode(int begin, int end, int depth);
+    // out 为空时只判断是否重叠
+    bool CollidePrimitive(const HitBox &body, const Vector3f *corners, int primitive, std::vector<StaticContact> *out) const;
+    bool IsBodyPrimitive(int primitive) const;
+    bool PassLayer(int primitive, int layer, uint32_t mask) const;
+    bool SweepPrimitive(int primitive, const Vector3f &origin, const Vector3f &dir, float maxDist, float radius,
+                        float &outDist, Vector3f &outNormal) const;
+
+    static constexpr int LEAF_SIZE = 4;
+    static constexpr int MAX_DEPTH = 48;
+
+    std::vector<Plane> m_planes;
+    std::vector<StaticShape> m_shapes;
+    std::vector<Triangle> m_triangles;
+    std::vector<Heightfield> m_heightfields;
+
+    std::vector<Primitive> m_primitives;
+    std::vector<Node> m_nodes;
+    bool m_built = false;
+    const GameWorld *m_world = nullptr; // 烘焙刚体所在的世界
+};
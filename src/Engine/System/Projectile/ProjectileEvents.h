@@ -0,0 +1,23 @@
+#pragma once
+#include "Engine/Core/Events/IEvent.h"
+#include "Engine/Math/Math.h"
+
+class GameObject;
+
+// 投射物命中碰撞体, 在 ProjectileSystem::Update 末尾统一发出, 此时投射物已移除
+struct ProjectileHitEvent : public IEvent
+{
+    EVENT_TYPE(ProjectileHitEvent)
+
+    GameObject *shooter; // 发射者, 已销毁时为空
+    GameObject *victim;  // 命中地面或静态几何时为空
+    int type;
+    float damage;
+    Vector3f point;
+    Vector3f normal;
+    Vector3f velocity; // 命中时的速度
+
+    ProjectileHitEvent(GameObject *shooter, GameObject *victim, int type, float damage,
+                       const Vector3f &point, const Vector3f &normal, const Vector3f &velocity)
+        : shooter(shooter), victim(victim), type(type), damage(damage), point(point), normal(normal), velocity(velocity) {}
+};
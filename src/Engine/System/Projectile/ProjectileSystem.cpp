@@ -0,0 +1,379 @@
+#ifdef _MSC_VER
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4305)
+#endif
+
+#include "ProjectileSystem.h"
+#include "Engine/Core/GameWorld.h"
+#include "Engine/Graphics/ShaderWrapper.h"
+#include "Engine/System/Physics/Profiling/PhysicsStats.h"
+#include "Engine/System/Physics/Stages/GravityStage.h"
+#include "Engine/Utils/JsonParser.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#if !defined(PLATFORM_WEB)
+#include <omp.h>
+#endif
+
+namespace
+{
+    // 水平地面 y = ground 视为下方的半空间, 起点已在地面以下时以距离 0 命中; 比 hit 更近时改写 hit
+    void SweepGround(const mRay &ray, float length, float radius, float ground, mRaycastHit &hit)
+    {
+        const float height = ray.origin.y() - radius - ground;
+        float t;
+        if (height <= 0.0f)
+            t = 0.0f;
+        else if (ray.direction.y() < 0.0f)
+            t = height / -ray.direction.y();
+        else
+            return;
+        if (t > length || (hit.hit && hit.distance <= t))
+            return;
+        hit.hit = true;
+        hit.distance = t;
+        hit.entity = nullptr;
+        hit.normal = Vector3f::UP;
+        hit.point = ray.origin + ray.direction * t - Vector3f::UP * radius;
+    }
+}
+
+ProjectileSystem::~ProjectileSystem()
+{
+    ReleaseRender();
+}
+
+void ProjectileSystem::LoadConfig(const json &config, GameWorld &world)
+{
+    Clear();
+    m_types.clear();
+    m_capacity = config.value("capacity", 20000);
+    auto &layers = world.GetPhysicsSystem().GetCollisionLayers();
+    const json types = config.value("types", json::object());
+    for (auto &[name, typeData] : types.items())
+    {
+        ProjectileType type;
+        type.name = name;
+        type.lifeTime = typeData.value("lifeTime", type.lifeTime);
+        type.damage = typeData.value("damage", type.damage);
+        type.radius = typeData.value("radius", type.radius);
+        type.drag = typeData.value("drag", type.drag);
+        type.mass = typeData.value("mass", type.mass);
+        type.elasticity = typeData.value("elasticity", type.elasticity);
+        if (typeData.contains("gravity"))
+            type.gravity = JsonParser::ToVector3f(typeData["gravity"]);
+        if (typeData.contains("collisionMask"))
+            type.collisionMask = layers.ParseMask(typeData["collisionMask"]);
+        // 按所在层的层矩阵过滤, 与同层刚体的忽略规则一致
+        if (typeData.contains("collisionLayer"))
+        {
+            int layer = layers.ParseLayer(typeData["collisionLayer"]);
+            if (layer >= 0)
+                type.collisionMask &= layers.GetMatrixRow(layer);
+        }
+        if (typeData.contains("size"))
+            type.size = JsonParser::ToVector3f(typeData["size"]);
+        if (typeData.contains("color"))
+            type.color = JsonParser::ToVector4f(typeData["color"]);
+        type.emissive = typeData.value("emissive", type.emissive);
+        RegisterType(type);
+    }
+
+    ReleaseRender();
+    if (!world.IsHeadless() && !m_types.empty())
+        InitRender(world);
+    if (__SHOWINFO__ && !m_types.empty())
+        std::cout << "[ProjectileSystem]: Loaded " << m_types.size() << " projectile types, capacity " << m_capacity << std::endl;
+}
+
+int ProjectileSystem::RegisterType(const ProjectileType &type)
+{
+    int existing = FindType(type.name);
+    if (existing >= 0)
+    {
+        m_types[existing] = type;
+        return existing;
+    }
+    m_types.push_back(type);
+    return (int)m_types.size() - 1;
+}
+
+int ProjectileSystem::FindType(const std::string &name) const
+{
+    for (size_t i = 0; i < m_types.size(); i++)
+    {
+        if (m_types[i].name == name)
+            return (int)i;
+    }
+    return -1;
+}
+
+bool ProjectileSystem::Spawn(int type, const Vector3f &position, const Vector3f &velocity, GameObject *owner)
+{
+    if (type < 0 || type >= (int)m_types.size() || m_projectiles.size() >= m_capacity)
+        return false;
+    m_projectiles.push_back({position, position, velocity, m_types[type].lifeTime, owner ? owner->GetID() : NO_OWNER, (uint16_t)type});
+    return true;
+}
+
+void ProjectileSystem::Clear()
+{
+    m_projectiles.clear();
+    m_lastHitCount = 0;
+}
+
+void ProjectileSystem::Update(GameWorld &world, float fixedDeltaTime)
+{
+    m_lastHitCount = 0;
+    if (m_projectiles.empty())
+    {
+        m_integrateMs = m_sweepMs = 0.0;
+        return;
+    }
+    PhysicsTimer timer;
+    Integrate(fixedDeltaTime);
+    m_integrateMs = timer.Lap();
+    BuildSweeps();
+    Sweep(world);
+    RemoveDead();
+    ApplyImpulses();
+    m_sweepMs = timer.Lap();
+
+    // 移除之后再发事件, 回调中可以直接发射新的投射物
+    for (const auto &hit : m_pendingHits)
+        world.GetEventManager().Emit(ProjectileHitEvent(hit.ownerId == NO_OWNER ? nullptr : world.FindGameObject(hit.ownerId), hit.victim,
+                                                        hit.type, m_types[hit.type].damage, hit.point, hit.normal, hit.velocity));
+}
+
+// v = (v + g * dt) * (1 - drag * dt), 再沿新速度前进; 扫掠检查 prevPosition -> position 这段位移
+void ProjectileSystem::Integrate(float dt)
+{
+    for (auto &p : m_projectiles)
+    {
+        const ProjectileType &type = m_types[p.type];
+        p.prevPosition = p.position;
+        p.velocity = (p.velocity + type.gravity * dt) * std::max(0.0f, 1.0f - type.drag * dt);
+        p.position = p.position + p.velocity * dt;
+        p.life -= dt;
+    }
+}
+
+// 按 (发射者, 类型) 排序后切成连续的射线段, 每段共享忽略对象与层掩码
+void ProjectileSystem::BuildSweeps()
+{
+    const size_t n = m_projectiles.size();
+    m_order.resize(n);
+    for (size_t i = 0; i < n; i++)
+        m_order[i] = (uint32_t)i;
+    std::sort(m_order.begin(), m_order.end(), [this](uint32_t a, uint32_t b)
+              {
+                  const Projectile &pa = m_projectiles[a], &pb = m_projectiles[b];
+                  if (pa.ownerId != pb.ownerId)
+                      return pa.ownerId < pb.ownerId;
+                  return pa.type < pb.type; });
+
+    m_rays.resize(n);
+    m_lengths.resize(n);
+    m_hits.resize(n);
+    m_chunks.clear();
+    for (size_t k = 0; k < n; k++)
+    {
+        const Projectile &p = m_projectiles[m_order[k]];
+        Vector3f delta = p.position - p.prevPosition;
+        float length = delta.Length();
+        mRay &ray = m_rays[k];
+        ray.origin = p.prevPosition;
+        ray.direction = length > 0.0f ? delta / length : Vector3f(0.0f, 0.0f, 1.0f);
+        m_lengths[k] = length;
+
+        SweepChunk *chunk = m_chunks.empty() ? nullptr : &m_chunks.back();
+        if (!chunk || chunk->ownerId != p.ownerId || chunk->type != p.type || chunk->count >= CHUNK_SIZE)
+        {
+            m_chunks.push_back({k, 0, p.ownerId, nullptr, p.type, 0.0f});
+            chunk = &m_chunks.back();
+        }
+        chunk->count++;
+        chunk->maxDistance = std::max(chunk->maxDistance, length);
+    }
+}
+
+void ProjectileSystem::Sweep(GameWorld &world)
+{
+    // 发射者按 ID 排序, 相邻段通常是同一个, 只在变化时查找
+    for (size_t c = 0; c < m_chunks.size(); c++)
+    {
+        SweepChunk &chunk = m_chunks[c];
+        if (c > 0 && m_chunks[c - 1].ownerId == chunk.ownerId)
+            chunk.owner = m_chunks[c - 1].owner;
+        else
+            chunk.owner = chunk.ownerId == NO_OWNER ? nullptr : world.FindGameObject(chunk.ownerId);
+    }
+
+    // GravityStage 的地面: 指定了 groundLayer 时按投射物掩码过滤, 否则总是参与检测
+    auto &physics = world.GetPhysicsSystem();
+    const GravityStage *gravity = physics.FindStage<GravityStage>();
+    const bool groundEnabled = gravity && gravity->IsGroundEnabled();
+    const float ground = gravity ? gravity->GetGround() : 0.0f;
+    const int groundLayer = groundEnabled && !gravity->GetGroundLayerName().empty()
+                                ? physics.GetCollisionLayers().FindLayer(gravity->GetGroundLayerName())
+                                : -1;
+
+    // 只读查询, 各段可并行
+    const RaycastScene &scene = physics.SyncRaycastScene(world);
+    const int chunkCount = (int)m_chunks.size();
+#if !defined(PLATFORM_WEB)
+#pragma omp parallel for schedule(dynamic, 4)
+#endif
+    for (int c = 0; c < chunkCount; c++)
+    {
+        const SweepChunk &chunk = m_chunks[c];
+        const ProjectileType &type = m_types[chunk.type];
+        if (chunk.maxDistance <= 0.0f)
+        {
+            for (size_t k = chunk.begin; k < chunk.begin + chunk.count; k++)
+                m_hits[k] = mRaycastHit();
+            continue;
+        }
+        if (type.radius <= 0.0f)
+            scene.RaycastBatch(m_rays.data() + chunk.begin, m_hits.data() + chunk.begin, chunk.count,
+                               chunk.maxDistance, chunk.owner, type.collisionMask);
+        else
+        {
+            for (size_t k = chunk.begin; k < chunk.begin + chunk.count; k++)
+                m_hits[k] = m_lengths[k] > 0.0f ? scene.SphereCast(m_rays[k].origin, m_rays[k].direction, type.radius, m_lengths[k],
+                                                                   chunk.owner, type.collisionMask)
+                                                : mRaycastHit();
+        }
+        // 段内共用最远距离, 逐条裁掉超出本步位移的命中
+        for (size_t k = chunk.begin; k < chunk.begin + chunk.count; k++)
+        {
+            if (m_hits[k].hit && m_hits[k].distance > m_lengths[k])
+                m_hits[k].hit = false;
+        }
+        if (groundEnabled && (groundLayer < 0 || (type.collisionMask & CollisionLayers::LayerBit(groundLayer))))
+        {
+            for (size_t k = chunk.begin; k < chunk.begin + chunk.count; k++)
+                SweepGround(m_rays[k], m_lengths[k], type.radius, ground, m_hits[k]);
+        }
+    }
+}
+
+// 命中的记录先转为待发事件, 再与到期的一起原地压缩
+void ProjectileSystem::RemoveDead()
+{
+    m_pendingHits.clear();
+    for (size_t k = 0; k < m_order.size(); k++)
+    {
+        const mRaycastHit &hit = m_hits[k];
+        if (!hit.hit)
+            continue;
+        Projectile &p = m_projectiles[m_order[k]];
+        m_pendingHits.push_back({p.ownerId, hit.entity, p.type, hit.point, hit.normal, p.velocity});
+        p.life = -1.0f;
+    }
+    m_lastHitCount = m_pendingHits.size();
+
+    size_t alive = 0;
+    for (size_t i = 0; i < m_projectiles.size(); i++)
+    {
+        if (m_projectiles[i].life > 0.0f)
+            m_projectiles[alive++] = m_projectiles[i];
+    }
+    m_projectiles.resize(alive);
+}
+
+// 投射物视为质点, 与被击中的刚体做一次碰撞冲量, 恢复系数取双方弹性之积
+void ProjectileSystem::ApplyImpulses()
+{
+    for (const auto &hit : m_pendingHits)
+    {
+        const ProjectileType &type = m_types[hit.type];
+        if (type.mass <= 0.0f || !hit.victim || !hit.victim->HasComponent<RigidbodyComponent>())
+            continue;
+        auto &rb = hit.victim->GetComponent<RigidbodyComponent>();
+        if (rb.mass <= std::numeric_limits<float>::min())
+            continue;
+        // normal 为被击中表面外法线
+        Vector3f r = hit.point - hit.victim->GetComponent<TransformComponent>().GetWorldPosition();
+        Vector3f relativeVelocity = hit.velocity - rb.velocity - (rb.angularVelocity ^ r);
+        float vn = relativeVelocity * hit.normal;
+        if (vn >= 0.0f)
+            continue;
+        Vector3f rxn = r ^ hit.normal;
+        float denom = 1.0f / type.mass + 1.0f / rb.mass + rxn * (rb.worldInverseInertia * rxn);
+        float j = -(1.0f + type.elasticity * rb.elasticity) * vn / denom;
+        rb.AddImpulse(-j * hit.normal, r);
+    }
+}
+
+void ProjectileSystem::InitRender(GameWorld &world)
+{
+    auto &rm = world.GetResourceManager();
+    m_shader = rm.GetShader("assets/shaders/projectile/instanced.vs", "assets/shaders/projectile/instanced.fs");
+    if (!m_shader || !m_shader->IsValid())
+    {
+        std::cerr << "[ProjectileSystem]: Failed to load instancing shader" << std::endl;
+        return;
+    }
+    Shader shader = m_shader->GetShader();
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+    m_emissiveLoc = GetShaderLocation(shader, "u_emissive");
+
+    m_mesh = rm.GetModel("primitive://cube").meshes[0];
+    m_material = LoadMaterialDefault();
+    m_material.shader = shader;
+    m_renderReady = true;
+}
+
+void ProjectileSystem::ReleaseRender()
+{
+    if (!m_renderReady)
+        return;
+    // 着色器与网格归 ResourceManager, 这里只释放材质本身
+    m_material.shader.id = rlGetShaderIdDefault();
+    UnloadMaterial(m_material);
+    m_material = {};
+    m_mesh = {};
+    m_shader.reset();
+    m_renderReady = false;
+}
+
+void ProjectileSystem::Render(float alpha)
+{
+    if (!m_renderReady || m_projectiles.empty())
+        return;
+    for (size_t t = 0; t < m_types.size(); t++)
+    {
+        const ProjectileType &type = m_types[t];
+        m_instances.clear();
+        for (const auto &p : m_projectiles)
+        {
+            if (p.type != t)
+                continue;
+            Vector3f pos = Vector3f::Lerp(p.prevPosition, p.position, alpha);
+            float speed = p.velocity.Length();
+            Vector3f z = speed > 1e-4f ? p.velocity / speed : Vector3f(0.0f, 0.0f, 1.0f);
+            Vector3f up = std::fabs(z.y()) < 0.99f ? Vector3f::UP : Vector3f(1.0f, 0.0f, 0.0f);
+            Vector3f x = (up ^ z).Normalized();
+            Vector3f y = z ^ x;
+            x *= type.size.x();
+            y *= type.size.y();
+            z *= type.size.z();
+            m_instances.push_back({x.x(), y.x(), z.x(), pos.x(),
+                                   x.y(), y.y(), z.y(), pos.y(),
+                                   x.z(), y.z(), z.z(), pos.z(),
+                                   0.0f, 0.0f, 0.0f, 1.0f});
+        }
+        if (m_instances.empty())
+            continue;
+        m_material.maps[MATERIAL_MAP_DIFFUSE].color = {(unsigned char)type.color.x(), (unsigned char)type.color.y(),
+                                                       (unsigned char)type.color.z(), (unsigned char)type.color.w()};
+        if (m_emissiveLoc >= 0)
+            SetShaderValue(m_material.shader, m_emissiveLoc, &type.emissive, SHADER_UNIFORM_FLOAT);
+        DrawMeshInstanced(m_mesh, m_material, m_instances.data(), (int)m_instances.size());
+    }
+}
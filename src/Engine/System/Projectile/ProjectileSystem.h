@@ -0,0 +1,138 @@
+#pragma once
+#include "ProjectileEvents.h"
+#include "Engine/Math/Math.h"
+#include "Engine/System/Ray/mRay.h"
+#include "raylib.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+class GameObject;
+class GameWorld;
+class ShaderWrapper;
+
+// 一类投射物的共享参数
+struct ProjectileType
+{
+    std::string name;
+    float lifeTime = 2.0f;
+    float damage = 10.0f;
+    // 0 时按射线扫掠, > 0 时按球扫掠
+    float radius = 0.0f;
+    float drag = 0.0f;
+    Vector3f gravity = Vector3f(0.0f, 0.0f, 0.0f);
+    uint32_t collisionMask = 0xFFFFFFFFu;
+    // 命中刚体时按质点碰撞施加冲量, mass 为 0 时不施加; 投射物自身不受反作用
+    float mass = 0.0f;
+    float elasticity = 0.0f;
+
+    // 渲染: 单位立方体缩放为 size, z 轴沿速度方向
+    Vector3f size = Vector3f(0.2f, 0.2f, 1.0f);
+    Vector4f color = Vector4f(255.0f, 255.0f, 255.0f, 255.0f);
+    float emissive = 1.0f;
+};
+
+// 紧凑的投射物记录, 不是 GameObject
+struct Projectile
+{
+    Vector3f position;
+    Vector3f prevPosition; // 上一固定步的位置, 用于渲染插值
+    Vector3f velocity;
+    float life;
+    unsigned int ownerId; // 发射者 ID, 扫掠时再查找, 发射者销毁后不会留下悬空指针
+    uint16_t type;
+};
+
+// 子弹等短命投射物: 批量积分, 在两次固定步之间用 RaycastScene 扫掠碰撞体与静态几何, 并检测 GravityStage 的地面,
+// 命中时对刚体施加冲量并发出 ProjectileHitEvent, 每类投射物一次实例化绘制. 不参与刚体求解, 也不会被其他物体撞到
+// 场景配置: "projectiles": {"capacity": 20000, "types": {"bullet": {"lifeTime": 1.5, "damage": 10, "collisionLayer": "bullet", ...}}}
+class ProjectileSystem
+{
+public:
+    ProjectileSystem() = default;
+    ~ProjectileSystem();
+
+    void LoadConfig(const json &config, GameWorld &world);
+    int RegisterType(const ProjectileType &type);
+    // 未注册时返回 -1
+    int FindType(const std::string &name) const;
+    const ProjectileType &GetType(int type) const { return m_types[type]; }
+    size_t GetTypeCount() const { return m_types.size(); }
+
+    // 超出容量时返回 false
+    bool Spawn(int type, const Vector3f &position, const Vector3f &velocity, GameObject *owner);
+    void Clear();
+    size_t GetCount() const { return m_projectiles.size(); }
+    static constexpr unsigned int NO_OWNER = 0xFFFFFFFFu;
+    size_t GetCapacity() const { return m_capacity; }
+    void SetCapacity(size_t capacity) { m_capacity = capacity; }
+
+    // 固定步中, 物理步之后调用
+    void Update(GameWorld &world, float fixedDeltaTime);
+    // 在 BeginMode3D 内调用, alpha 为渲染插值系数
+    void Render(float alpha);
+
+    // 最近一步的统计
+    size_t GetLastHitCount() const { return m_lastHitCount; }
+    double GetIntegrateMs() const { return m_integrateMs; }
+    double GetSweepMs() const { return m_sweepMs; }
+
+private:
+    // 同一发射者/类型的一段连续射线, 共享忽略对象与层掩码
+    struct SweepChunk
+    {
+        size_t begin;
+        size_t count;
+        unsigned int ownerId;
+        GameObject *owner; // 扫掠前由 ownerId 查找, 作为忽略对象
+        uint16_t type;
+        float maxDistance;
+    };
+    struct PendingHit
+    {
+        unsigned int ownerId;
+        GameObject *victim;
+        uint16_t type;
+        Vector3f point;
+        Vector3f normal;
+        Vector3f velocity;
+    };
+
+    void Integrate(float fixedDeltaTime);
+    void BuildSweeps();
+    void Sweep(GameWorld &world);
+    void RemoveDead();
+    void ApplyImpulses();
+    void InitRender(GameWorld &world);
+    void ReleaseRender();
+
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    std::vector<ProjectileType> m_types;
+    std::vector<Projectile> m_projectiles;
+    size_t m_capacity = 20000;
+
+    // 每步复用, 稳定后不再分配
+    std::vector<uint32_t> m_order;
+    std::vector<mRay> m_rays;
+    std::vector<float> m_lengths;
+    std::vector<mRaycastHit> m_hits;
+    std::vector<SweepChunk> m_chunks;
+    std::vector<PendingHit> m_pendingHits;
+
+    // 渲染资源, headless 时不创建
+    bool m_renderReady = false;
+    std::shared_ptr<ShaderWrapper> m_shader;
+    Mesh m_mesh = {};
+    Material m_material = {};
+    int m_emissiveLoc = -1;
+    std::vector<Matrix> m_instances;
+
+    size_t m_lastHitCount = 0;
+    double m_integrateMs = 0.0;
+    double m_sweepMs = 0.0;
+};
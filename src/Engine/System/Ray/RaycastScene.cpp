@@ -0,0 +1,605 @@
+#include "RaycastScene.h"
+#include "mRay.h"
+#include "Engine/Core/GameObject/GameObject.h"
+#include "Engine/Core/Components/Components.h"
+#include "Engine/System/Physics/CCD/SweepTests.h"
+#include "Engine/System/Physics/Layers/CollisionLayers.h"
+#include "Engine/System/Physics/Static/StaticGeometry.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // 方向分量为 0 时用极小值代替, 避免 0 * inf 产生 NaN
+    inline float SafeInverse(float d)
+    {
+        return 1.0f / (std::fabs(d) > 1e-8f ? d : std::copysign(1e-8f, d));
+    }
+
+    inline bool SlabTest(const AABB &aabb, const Vector3f &origin, const Vector3f &invDir, float maxDist)
+    {
+        float tMin = 0.0f;
+        float tMax = maxDist;
+        for (int i = 0; i < 3; i++)
+        {
+            float t1 = (aabb.min[i] - origin[i]) * invDir[i];
+            float t2 = (aabb.max[i] - origin[i]) * invDir[i];
+            tMin = std::max(tMin, std::min(t1, t2));
+            tMax = std::min(tMax, std::max(t1, t2));
+        }
+        return tMin <= tMax;
+    }
+
+    AABB ShapeAABB(const HitBox &shape)
+    {
+        Vector3f extent;
+        if (shape.colliderType == ColliderType::SPHERE)
+            extent = Vector3f(shape.boudingRadius, shape.boudingRadius, shape.boudingRadius);
+        else
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                extent[i] = std::fabs(shape.axes[0][i]) * shape.halfExtents[0] +
+                            std::fabs(shape.axes[1][i]) * shape.halfExtents[1] +
+                            std::fabs(shape.axes[2][i]) * shape.halfExtents[2];
+            }
+        }
+        return AABB(shape.center - extent, shape.center + extent);
+    }
+
+    Vector3f ClosestPointOnBox(const HitBox &box, const Vector3f &point)
+    {
+        Vector3f delta = point - box.center;
+        Vector3f result = box.center;
+        for (int i = 0; i < 3; i++)
+        {
+            float d = std::max(-box.halfExtents[i], std::min(delta * box.axes[i], box.halfExtents[i]));
+            result += box.axes[i] * d;
+        }
+        return result;
+    }
+
+    // 布尔重叠测试, 与 HitBox::GetCollisionInfo 不同, 不带穿透容差
+    bool OverlapBoxBox(const HitBox &a, const HitBox &b)
+    {
+        const Vector3f t = b.center - a.center;
+        Vector3f axes[15];
+        int count = 0;
+        for (int i = 0; i < 3; i++)
+        {
+            axes[count++] = a.axes[i];
+            axes[count++] = b.axes[i];
+        }
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                axes[count++] = a.axes[i] ^ b.axes[j];
+        for (int i = 0; i < count; i++)
+        {
+            // 平行边的叉积为零, 跳过
+            if (axes[i].LengthSquared() < 1e-8f)
+                continue;
+            if (std::fabs(t * axes[i]) > HitBox::GetProjectionRadius(a, axes[i]) + HitBox::GetProjectionRadius(b, axes[i]))
+                return false;
+        }
+        return true;
+    }
+
+    bool OverlapShapes(const HitBox &a, const HitBox &b)
+    {
+        const bool sphereA = a.colliderType == ColliderType::SPHERE;
+        const bool sphereB = b.colliderType == ColliderType::SPHERE;
+        if (sphereA && sphereB)
+        {
+            float r = a.boudingRadius + b.boudingRadius;
+            return (a.center - b.center).LengthSquared() <= r * r;
+        }
+        if (sphereA || sphereB)
+        {
+            const HitBox &sphere = sphereA ? a : b;
+            const HitBox &box = sphereA ? b : a;
+            return (ClosestPointOnBox(box, sphere.center) - sphere.center).LengthSquared() <= sphere.boudingRadius * sphere.boudingRadius;
+        }
+        return OverlapBoxBox(a, b);
+    }
+}
+
+// 4 条射线的 SoA 打包, 未使用的通道 tMax 为 -1
+struct RaycastScene::Packet
+{
+    alignas(16) float ox[4], oy[4], oz[4];
+    alignas(16) float ix[4], iy[4], iz[4];
+    alignas(16) float tMax[4];
+    int index[4];
+    int count;
+
+    // 返回与包围盒相交的通道位掩码
+    int Test(const AABB &aabb) const
+    {
+#if defined(NW_MATH_SSE)
+        __m128 t0 = _mm_setzero_ps();
+        __m128 t1 = _mm_load_ps(tMax);
+        const float *o[3] = {ox, oy, oz};
+        const float *inv[3] = {ix, iy, iz};
+        for (int i = 0; i < 3; i++)
+        {
+            __m128 origin = _mm_load_ps(o[i]);
+            __m128 invDir = _mm_load_ps(inv[i]);
+            __m128 a = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(aabb.min[i]), origin), invDir);
+            __m128 b = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(aabb.max[i]), origin), invDir);
+            t0 = _mm_max_ps(t0, _mm_min_ps(a, b));
+            t1 = _mm_min_ps(t1, _mm_max_ps(a, b));
+        }
+        return _mm_movemask_ps(_mm_cmple_ps(t0, t1));
+#else
+        int mask = 0;
+        for (int k = 0; k < 4; k++)
+        {
+            if (SlabTest(aabb, Vector3f(ox[k], oy[k], oz[k]), Vector3f(ix[k], iy[k], iz[k]), tMax[k]))
+                mask |= 1 << k;
+        }
+        return mask;
+#endif
+    }
+};
+
+void RaycastScene::Build(const std::vector<GameObject *> &objects)
+{
+    m_colliders.clear();
+    m_nodes.clear();
+
+    for (auto *object : objects)
+    {
+        if (object->IsWaitingDestroy() || !object->HasComponent<RigidbodyComponent>() || !object->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = object->GetComponent<RigidbodyComponent>();
+        if (!rb.Collidable || (rb.colliderType != ColliderType::BOX && rb.colliderType != ColliderType::SPHERE))
+            continue;
+        auto &tf = object->GetComponent<TransformComponent>();
+
+        // 与逐物体路径一致: 盒在旋转后的局部系中, 中心带 localAABB 偏移, 不受缩放影响
+        Collider collider;
+        collider.entity = object;
+        collider.layerBit = 1u << rb.collisionLayer;
+        Vector3f pos = tf.GetWorldPosition();
+        Quat4f rot = tf.GetWorldRotation();
+        if (rb.colliderType == ColliderType::SPHERE)
+            collider.shape.setHitboxSphere(pos, rot, rb.boudingRadius);
+        else
+            collider.shape.setHitboxBox(pos + rot * ((rb.localAABB.min + rb.localAABB.max) * 0.5f), rot, rb.localAABB);
+        collider.aabb = ShapeAABB(collider.shape);
+        m_colliders.push_back(collider);
+    }
+
+    if (!m_colliders.empty())
+    {
+        m_nodes.reserve(2 * m_colliders.size() / LEAF_SIZE + 1);
+        BuildNode(0, (int)m_colliders.size(), 0);
+    }
+    m_dirty.store(false, std::memory_order_release);
+}
+
+void RaycastScene::Sync(const std::vector<GameObject *> &objects)
+{
+    if (!IsDirty())
+        return;
+    std::lock_guard<std::mutex> lock(m_syncMutex);
+    if (IsDirty())
+        Build(objects);
+}
+
+int RaycastScene::BuildNode(int begin, int end, int depth)
+{
+    const int nodeIndex = (int)m_nodes.size();
+    m_nodes.emplace_back();
+
+    AABB bounds = m_colliders[begin].aabb;
+    Vector3f cmin = (bounds.min + bounds.max) * 0.5f;
+    Vector3f cmax = cmin;
+    for (int i = begin + 1; i < end; i++)
+    {
+        const AABB &b = m_colliders[i].aabb;
+        for (int k = 0; k < 3; k++)
+        {
+            bounds.min[k] = std::min(bounds.min[k], b.min[k]);
+            bounds.max[k] = std::max(bounds.max[k], b.max[k]);
+            float c = (b.min[k] + b.max[k]) * 0.5f;
+            cmin[k] = std::min(cmin[k], c);
+            cmax[k] = std::max(cmax[k], c);
+        }
+    }
+    m_nodes[nodeIndex].aabb = bounds;
+
+    if (end - begin <= LEAF_SIZE || depth >= MAX_DEPTH)
+    {
+        m_nodes[nodeIndex].begin = begin;
+        m_nodes[nodeIndex].count = end - begin;
+        return nodeIndex;
+    }
+
+    // 按质心范围最大的轴取中位数划分
+    Vector3f spread = cmax - cmin;
+    int axis = 0;
+    if (spread.y() > spread[axis])
+        axis = 1;
+    if (spread.z() > spread[axis])
+        axis = 2;
+    const int mid = (begin + end) / 2;
+    std::nth_element(m_colliders.begin() + begin, m_colliders.begin() + mid, m_colliders.begin() + end,
+                     [axis](const Collider &x, const Collider &y)
+                     { return x.aabb.min[axis] + x.aabb.max[axis] < y.aabb.min[axis] + y.aabb.max[axis]; });
+
+    int left = BuildNode(begin, mid, depth + 1);
+    int right = BuildNode(mid, end, depth + 1);
+    m_nodes[nodeIndex].left = left;
+    m_nodes[nodeIndex].right = right;
+    m_nodes[nodeIndex].axis = axis;
+    return nodeIndex;
+}
+
+bool RaycastScene::Intersect(const Collider &collider, const Vector3f &origin, const Vector3f &dir, float maxDist,
+                             float &outDist, Vector3f &outNormal)
+{
+    const HitBox &shape = collider.shape;
+    if (shape.colliderType == ColliderType::SPHERE)
+    {
+        Vector3f oc = origin - shape.center;
+        float b = oc * dir;
+        float c = oc * oc - shape.boudingRadius * shape.boudingRadius;
+        float disc = b * b - c;
+        if (disc < 0.0f)
+            return false;
+        float t = -b - std::sqrt(disc);
+        if (t <= 0.0f || t >= maxDist)
+            return false;
+        outDist = t;
+        outNormal = (origin + dir * t - shape.center).Normalized();
+        return true;
+    }
+
+    Vector3f delta = origin - shape.center;
+    float tMin = 0.0f;
+    float tMax = std::numeric_limits<float>::max();
+    int hitAxis = -1;
+    float hitSign = 0.0f;
+    for (int i = 0; i < 3; i++)
+    {
+        float o = delta * shape.axes[i];
+        float d = dir * shape.axes[i];
+        float h = shape.halfExtents[i];
+        if (std::fabs(d) < 1e-6f)
+        {
+            if (o < -h || o > h)
+                return false;
+            continue;
+        }
+        float invD = 1.0f / d;
+        float t1 = (-h - o) * invD;
+        float t2 = (h - o) * invD;
+        float sign = t1 < t2 ? -1.0f : 1.0f;
+        if (t1 > t2)
+            std::swap(t1, t2);
+        if (t1 > tMin)
+        {
+            tMin = t1;
+            hitAxis = i;
+            hitSign = sign;
+        }
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax)
+            return false;
+    }
+    // 起点在盒内 (tMin == 0) 不算命中
+    if (hitAxis < 0 || tMin >= maxDist)
+        return false;
+    outDist = tMin;
+    outNormal = shape.axes[hitAxis] * hitSign;
+    return true;
+}
+
+bool RaycastScene::Accept(const Collider &collider, GameObject *ignoreEntity, uint32_t layerMask) const
+{
+    return collider.entity != ignoreEntity && (layerMask & collider.layerBit) && !collider.entity->IsWaitingDestroy();
+}
+
+void RaycastScene::TraceStatic(const Vector3f &origin, const Vector3f &dir, float radius, float maxDistance, uint32_t layerMask,
+                               mRaycastHit &hit) const
+{
+    if (!m_staticGeometry || m_staticGeometry->IsEmpty() || !(layerMask & CollisionLayers::LayerBit(0)))
+        return;
+    const float best = hit.hit ? hit.distance : maxDistance;
+    // 与物体一致, 球扫掠起点已重叠时以距离 0 命中
+    bool overlap = false;
+    if (radius > 0.0f && best > 0.0f)
+    {
+        HitBox start;
+        start.setHitboxSphere(origin, Quat4f::IDENTITY, radius);
+        overlap = m_staticGeometry->Overlaps(start, StaticGeometry::GetShapeAABB(start), false);
+    }
+    float dist;
+    Vector3f normal;
+    StaticSweepHit staticHit;
+    if (overlap)
+    {
+        dist = 0.0f;
+        normal = -dir;
+    }
+    else if (m_staticGeometry->SweepSphere(origin, dir, best, radius, staticHit, false) && staticHit.distance < best)
+    {
+        dist = staticHit.distance;
+        normal = staticHit.normal;
+    }
+    else
+        return;
+    hit.hit = true;
+    hit.distance = dist;
+    hit.entity = nullptr;
+    hit.normal = normal;
+    hit.point = origin + dir * dist - normal * radius;
+}
+
+mRaycastHit RaycastScene::Raycast(const mRay &ray, float maxDistance, GameObject *ignoreEntity, uint32_t layerMask) const
+{
+    mRaycastHit closestHit;
+    closestHit.distance = std::numeric_limits<float>::max();
+    if (m_nodes.empty())
+    {
+        TraceStatic(ray.origin, ray.direction, 0.0f, maxDistance, layerMask, closestHit);
+        return closestHit;
+    }
+
+    const Vector3f invDir(SafeInverse(ray.direction.x()), SafeInverse(ray.direction.y()), SafeInverse(ray.direction.z()));
+    float best = maxDistance;
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (!SlabTest(node.aabb, ray.origin, invDir, best))
+            continue;
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                const Collider &collider = m_colliders[i];
+                float dist;
+                Vector3f normal;
+                if (!Accept(collider, ignoreEntity, layerMask) || !Intersect(collider, ray.origin, ray.direction, best, dist, normal))
+                    continue;
+                best = dist;
+                closestHit.hit = true;
+                closestHit.distance = dist;
+                closestHit.entity = collider.entity;
+                closestHit.normal = normal;
+                closestHit.point = ray.origin + ray.direction * dist;
+            }
+            continue;
+        }
+        // 近的子节点后入栈先访问
+        if (ray.direction[node.axis] >= 0.0f)
+        {
+            stack[top++] = node.right;
+            stack[top++] = node.left;
+        }
+        else
+        {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+    TraceStatic(ray.origin, ray.direction, 0.0f, maxDistance, layerMask, closestHit);
+    return closestHit;
+}
+
+void RaycastScene::RaycastBatch(const mRay *rays, mRaycastHit *outHits, size_t count, float maxDistance,
+                                GameObject *ignoreEntity, uint32_t layerMask) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        outHits[i] = mRaycastHit();
+        outHits[i].distance = std::numeric_limits<float>::max();
+    }
+
+    Packet packet;
+    for (size_t base = 0; !m_nodes.empty() && base < count; base += 4)
+    {
+        packet.count = (int)std::min<size_t>(4, count - base);
+        for (int k = 0; k < 4; k++)
+        {
+            if (k < packet.count)
+            {
+                const mRay &ray = rays[base + k];
+                packet.index[k] = (int)(base + k);
+                packet.ox[k] = ray.origin.x();
+                packet.oy[k] = ray.origin.y();
+                packet.oz[k] = ray.origin.z();
+                packet.ix[k] = SafeInverse(ray.direction.x());
+                packet.iy[k] = SafeInverse(ray.direction.y());
+                packet.iz[k] = SafeInverse(ray.direction.z());
+                packet.tMax[k] = maxDistance;
+            }
+            else
+            {
+                packet.index[k] = -1;
+                packet.ox[k] = packet.oy[k] = packet.oz[k] = 0.0f;
+                packet.ix[k] = packet.iy[k] = packet.iz[k] = 1.0f;
+                packet.tMax[k] = -1.0f;
+            }
+        }
+        TracePacket(packet, rays, outHits, ignoreEntity, layerMask);
+    }
+    for (size_t i = 0; i < count; i++)
+        TraceStatic(rays[i].origin, rays[i].direction, 0.0f, maxDistance, layerMask, outHits[i]);
+}
+
+void RaycastScene::TracePacket(Packet &packet, const mRay *rays, mRaycastHit *outHits, GameObject *ignoreEntity, uint32_t layerMask) const
+{
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        const int mask = packet.Test(node.aabb);
+        if (mask == 0)
+            continue;
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                const Collider &collider = m_colliders[i];
+                if (!Accept(collider, ignoreEntity, layerMask))
+                    continue;
+                for (int k = 0; k < packet.count; k++)
+                {
+                    if (!(mask & (1 << k)))
+                        continue;
+                    const mRay &ray = rays[packet.index[k]];
+                    float dist;
+                    Vector3f normal;
+                    if (!Intersect(collider, ray.origin, ray.direction, packet.tMax[k], dist, normal))
+                        continue;
+                    packet.tMax[k] = dist;
+                    mRaycastHit &hit = outHits[packet.index[k]];
+                    hit.hit = true;
+                    hit.distance = dist;
+                    hit.entity = collider.entity;
+                    hit.normal = normal;
+                    hit.point = ray.origin + ray.direction * dist;
+                }
+            }
+            continue;
+        }
+        // 以第一条命中的射线方向决定远近顺序
+        const int lead = mask & 1 ? 0 : mask & 2 ? 1 : mask & 4 ? 2 : 3;
+        if (rays[packet.index[lead]].direction[node.axis] >= 0.0f)
+        {
+            stack[top++] = node.right;
+            stack[top++] = node.left;
+        }
+        else
+        {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+}
+
+int RaycastScene::OverlapSphere(const Vector3f &center, float radius, GameObject **outResults, int capacity,
+                                GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic) const
+{
+    HitBox query;
+    query.setHitboxSphere(center, Quat4f::IDENTITY, radius);
+    return Overlap(query, ShapeAABB(query), outResults, capacity, ignoreEntity, layerMask, outStatic);
+}
+
+int RaycastScene::OverlapBox(const Vector3f &center, const Vector3f &halfExtents, const Quat4f &rotation, GameObject **outResults,
+                             int capacity, GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic) const
+{
+    HitBox query;
+    query.setHitboxBox(center, rotation, AABB(-halfExtents, halfExtents));
+    return Overlap(query, ShapeAABB(query), outResults, capacity, ignoreEntity, layerMask, outStatic);
+}
+
+int RaycastScene::Overlap(const HitBox &query, const AABB &queryAABB, GameObject **outResults, int capacity,
+                          GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic) const
+{
+    if (outStatic)
+        *outStatic = m_staticGeometry && (layerMask & CollisionLayers::LayerBit(0)) && m_staticGeometry->Overlaps(query, queryAABB, false);
+    int count = 0;
+    if (m_nodes.empty() || capacity <= 0)
+        return 0;
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (!AABB::IsCollide(node.aabb, queryAABB))
+            continue;
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                const Collider &collider = m_colliders[i];
+                if (!Accept(collider, ignoreEntity, layerMask) || !AABB::IsCollide(collider.aabb, queryAABB) ||
+                    !OverlapShapes(query, collider.shape))
+                    continue;
+                outResults[count++] = collider.entity;
+                if (count >= capacity)
+                    return count;
+            }
+            continue;
+        }
+        stack[top++] = node.right;
+        stack[top++] = node.left;
+    }
+    return count;
+}
+
+mRaycastHit RaycastScene::SphereCast(const Vector3f &origin, const Vector3f &direction, float radius, float maxDistance,
+                                     GameObject *ignoreEntity, uint32_t layerMask) const
+{
+    mRaycastHit closestHit;
+    closestHit.distance = std::numeric_limits<float>::max();
+    const Vector3f dir = direction.Normalized();
+    if (m_nodes.empty())
+    {
+        TraceStatic(origin, dir, radius, maxDistance, layerMask, closestHit);
+        return closestHit;
+    }
+
+    const Vector3f invDir = SweepTests::InverseDirection(dir);
+    HitBox start;
+    start.setHitboxSphere(origin, Quat4f::IDENTITY, radius);
+    float best = maxDistance;
+    int stack[MAX_DEPTH * 2 + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0 && best > 0.0f)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (!SweepTests::RayAABB(node.aabb, origin, invDir, best, radius))
+            continue;
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.begin + node.count; i++)
+            {
+                const Collider &collider = m_colliders[i];
+                if (!Accept(collider, ignoreEntity, layerMask))
+                    continue;
+                float dist;
+                Vector3f normal;
+                if (OverlapShapes(start, collider.shape))
+                {
+                    dist = 0.0f;
+                    normal = -dir;
+                }
+                else if (!SweepTests::SweepSphereShape(collider.shape, origin, dir, best, radius, dist, normal) || dist >= best)
+                    continue;
+                best = dist;
+                closestHit.hit = true;
+                closestHit.distance = dist;
+                closestHit.entity = collider.entity;
+                closestHit.normal = normal;
+                // 接触点在球面上
+                closestHit.point = origin + dir * dist - normal * radius;
+            }
+            continue;
+        }
+        if (dir[node.axis] >= 0.0f)
+        {
+            stack[top++] = node.right;
+            stack[top++] = node.left;
+        }
+        else
+        {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+    TraceStatic(origin, dir, radius, maxDistance, layerMask, closestHit);
+    return closestHit;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "Engine/Core/Components/Components.h"
+#include "Engine/Math/Math.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+class GameObject;
+class mRay;
+struct mRaycastHit;
+class StaticGeometry;
+
+// 射线/重叠/扫掠查询的加速结构
+// 缓存可碰撞物体的世界姿态 (OBB 的逆变换即三个轴的转置, 不再逐次求逆矩阵) 并建一棵 BVH.
+// GameWorld 在 UpdateTransforms / 销毁物体 / 激活状态变化后标记失效, 下次查询时重建;
+// 两次同步之间脚本直接改动的变换要到下次同步才可见.
+// Sync 之后的查询只读, 可在两次物理步之间被多个线程同时调用.
+// 设置了 StaticGeometry 时查询同时检测场景文件中的静态图元, 视为 Default 层, 命中时 entity 为空
+class RaycastScene
+{
+public:
+    void SetStaticGeometry(const StaticGeometry *geometry) { m_staticGeometry = geometry; }
+    void MarkDirty() { m_dirty.store(true, std::memory_order_release); }
+    bool IsDirty() const { return m_dirty.load(std::memory_order_acquire); }
+    // 从物体列表重建, 只收录可碰撞的盒/球
+    void Build(const std::vector<GameObject *> &objects);
+    // 失效时重建, 多线程同时调用只有一个线程重建
+    void Sync(const std::vector<GameObject *> &objects);
+
+    mRaycastHit Raycast(const mRay &ray, float maxDistance, GameObject *ignoreEntity, uint32_t layerMask) const;
+    // 每 4 条射线一组遍历 BVH, 节点用 SIMD slab 测试, outHits 与 rays 等长
+    void RaycastBatch(const mRay *rays, mRaycastHit *outHits, size_t count, float maxDistance,
+                      GameObject *ignoreEntity, uint32_t layerMask) const;
+
+    // 与球/OBB 重叠的物体写入 outResults, 至多 capacity 个, 返回写入个数
+    // 静态图元不对应物体, outStatic 非空时写入是否与其重叠
+    int OverlapSphere(const Vector3f &center, float radius, GameObject **outResults, int capacity,
+                      GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic = nullptr) const;
+    int OverlapBox(const Vector3f &center, const Vector3f &halfExtents, const Quat4f &rotation, GameObject **outResults,
+                   int capacity, GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic = nullptr) const;
+    // 球沿 direction 扫掠, 起点已重叠的物体以距离 0 命中
+    mRaycastHit SphereCast(const Vector3f &origin, const Vector3f &direction, float radius, float maxDistance,
+                           GameObject *ignoreEntity, uint32_t layerMask) const;
+
+    size_t GetColliderCount() const { return m_colliders.size(); }
+    size_t GetNodeCount() const { return m_nodes.size(); }
+
+private:
+    struct Collider
+    {
+        GameObject *entity;
+        HitBox shape; // 世界空间
+        uint32_t layerBit;
+        AABB aabb;
+    };
+    struct Node
+    {
+        AABB aabb;
+        int left = -1, right = -1; // -1 为叶子
+        int begin = 0, count = 0;
+        int axis = 0; // 划分轴, 用于由近到远遍历
+    };
+    struct Packet;
+
+    int BuildNode(int begin, int end, int depth);
+    // 命中且 0 < dist < maxDist 时返回 true
+    static bool Intersect(const Collider &collider, const Vector3f &origin, const Vector3f &dir, float maxDist,
+                          float &outDist, Vector3f &outNormal);
+    bool Accept(const Collider &collider, GameObject *ignoreEntity, uint32_t layerMask) const;
+    int Overlap(const HitBox &query, const AABB &queryAABB, GameObject **outResults, int capacity,
+                GameObject *ignoreEntity, uint32_t layerMask, bool *outStatic) const;
+    // 静态图元比 hit 更近时改写 hit
+    void TraceStatic(const Vector3f &origin, const Vector3f &dir, float radius, float maxDistance, uint32_t layerMask,
+                     mRaycastHit &hit) const;
+    void TracePacket(Packet &packet, const mRay *rays, mRaycastHit *outHits, GameObject *ignoreEntity, uint32_t layerMask) const;
+
+    static constexpr int LEAF_SIZE = 4;
+    static constexpr int MAX_DEPTH = 48;
+
+    std::vector<Collider> m_colliders;
+    std::vector<Node> m_nodes;
+    const StaticGeometry *m_staticGeometry = nullptr;
+    std::atomic<bool> m_dirty{true};
+    std::mutex m_syncMutex;
+};
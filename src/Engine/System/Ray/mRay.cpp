@@ -3,20 +3,32 @@
 #include "Engine/Core/GameWorld.h"
 #include <limits>
 
-mRaycastHit mRay::Raycast(float maxDistance, GameWorld &world, GameObject *ignoreEntity) const
+mRaycastHit mRay::Raycast(float maxDistance, GameWorld &world, GameObject *ignoreEntity, uint32_t layerMask) const
+{
+    return world.GetPhysicsSystem().SyncRaycastScene(world).Raycast(*this, maxDistance, ignoreEntity, layerMask);
+}
+
+void mRay::RaycastBatch(const std::vector<mRay> &rays, std::vector<mRaycastHit> &outHits, float maxDistance, GameWorld &world,
+                        GameObject *ignoreEntity, uint32_t layerMask)
+{
+    outHits.resize(rays.size());
+    world.GetPhysicsSystem().SyncRaycastScene(world).RaycastBatch(rays.data(), outHits.data(), rays.size(), maxDistance, ignoreEntity, layerMask);
+}
+
+mRaycastHit mRay::Raycast(float maxDistance, const std::vector<GameObject *> &entities, GameObject *ignoreEntity, uint32_t layerMask) const
 {
     mRaycastHit closestHit;
     closestHit.distance = std::numeric_limits<float>::max();
-    auto entities = world.GetEntitiesWith<RigidbodyComponent, TransformComponent>();
 
     for (auto *entity : entities)
     {
-        if (entity == ignoreEntity)
+        if (entity == ignoreEntity || entity->IsWaitingDestroy() || !entity->HasComponent<RigidbodyComponent>() ||
+            !entity->HasComponent<TransformComponent>())
             continue;
         auto &rb = entity->GetComponent<RigidbodyComponent>();
         auto &tf = entity->GetComponent<TransformComponent>();
 
-        if (!rb.Collidable)
+        if (!rb.Collidable || !(layerMask & (1u << rb.collisionLayer)))
             continue;
 
         float dist = 0.0f;
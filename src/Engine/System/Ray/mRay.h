@@ -1,6 +1,8 @@
 #pragma once
 #include "Engine/Math/Math.h"
 #include "Engine/Core/Components/Components.h"
+#include <cstdint>
+#include <vector>
 class GameObject;
 class GameWorld;
 
@@ -21,7 +23,16 @@ public:
 
     mRay() : origin(0, 0, 0), direction(0, 0, 1) {}
     mRay(const Vector3f &origin, const Vector3f &direction) : origin(origin), direction(direction.Normalized()) {}
-    mRaycastHit Raycast(float maxDistance, GameWorld &world, GameObject *ignoreEntity = nullptr) const;
+    // layerMask: 只检测所在层在掩码内的物体
+    // 走 PhysicsSystem 的 RaycastScene (BVH), 场景失效时先重建
+    mRaycastHit Raycast(float maxDistance, GameWorld &world, GameObject *ignoreEntity = nullptr, uint32_t layerMask = 0xFFFFFFFFu) const;
+    // 逐个遍历给定物体, 不建加速结构
+    mRaycastHit Raycast(float maxDistance, const std::vector<GameObject *> &entities, GameObject *ignoreEntity = nullptr,
+                        uint32_t layerMask = 0xFFFFFFFFu) const;
+
+    // 批量射线检测, outHits 调整为与 rays 等长
+    static void RaycastBatch(const std::vector<mRay> &rays, std::vector<mRaycastHit> &outHits, float maxDistance, GameWorld &world,
+                             GameObject *ignoreEntity = nullptr, uint32_t layerMask = 0xFFFFFFFFu);
 
 private:
     bool IntersectOBB(const TransformComponent &tf, const RigidbodyComponent &rb, float &outDist, Vector3f &outNormal) const;
@@ -13,8 +13,26 @@ void SceneManager::ParsePhysics(const json &sceneData, GameWorld &gameWorld)
 {
     auto &physicsSystem = gameWorld.GetPhysicsSystem();
     auto &factory = gameWorld.GetPhysicsStageFactory();
-    auto stageJson = sceneData["physicsStage"];
+    auto stageJson = sceneData.value("physicsStage", json::object());
     physicsSystem.ClearStages();
+    // 未配置的子系统也用空配置初始化, 恢复默认值, 不沿用上一个场景的设置
+    physicsSystem.GetContactSolver().Initialize(sceneData.value("solver", json::object()));
+    physicsSystem.GetIslandManager().Initialize(sceneData.value("sleep", json::object()));
+    // 层矩阵先于预制体解析, 预制体中的层名可以直接引用
+    physicsSystem.GetCollisionLayers().Initialize(sceneData.value("layers", json::object()));
+    physicsSystem.GetContinuousCollision().Initialize(sceneData.value("ccd", json::object()));
+    if (sceneData.contains("static"))
+        physicsSystem.GetStaticGeometry().Load(sceneData["static"]);
+    physicsSystem.InitializeProfiling(sceneData.value("profile", json{{"enable", false}}));
+    std::string integrator = sceneData.value("integrator", "scalar");
+    if (integrator == "batch")
+        physicsSystem.SetIntegrator(IntegratorType::BATCH);
+    else
+    {
+        if (integrator != "scalar")
+            std::cerr << "[SceneManager]: Unknown integrator " << integrator << ", fallback to scalar" << std::endl;
+        physicsSystem.SetIntegrator(IntegratorType::SCALAR);
+    }
     for (auto &[stageName, stageConfig] : stageJson.items())
     {
         if (stageConfig.value("enable", false))
@@ -23,7 +41,7 @@ void SceneManager::ParsePhysics(const json &sceneData, GameWorld &gameWorld)
             if (stage)
             {
                 stage->Initialize(stageConfig);
-                physicsSystem.AddStage(std::move(stage));
+                physicsSystem.AddStage(std::move(stage), stageName);
             }
         }
     }
@@ -40,10 +58,11 @@ bool SceneManager::LoadScene(const std::string &scenePath, GameWorld &gameWorld)
     }
     PhysicsSystem &physicsSystem = gameWorld.GetPhysicsSystem();
     json sceneData = json::parse(file);
-    if (sceneData.contains("physics"))
-    {
-        ParsePhysics(sceneData["physics"], gameWorld);
-    }
+    physicsSystem.GetStaticGeometry().Clear();
+    // 没有 physics 块时同样重置为默认设置
+    ParsePhysics(sceneData.value("physics", json::object()), gameWorld);
+    // 没有配置时也要调用, 清掉上一个场景的类型与渲染资源
+    gameWorld.GetProjectileSystem().LoadConfig(sceneData.value("projectiles", json::object()), gameWorld);
     if (sceneData.contains("objectsPools"))
     {
         ParseGameObjectPools(sceneData["objectsPools"], gameWorld);
@@ -61,6 +80,9 @@ bool SceneManager::LoadScene(const std::string &scenePath, GameWorld &gameWorld)
     }
     gameWorld.GetCameraManager().ResolveMounts(gameWorld);
     gameWorld.UpdateTransforms();
+    // 静态几何只在加载时构建一次
+    physicsSystem.GetStaticGeometry().AddStaticBodies(gameWorld);
+    physicsSystem.GetStaticGeometry().Build();
     return true;
 }
 
@@ -120,6 +142,9 @@ void SceneManager::ParseEntity(const json &entityData, GameWorld &gameWorld, Gam
         //     render.scale = render.scale & tf.GetLocalScale();
         // }
     }
+    // 缩放会重设惯性, 最后按最终朝向刷新世界系逆惯性
+    if (obj.HasComponent<RigidbodyComponent>())
+        obj.GetComponent<RigidbodyComponent>().UpdateWorldInertia(tf.GetLocalRotation());
 
     if (entityData.contains("physics"))
     {
@@ -248,6 +273,8 @@ void SceneManager::AddRigidbody(GameObject &gameObject, const json &rigidData)
     rb.angularDrag = rigidData.value("angularDrag", rb.angularDrag);
     rb.elasticity = rigidData.value("elasticity", rb.elasticity);
     rb.Collidable = rigidData.value("collidable", rb.Collidable);
+    rb.isStatic = rigidData.value("static", rb.isStatic);
+    rb.ccd = rigidData.value("ccd", rb.ccd);
     if (rigidData.contains("velocity"))
         rb.velocity = JsonParser::ToVector3f(rigidData["velocity"]);
     if (rigidData.contains("angularVelocity"))
@@ -255,6 +282,9 @@ void SceneManager::AddRigidbody(GameObject &gameObject, const json &rigidData)
 
     if (rigidData.contains("hitBox"))
         rb.SetHitbox(JsonParser::ToVector3f(rigidData["hitBox"]));
+
+    if (gameObject.GetOwnerWorld())
+        gameObject.GetOwnerWorld()->GetPhysicsSystem().GetCollisionLayers().ParseBodyLayer(rigidData, rb.collisionLayer, rb.collisionMask);
 }
 
 void SceneManager::AddScripts(GameWorld &gameWorld, GameObject &gameObject, const json &scripts)
@@ -20,6 +20,17 @@ public:
     // 每一帧都调用（输入、非物理逻辑）
     virtual void Update(float deltaTime) = 0;
 
+    // 每帧固定步之后、Update 之前调用, alpha 为两次固定步之间的渲染插值系数
+    virtual void SetInterpolationAlpha(float alpha) {}
+
+    // 异步模拟 (如异步物理): 后台仍在计算上一帧交出的工作时返回 true, 本帧跳过 FixedUpdate;
+    // Update 照常调用, 屏幕在其中跳过读写模拟状态的部分
+    virtual bool IsSimulationBusy() const { return false; }
+    // 异步模拟每帧至多推进一个固定步, 追帧的时间留在累积器里分摊到之后的帧
+    virtual bool IsSimulationAsync() const { return false; }
+    // 绘制之前调用, 把待算的工作交给后台线程与绘制并行
+    virtual void BeginAsyncSimulation() {}
+
     // Update 后（绘制）
     virtual void Draw() = 0;
 
@@ -5,6 +5,8 @@
 #include "Engine/Network/Chat/ChatManager.h"
 #include "Engine/System/HUD/HudBridgeScript.h"
 #include <algorithm>
+#include <cmath>
+#include <iostream>
 
 #if defined(PLATFORM_WEB)
 #include <emscripten/emscripten.h>
@@ -28,7 +30,7 @@ ScreenManager::ScreenManager(const EngineConfig &config, const std::string audio
 {
     InitWindow(config.screenWidth, config.screenHeight, config.windowTitle.c_str());
     SetTargetFPS((int)config.targetFPS);
-    m_timeManager = TimeManager(static_cast<float>(config.targetFPS));
+    m_timeManager = TimeManager(config.GetFixedRate());
     m_accumulator = 0.0f;
     SetExitKey(KEY_NULL);
     m_activeConfig.screenWidth = GetScreenWidth();
@@ -110,6 +112,7 @@ void ScreenManager::ApplySettings(const EngineConfig &newConfig)
     }
 #endif
     SetTargetFPS((int)newConfig.targetFPS);
+    m_timeManager.setFPS(newConfig.GetFixedRate());
 
     // Persist the last applied settings and sync to the actual runtime window.
     m_activeConfig = newConfig;
@@ -170,12 +173,45 @@ bool ScreenManager::UpdateFrame()
     m_timeManager.Tick();
     m_accumulator += m_timeManager.GetDeltaTime();
 
-    while (m_accumulator >= m_timeManager.GetFixedDeltaTime())
+    const float fixedDeltaTime = m_timeManager.GetFixedDeltaTime();
+    // 上一帧交出的物理步还没算完: 本帧不推进模拟, 时间留在累积器里, 主线程不等待
+    const bool simulationBusy = m_currentScreen->IsSimulationBusy();
+    const bool simulationAsync = m_currentScreen->IsSimulationAsync();
+    int substeps = 0;
+    while (!simulationBusy && m_accumulator >= fixedDeltaTime)
     {
-        m_currentScreen->FixedUpdate(m_timeManager.GetFixedDeltaTime());
-        m_accumulator -= m_timeManager.GetFixedDeltaTime();
+        // 异步模拟一帧只交出一步, 剩余时间由之后的帧继续追
+        if (simulationAsync && substeps >= 1)
+            break;
+        // 卡顿后追帧有上限, 超出部分丢弃 (游戏时间相对现实时间变慢), 避免越追越慢
+        if (m_activeConfig.maxSubsteps > 0 && substeps >= m_activeConfig.maxSubsteps)
+        {
+            if (__SHOWINFO__)
+                std::cout << "[ScreenManager]: Dropped " << m_accumulator << "s after " << substeps << " fixed steps" << std::endl;
+            m_accumulator = std::fmod(m_accumulator, fixedDeltaTime);
+            break;
+        }
+        m_currentScreen->FixedUpdate(fixedDeltaTime);
+        m_accumulator -= fixedDeltaTime;
+        substeps++;
     }
-
+    // 异步模式下累积器同样受 maxSubsteps 限制, 超出部分丢弃
+    if (simulationAsync && m_activeConfig.maxSubsteps > 0)
+    {
+        const float maxAccumulator = m_activeConfig.maxSubsteps * fixedDeltaTime;
+        if (m_accumulator > maxAccumulator)
+        {
+            if (__SHOWINFO__)
+                std::cout << "[ScreenManager]: Dropped " << m_accumulator - maxAccumulator << "s of async simulation backlog" << std::endl;
+            m_accumulator = maxAccumulator;
+        }
+    }
+    if (!simulationBusy)
+    {
+        const float alpha = std::min(m_accumulator / fixedDeltaTime, 1.0f);
+        m_currentScreen->SetInterpolationAlpha(m_activeConfig.interpolation ? alpha : 1.0f);
+    }
+    // 模拟忙时也要更新: 输入/HUD/退出/相机每帧处理, 由屏幕自行跳过读写模拟状态的部分
     m_currentScreen->Update(m_timeManager.GetDeltaTime());
 
     // Poll global network while outside gameplay, and send keep-alive heartbeats
@@ -220,6 +256,7 @@ bool ScreenManager::UpdateFrame()
 
     BeginDrawing();
     ClearBackground(BLACK);
+    m_currentScreen->BeginAsyncSimulation();
     m_currentScreen->Draw();
     EndDrawing();
 
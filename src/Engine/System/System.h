@@ -1,5 +1,6 @@
 #include "Engine/System/Input/InputManager.h"
 #include "Engine/System/Physics/Physics.h"
+#include "Engine/System/Projectile/ProjectileSystem.h"
 #include "Engine/System/Resource/ResourceManager.h"
 #include "Engine/System/Screen/Screen.h"
 #include "Engine/System/HUD/HUD.h"
@@ -13,6 +13,7 @@
 #include "Game/Scripts/Scripts.h"
 
 #include "Game/Events/CombatEvents.h"
+#include "Engine/System/Projectile/ProjectileEvents.h"
 
 #include "rlgl.h"
 #include <random>
@@ -88,6 +89,8 @@ void AIEnvironment::ConfigCallback(ScriptingFactory &scriptingFactory, PhysicsSt
                                  { return std::make_unique<CollisionStage>(); });
     physicsStageFactory.Register("GravityStage", []()
                                  { return std::make_unique<GravityStage>(); });
+    physicsStageFactory.Register("FlightDynamicsStage", []()
+                                 { return std::make_unique<FlightDynamicsStage>(); });
 
     // 注册脚本
     scriptingFactory.Register("RotatorScript", []()
@@ -152,6 +155,12 @@ if (e.m_object1->GetTag() == "bullet" && e.m_object2->GetScript<HealthScript>())
     m_gameWorld->GetEventManager().Emit(DamageEvent(e.m_object2, 10.0f, e.hitpoint));
 e.m_object1->SetIsWaitingDestroy(true);
 } });
+    // ProjectileSystem 中的子弹命中, 与 GameplayScreen 一致
+    m_gameWorld->GetEventManager().Subscribe<ProjectileHitEvent>([this](const ProjectileHitEvent &e)
+                                                                 {
+                                                                     if (e.victim && e.victim->GetScript<HealthScript>())
+                                                                         m_gameWorld->GetEventManager().Emit(DamageEvent(e.victim, e.damage, e.point));
+                                                                 });
 }
 
 RenderTexture2D &AIEnvironment::GetFbo()
@@ -23,23 +23,23 @@ GameObject *AttitudeHud::GetLocalPlayer() const
     return nullptr;
 }
 
-void AttitudeHud::Draw()
+void AttitudeHud::Update(float deltaTime)
 {
+    // 物理线程运行中刚体与射线场景不可读, 沿用上一帧的读数
+    if (m_world && m_world->IsPhysicsBusy())
+        return;
+    m_hasPlayer = false;
     GameObject *player = GetLocalPlayer();
     if (!player)
         return;
-
-    const auto &tf = player->GetComponent<TransformComponent>();
-    const auto &rb = player->GetComponent<RigidbodyComponent>();
     auto *mainCam = m_world->GetCameraManager().GetMainCamera();
     if (!mainCam)
         return;
 
+    const auto &tf = player->GetComponent<TransformComponent>();
+    const auto &rb = player->GetComponent<RigidbodyComponent>();
     float airspeed = rb.velocity.Length();
-    float speedFactor = std::clamp(airspeed / 100.0f, 0.0f, 1.0f);
-    float dynamicPixelsPerDegree = m_pixelsPerDegree / (1.0f + speedFactor * 10.0f);
-    float dynamicLadderWidth = m_ladderWidth * (1.0f - speedFactor * 0.9f);
-    float dynamicLadderGap = m_ladderGap * (1.0f - speedFactor * 0.9f);
+    m_speedFactor = std::clamp(airspeed / 100.0f, 0.0f, 1.0f);
 
     Vector3f nosePos = tf.GetWorldPosition();
     Vector3f forward = tf.GetForward();
@@ -47,24 +47,45 @@ void AttitudeHud::Draw()
     Vector3f up = tf.GetUp();
 
     float pitchRad = asinf(fmaxf(-1.0f, fminf(1.0f, forward.y())));
-    float pitchDeg = pitchRad * RAD2DEG;
-
-    float rollRad = atan2f(right.y(), up.y());
-
-    float screenX = GetScreenWidth() / 2.0f;
-    float screenY = GetScreenHeight() / 2.0f;
+    m_pitchDeg = pitchRad * RAD2DEG;
+    m_rollRad = atan2f(right.y(), up.y());
 
     mRay aimRay(nosePos, forward);
     mRaycastHit hit = aimRay.Raycast(3000.0f, *m_world, player);
-    Vector3f worldAimPoint;
     if (hit.hit)
     {
-        worldAimPoint = hit.point;
+        m_aimPoint = hit.point;
     }
     else
     {
-        worldAimPoint = nosePos + forward * 3000.0f;
+        m_aimPoint = nosePos + forward * 3000.0f;
     }
+
+    mRay camRay(mainCam->getPosition(), mainCam->getDirection());
+    m_centerHit = camRay.Raycast(3000.0f, *m_world, player).hit;
+    m_hasPlayer = true;
+}
+
+void AttitudeHud::Draw()
+{
+    if (!m_hasPlayer)
+        return;
+    auto *mainCam = m_world->GetCameraManager().GetMainCamera();
+    if (!mainCam)
+        return;
+
+    float speedFactor = m_speedFactor;
+    float dynamicPixelsPerDegree = m_pixelsPerDegree / (1.0f + speedFactor * 10.0f);
+    float dynamicLadderWidth = m_ladderWidth * (1.0f - speedFactor * 0.9f);
+    float dynamicLadderGap = m_ladderGap * (1.0f - speedFactor * 0.9f);
+
+    float pitchDeg = m_pitchDeg;
+    float rollRad = m_rollRad;
+
+    float screenX = GetScreenWidth() / 2.0f;
+    float screenY = GetScreenHeight() / 2.0f;
+
+    Vector3f worldAimPoint = m_aimPoint;
     Vector3f toPoint = (worldAimPoint - mainCam->Position()).Normalized();
     float dotProduct = toPoint * mainCam->Direction();
     Vector2 aimScreenPos;
@@ -82,10 +103,8 @@ void AttitudeHud::Draw()
         DrawLineEx({reticleX + 5, reticleY}, {reticleX + lineLen + 5, reticleY}, 2.0f, RED);
     }
 
-    mRay camRay(mainCam->getPosition(), mainCam->getDirection());
-    hit = camRay.Raycast(3000.0f, *m_world, player);
     Color color = YELLOW;
-    if (hit.hit)
+    if (m_centerHit)
     {
         color = RED;
     }
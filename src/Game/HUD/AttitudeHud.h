@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine/System/HUD/IGameHud.h"
 #include "raylib.h"
+#include "Engine/Math/Math.h"
 
 class GameWorld;
 class GameObject;
@@ -13,7 +14,7 @@ public:
 
     void OnEnter() override {};
     void FixedUpdate(float fixedDeltaTime) override {};
-    void Update(float deltaTime) override {};
+    void Update(float deltaTime) override;
     void Draw() override;
     void OnExit() override {};
 
@@ -21,6 +22,14 @@ private:
     GameObject *GetLocalPlayer() const;
     GameWorld *m_world = nullptr;
 
+    // Update 中读取姿态与射线结果, Draw 只用缓存 (异步物理时绘制与物理步并行)
+    bool m_hasPlayer = false;
+    float m_speedFactor = 0.0f;
+    float m_pitchDeg = 0.0f;
+    float m_rollRad = 0.0f;
+    Vector3f m_aimPoint;
+    bool m_centerHit = false;
+
     void DrawPitchLine(float pitchDeg, float rollRad, float centerOffsetDeg,
                        float centerX, float centerY,
                        float width, Color color, float pixelsPerDegree) const;
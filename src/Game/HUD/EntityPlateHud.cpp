@@ -55,7 +55,8 @@ void EntityPlateHud::Draw()
             displayName = "Player " + std::to_string(sync.ownerClientID);
 
         const auto &tf = obj->GetComponent<TransformComponent>();
-        Vector3f anchorWorldPos = tf.GetWorldPosition();
+        // 渲染姿态, 与绘制出的机体一致
+        Vector3f anchorWorldPos = tf.GetRenderPosition();
         anchorWorldPos.y() += m_anchorHeight;
 
         Vector2 screenPos{};
@@ -83,6 +83,8 @@ void GameplayScreen::ConfigCallback(ScriptingFactory &scriptingFactory, PhysicsS
                                  { return std::make_unique<CollisionStage>(); });
     physicsStageFactory.Register("GravityStage", []()
                                  { return std::make_unique<GravityStage>(); });
+    physicsStageFactory.Register("FlightDynamicsStage", []()
+                                 { return std::make_unique<FlightDynamicsStage>(); });
 
     // 注册脚本
     scriptingFactory.Register("RotatorScript", []()
@@ -143,6 +145,7 @@ void GameplayScreen::OnEnter()
         const auto &config = screenManager->GetActiveConfig();
         serverHost = config.serverIP;
         serverPort = config.serverPort;
+        m_world->SetAsyncPhysics(config.asyncPhysics);
     }
     auto &netClient = m_world->GetNetworkClient();
     if (netClient.GetConnectionState() == ConnectionState::Disconnected)
@@ -191,6 +194,20 @@ void GameplayScreen::OnEnter()
 
                                                              //  m_world->GetAudioManager().PlaySpatial("explosion", e.hitpoint, 5.0f, 50.0f, e.relativeVelocity.Length() / 4, randomPitch);
                                                          });
+    // ProjectileSystem 中的子弹命中
+    m_world->GetEventManager().Subscribe<ProjectileHitEvent>([this](const ProjectileHitEvent &e)
+                                                             {
+                                                                 if (!e.victim)
+                                                                     return;
+                                                                 m_world->GetParticleSystem().Spawn("Collision",
+                                                                                                    e.point,
+                                                                                                    "relVel", e.velocity,
+                                                                                                    "normal", e.normal,
+                                                                                                    "impulse", e.damage,
+                                                                                                    "maxSpeed", e.velocity.Length() / 4);
+                                                                 if (e.victim->GetScript<HealthScript>())
+                                                                     m_world->GetEventManager().Emit(DamageEvent(e.victim, e.damage, e.point));
+                                                             });
     // m_world->GetParticleSystem().Spawn("SPH", Vector3f(0.0f, 3.0f, 0.0f));
 }
 
@@ -234,9 +251,29 @@ void GameplayScreen::FixedUpdate(float fixedDeltaTime)
     m_world->FixedUpdate(fixedDeltaTime);
 }
 
-void GameplayScreen::Update(float deltaTime)
+void GameplayScreen::SetInterpolationAlpha(float alpha)
+{
+    m_world->SetInterpolationAlpha(alpha);
+}
+
+bool GameplayScreen::IsSimulationBusy() const
+{
+    return m_world->IsPhysicsBusy();
+}
+
+bool GameplayScreen::IsSimulationAsync() const
 {
+    return m_world->IsAsyncPhysics();
+}
 
+void GameplayScreen::BeginAsyncSimulation()
+{
+    m_world->BeginAsyncPhysics();
+}
+
+void GameplayScreen::Update(float deltaTime)
+{
+    // 物理线程仍在计算时世界只更新不碰刚体与世界姿态的部分, 其余推迟并补上时间; 输入/HUD/相机/退出照常处理
     if (!m_world->Update(deltaTime))
         m_nextScreenState = MAIN_MENU;
 
@@ -345,6 +382,10 @@ void GameplayScreen::Draw()
     int active = (int)m_world->GetActivateGameObjects().size();
     DrawText(TextFormat("Total Entities: %d", total), 10, 50, 20, WHITE);
     DrawText(TextFormat("Active Entities: %d", active), 10, 80, 20, GREEN);
+    const RenderStats &renderStats = m_world->GetRenderer().GetRenderStats();
+    DrawText(TextFormat("Draws: %d  Shader Binds: %d  State Changes: %d", (int)renderStats.draws,
+                        (int)renderStats.shaderBinds, (int)renderStats.stateChanges),
+             10, 110, 20, WHITE);
 
     if (m_hudManager)
     {
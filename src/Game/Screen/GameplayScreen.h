@@ -15,6 +15,10 @@ public:
     void OnEnter() override;
     void FixedUpdate(float fixedDeltaTime) override;
     void Update(float deltaTime) override;
+    void SetInterpolationAlpha(float alpha) override;
+    bool IsSimulationBusy() const override;
+    bool IsSimulationAsync() const override;
+    void BeginAsyncSimulation() override;
     void Draw() override;
     void OnExit() override;
     ScreenState GetNextScreenState() const override;
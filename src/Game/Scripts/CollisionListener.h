@@ -10,10 +10,11 @@ public:
     void OnCreate() override
     {
         auto &em = owner->GetOwnerWorld()->GetEventManager();
-        m_subID = em.Subscribe<CollisionEvent>([this](const CollisionEvent &e)
-                                               { this->OnCollision(e); });
+        // 只关心开始接触, 持续接触的每一步不会重复触发
+        m_subID = em.Subscribe<ContactBeginEvent>([this](const ContactBeginEvent &e)
+                                                  { this->OnCollision(e); });
     }
-    void OnCollision(const CollisionEvent &e)
+    void OnCollision(const ContactBeginEvent &e)
     {
         if (__SHOWINFO__)
             std::cout << "[CollisionListener]: I HEARD A COLLISION!!!" << std::endl;
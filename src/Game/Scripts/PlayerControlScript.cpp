@@ -3,6 +3,7 @@
 #include "Engine/Core/GameObject/GameObject.h"
 #include "Engine/Core/Components/TransformComponent.h"
 #include "Engine/Core/Components/RigidBodyComponent.h"
+#include "Engine/Core/Components/AircraftComponent.h"
 #include "Engine/System/Input/InputManager.h"
 #include "Engine/Core/GameWorld.h"
 
@@ -50,69 +51,99 @@ void PlayerControlScript::Initialize(const json &data)
 
 void PlayerControlScript::OnCreate()
 {
-
-    auto &rb = owner->GetComponent<RigidbodyComponent>();
-    Vector3f size = rb.localAABB.max - rb.localAABB.min;
-
-    m_wingArea = size.x() * size.z();    // 机翼面积
-    m_frontalArea = size.x() * size.y(); // 阻力面积
+    // 气动力由 FlightDynamicsStage 计算; 预制体没有 AircraftComponent 时用脚本参数补上
+    if (owner->HasComponent<AircraftComponent>())
+        return;
+    auto &ac = owner->AddComponent<AircraftComponent>();
+    ac.owner = owner;
+    ac.maxThrust = m_maxThrust;
+    ac.liftCoefficient = m_liftCoefficient;
+    ac.dragCoefficient = m_dragCoefficient;
+    ac.pitchPower = m_pitchPower;
+    ac.rollPower = m_rollPower;
+    ac.yawPower = m_yawPower;
 }
 void PlayerControlScript::OnFixedUpdate(float dt)
 {
     CalculatePhysics(dt);
 }
 
-void PlayerControlScript::CalculatePhysics(float dt)
+void PlayerControlScript::OnUpdate(float dt)
 {
-    auto &rb = owner->GetComponent<RigidbodyComponent>();
-    auto &tf = owner->GetComponent<TransformComponent>();
+    UpdateFollowCamera(dt);
+}
+
+void PlayerControlScript::UpdateFollowCamera(float dt)
+{
+    auto *camera = owner->GetOwnerWorld()->GetCameraManager().GetCamera("follow_2");
+    if (!camera || !camera->IsEnable())
+        return;
     auto &input = owner->GetOwnerWorld()->GetInputManager();
 
-    Matrix4f worldMat = tf.GetWorldMatrix();
-    Vector3f forward = tf.GetForward();
-    Vector3f up = tf.GetUp();
+    // 以插值后的渲染姿态为焦点, 与机体的绘制位置一致
+    auto &planeTf = owner->GetComponent<TransformComponent>();
+    Vector3f planePos = planeTf.GetRenderPosition();
+    Vector3f planeForward = planeTf.GetRenderMatrix().getCol(2).xyz().Normalized();
 
-    float airspeed = rb.velocity.Length();
-    Vector3f velDir = (airspeed > 0.01f) ? rb.velocity.Normalized() : forward;
+    if (!m_isCamInit)
+    {
+        m_camDir = planeForward;
+        m_focusPos = planePos;
+        m_smoothedDist = m_camFinalDist;
+        m_isCamInit = true;
+    }
+
+    float lookH = input.GetAxisValue("LookHorizontal") * 0.01f;
+    float lookV = input.GetAxisValue("LookVertical") * 0.01f;
+    m_camDir.RotateByAxixAngle(Vector3f::UP, -lookH);
+    Vector3f camRight = (m_camDir ^ Vector3f::UP).Normalized();
+    Vector3f nextDir = m_camDir;
+    nextDir.RotateByAxixAngle(camRight, lookV);
+    if (abs(nextDir * Vector3f::UP) < 0.98f)
+    {
+        m_camDir = nextDir;
+    }
+    m_camDir.Normalize();
+    float focusLag = 1.0f - expf(-15.0f * dt);
+    Vector3f targetFocus = planePos + Vector3f(0, 5.5f, 0);
+    m_focusPos = Vector3f::Lerp(m_focusPos, targetFocus, focusLag);
 
-    // Angle of Attack - AoA
-    float aoa = acos(std::clamp(forward * velDir, -1.0f, 1.0f));
+    // 原先每个 60Hz 固定步插值 0.1, 换算为与帧率无关的指数平滑
+    float smoothFactor = 1.0f - expf(-6.3f * dt);
+    m_smoothedDist = Lerp(m_smoothedDist, m_camFinalDist, smoothFactor);
+    Vector3f finalCamPos = m_focusPos - (m_camDir * m_smoothedDist);
 
-    // Lift:  L = 1/2 * p * v^2 * S * Cl
-    float liftMag = airspeed * airspeed * m_wingArea * m_liftCoefficient;
+    if (input.IsActionDown("MainView"))
+    {
+        m_camDir = Vector3f::Lerp(m_camDir, planeForward, smoothFactor);
+    }
+    camera->UpdateFromDirection(finalCamPos, m_camDir, Vector3f::UP);
+    camera->setFovy(60.0f * (1.0f + m_camSpeedFactor));
+}
 
-    // 45度达到最大升力
-    float liftFactor = sin(aoa * 2.0f);
-    Vector3f liftDir = up;
-    rb.AddForce(liftDir * (liftMag * liftFactor));
+void PlayerControlScript::CalculatePhysics(float dt)
+{
+    auto &rb = owner->GetComponent<RigidbodyComponent>();
+    auto &tf = owner->GetComponent<TransformComponent>();
+    auto &input = owner->GetOwnerWorld()->GetInputManager();
+    auto &ac = owner->GetComponent<AircraftComponent>();
 
-    // Drag
-    float dragMag = airspeed * airspeed * m_frontalArea * m_dragCoefficient;
-    float inducedDrag = liftMag * sin(aoa) * 0.5f;
-    rb.AddForce((-velDir) * (dragMag + inducedDrag));
+    Vector3f forward = tf.GetForward();
 
+    // 只写控制输入, 升力/阻力/推力/操纵力矩由 FlightDynamicsStage 统一计算
     if (input.IsActionDown("Thrust"))
-    {
-        rb.AddForce(forward * m_maxThrust);
-        // 粒子
-    }
+        ac.throttle = 1.0f;
     else if (input.IsActionDown("Brake"))
-    {
-        rb.AddForce((-forward) * (m_maxThrust * 0.5f));
-    }
-
-    float pitchInput = input.GetAxisValue("Pitch");
-    float rollInput = input.GetAxisValue("Roll");
-    float yawInput = input.GetAxisValue("Yaw");
+        ac.throttle = -0.5f;
+    else
+        ac.throttle = 0.0f;
+    ac.pitch = input.GetAxisValue("Pitch");
+    ac.roll = input.GetAxisValue("Roll");
+    ac.yaw = input.GetAxisValue("Yaw");
 
     // 高速时更灵活，低速失控
-    float speedFactor = std::clamp(airspeed / 100.0f, 0.0f, 1.0f);
-    Vector3f localTorque = {
-        pitchInput * m_pitchPower * speedFactor,
-        yawInput * m_yawPower * speedFactor,
-        rollInput * m_rollPower * speedFactor};
-    Vector3f worldTorque = tf.GetWorldRotation() * (localTorque);
-    rb.AddTorque(worldTorque);
+    float airspeed = rb.velocity.Length();
+    float speedFactor = ac.controlSpeed > 0.0f ? std::clamp(airspeed / ac.controlSpeed, 0.0f, 1.0f) : 1.0f;
 
     if (auto *camera = owner->GetOwnerWorld()->GetCameraManager().GetCamera("follow"))
     {
@@ -140,46 +171,11 @@ void PlayerControlScript::CalculatePhysics(float dt)
 
         if ((camera = owner->GetOwnerWorld()->GetCameraManager().GetCamera("follow_2")))
         {
-            if (camera->IsEnable())
+            // 相机位姿在 OnUpdate 中逐帧更新, 这里只保留对准力矩
+            m_camFinalDist = finalDist;
+            m_camSpeedFactor = speedFactor;
+            if (camera->IsEnable() && m_isCamInit)
             {
-                auto &planeTf = owner->GetComponent<TransformComponent>();
-                Vector3f planePos = planeTf.GetWorldPosition();
-
-                if (!m_isCamInit)
-                {
-                    m_camDir = planeTf.GetForward();
-                    m_focusPos = planePos;
-                    m_smoothedDist = finalDist;
-                    m_isCamInit = true;
-                }
-
-                float lookH = input.GetAxisValue("LookHorizontal") * 0.01f;
-                float lookV = input.GetAxisValue("LookVertical") * 0.01f;
-                m_camDir.RotateByAxixAngle(Vector3f::UP, -lookH);
-                Vector3f camRight = (m_camDir ^ Vector3f::UP).Normalized();
-                Vector3f nextDir = m_camDir;
-                nextDir.RotateByAxixAngle(camRight, lookV);
-                if (abs(nextDir * Vector3f::UP) < 0.98f)
-                {
-                    m_camDir = nextDir;
-                }
-                m_camDir.Normalize();
-                float focusLag = 1.0f - expf(-15.0f * dt);
-                Vector3f targetFocus = planePos + Vector3f(0, 5.5f, 0);
-                m_focusPos = Vector3f::Lerp(m_focusPos, targetFocus, focusLag);
-
-                float zoomSmoothFactor = 1.0f - expf(-8.0f * dt);
-                m_smoothedDist = Lerp(m_smoothedDist, finalDist, 0.1f);
-                Vector3f finalCamPos = m_focusPos - (m_camDir * m_smoothedDist);
-
-                if (input.IsActionDown("MainView"))
-                {
-                    Vector3f tarCamDir = planeTf.GetForward();
-                    m_camDir = Vector3f::Lerp(m_camDir, tarCamDir, 0.1f);
-                }
-                camera->UpdateFromDirection(finalCamPos, m_camDir, Vector3f::UP);
-                camera->setFovy(60.0f * (1.0f + speedFactor));
-
                 // 鼠标微操
                 float dot = m_camDir * forward;
                 float alignThreshold = std::cos(m_alignmentTheta * 3.1415926535f / 180.0f);
@@ -11,6 +11,7 @@ public:
     void Initialize(const json &data) override;
     void OnCreate() override;
     void OnFixedUpdate(float dt) override;
+    void OnUpdate(float dt) override;
 
 private:
     float m_maxThrust = 80.0f;      // 最大推力
@@ -22,11 +23,9 @@ private:
     float m_rollPower = 50.0f;
     float m_yawPower = 15.0f;
 
-    // 面积
-    float m_wingArea = 1.0f;
-    float m_frontalArea = 1.0f;
-
     void CalculatePhysics(float dt);
+    // follow_2 相机逐帧跟随
+    void UpdateFollowCamera(float dt);
 
     float m_zoomSpeed = 2.0f;
     float m_minCamDist = 5.0f;
@@ -37,6 +36,9 @@ private:
     Vector3f m_camDir = Vector3f(0, 0, 1);
     Vector3f m_focusPos;
     float m_smoothedDist = 0.0f;
+    // 固定步中算出的相机距离与速度系数, 供逐帧更新使用
+    float m_camFinalDist = 10.0f;
+    float m_camSpeedFactor = 0.0f;
     float m_alignmentStrength = 15.0f;
     float m_alignmentTheta = 30.0f;
     float m_alignmentDamping = 0.5f;
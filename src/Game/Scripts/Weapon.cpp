@@ -102,6 +102,7 @@ void MineScript::OnFixedUpdate(float dt)
     if (!m_isArmed)
         return;
 
+    // 按中心距离触发, 不可碰撞的物体 (追踪弹等) 同样会引爆, 故不走 OverlapSphere
     Vector3f minePos = owner->GetComponent<TransformComponent>().GetWorldPosition();
     for (auto *gameObject : owner->GetOwnerWorld()->GetActivateGameObjects())
     {
@@ -144,6 +145,7 @@ void WeaponScript::Initialize(const json &data)
     m_fireRate_0 = data.value("fireRate_0", 0.15f);
     m_fireRate_1 = data.value("fireRate_1", 0.15f);
     m_fireRate_2 = data.value("fireRate_2", 0.15f);
+    m_lockRadius = data.value("lockRadius", 0.0f);
 }
 #include <random>
 void WeaponScript::OnUpdate(float deltaTime)
@@ -220,6 +222,9 @@ void WeaponScript::Bullet1(const InputManager &input)
             Vector3f spawnPos = tf.GetWorldPosition() + tf.GetForward() * 3.0f - tf.GetUp() * 3.5f;
             mRay aimRay(camera->Position(), camera->Direction());
             mRaycastHit hit = aimRay.Raycast(3000.0f, *owner->GetOwnerWorld(), owner);
+            if (!hit.hit && m_lockRadius > 0.0f)
+                owner->GetOwnerWorld()->GetPhysicsSystem().SphereCast(*owner->GetOwnerWorld(), aimRay.origin, aimRay.direction,
+                                                                      m_lockRadius, 3000.0f, hit, owner);
 
             std::string name = "missile_" + std::to_string(rand());
             GameObject *missile = owner->GetOwnerWorld()->GetPool("missile").Spawn(name, "missile", spawnPos, tf.GetWorldRotation());
@@ -231,7 +236,8 @@ void WeaponScript::Bullet1(const InputManager &input)
                 auto *trackScript = missile->GetScript<TrackingBulletScript>();
                 if (trackScript)
                 {
-                    if (hit.hit)
+                    // 命中静态几何时没有可追踪的物体
+                    if (hit.hit && hit.entity)
                     {
                         trackScript->SetTarget(hit.entity);
 
@@ -262,6 +268,17 @@ void WeaponScript::Bullet0(const InputManager &input)
             float width = owner->GetComponent<RigidbodyComponent>().localAABB.max.x();
             Vector3f spawnVel = owner->GetComponent<RigidbodyComponent>().velocity;
             Vector3f spawnPos = tf.GetWorldPosition() + tf.GetForward() * (dis(gen) * 0.5f) - tf.GetUp() * 0.5f + tf.GetRight() * width * 1.5f;
+            // 场景配置了 bullet 投射物时走 ProjectileSystem, 否则用对象池
+            auto &projectiles = owner->GetOwnerWorld()->GetProjectileSystem();
+            int projectileType = projectiles.FindType("bullet");
+            if (projectileType >= 0)
+            {
+                Vector3f velocity = tf.GetForward() * m_bulletVelocity_0 + spawnVel;
+                projectiles.Spawn(projectileType, spawnPos, velocity, owner);
+                spawnPos = tf.GetWorldPosition() + tf.GetForward() * (dis(gen) * 0.5f) - tf.GetUp() * 0.5f - tf.GetRight() * width * 1.5f;
+                projectiles.Spawn(projectileType, spawnPos, velocity, owner);
+                continue;
+            }
             // 修改名字以区分不同类型的子弹和owner
             std::string name = "bullet_" + std::to_string(rand());
             GameObject *bullet = owner->GetOwnerWorld()->GetPool("bullet").Spawn(name, "bullet", spawnPos, tf.GetWorldRotation());
@@ -67,6 +67,8 @@ public:
     float m_fireRate_1 = 0.15f;
     float m_bulletVelocity_1 = 0.0f;
     float m_fireRate_2 = 0.15f;
+    // 导弹锁定: 射线未命中时用该半径的球扫掠, 0 为只用射线
+    float m_lockRadius = 0.0f;
 
     int bulletType = 0;
     int bulletTypeCount = 3;
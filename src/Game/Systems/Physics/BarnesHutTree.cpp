@@ -0,0 +1,251 @@
+#include "BarnesHutTree.h"
+#include "Engine/Math/Core/MathSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+void BarnesHutTree::AccumulateDirect(const float *x, const float *y, const float *z, const float *mass, int begin, int end,
+                                     float px, float py, float pz, float &ax, float &ay, float &az)
+{
+    const float minDist2 = MIN_DIST * MIN_DIST;
+    int j = begin;
+#ifdef NW_MATH_SSE
+    __m128 vpx = _mm_set1_ps(px), vpy = _mm_set1_ps(py), vpz = _mm_set1_ps(pz);
+    __m128 vmin = _mm_set1_ps(minDist2);
+    __m128 vone = _mm_set1_ps(1.0f);
+    __m128 sx = _mm_setzero_ps(), sy = _mm_setzero_ps(), sz = _mm_setzero_ps();
+    for (; j + 4 <= end; j += 4)
+    {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + j), vpx);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + j), vpy);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(z + j), vpz);
+        __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        __m128 valid = _mm_cmpgt_ps(d2, vmin);
+        // 无效通道先置 1 避免除零, 结果再由掩码清零
+        __m128 safe = _mm_or_ps(_mm_and_ps(valid, d2), _mm_andnot_ps(valid, vone));
+        __m128 inv = _mm_div_ps(vone, _mm_mul_ps(safe, _mm_sqrt_ps(safe)));
+        __m128 s = _mm_and_ps(valid, _mm_mul_ps(_mm_loadu_ps(mass + j), inv));
+        sx = _mm_add_ps(sx, _mm_mul_ps(s, dx));
+        sy = _mm_add_ps(sy, _mm_mul_ps(s, dy));
+        sz = _mm_add_ps(sz, _mm_mul_ps(s, dz));
+    }
+    alignas(16) float bx[4], by[4], bz[4];
+    _mm_store_ps(bx, sx);
+    _mm_store_ps(by, sy);
+    _mm_store_ps(bz, sz);
+    ax += (bx[0] + bx[1]) + (bx[2] + bx[3]);
+    ay += (by[0] + by[1]) + (by[2] + by[3]);
+    az += (bz[0] + bz[1]) + (bz[2] + bz[3]);
+#endif
+    for (; j < end; j++)
+    {
+        float dx = x[j] - px, dy = y[j] - py, dz = z[j] - pz;
+        float d2 = dx * dx + dy * dy + dz * dz;
+        if (d2 <= minDist2)
+            continue;
+        float s = mass[j] / (d2 * std::sqrt(d2));
+        ax += s * dx;
+        ay += s * dy;
+        az += s * dz;
+    }
+}
+
+void BarnesHutTree::Build(const float *x, const float *y, const float *z, const float *mass, int count)
+{
+    m_nodes.clear();
+    m_order.resize(count);
+    m_scratch.resize(count);
+    if (count == 0)
+    {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+        m_mass.clear();
+        return;
+    }
+    m_srcX = x;
+    m_srcY = y;
+    m_srcZ = z;
+    m_srcMass = mass;
+
+    float minX = x[0], minY = y[0], minZ = z[0];
+    float maxX = x[0], maxY = y[0], maxZ = z[0];
+    for (int i = 0; i < count; i++)
+    {
+        m_order[i] = i;
+        minX = std::min(minX, x[i]);
+        minY = std::min(minY, y[i]);
+        minZ = std::min(minZ, z[i]);
+        maxX = std::max(maxX, x[i]);
+        maxY = std::max(maxY, y[i]);
+        maxZ = std::max(maxZ, z[i]);
+    }
+
+    Node root;
+    root.cx = 0.5f * (minX + maxX);
+    root.cy = 0.5f * (minY + maxY);
+    root.cz = 0.5f * (minZ + maxZ);
+    root.halfSize = 0.5f * std::max(maxX - minX, std::max(maxY - minY, maxZ - minZ)) * 1.001f + 1e-4f;
+    m_nodes.reserve(count / std::max(1, m_leafSize) * 2 + 8);
+    m_nodes.push_back(root);
+    BuildNode(0, 0, count, 0);
+
+    m_x.resize(count);
+    m_y.resize(count);
+    m_z.resize(count);
+    m_mass.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        int k = m_order[i];
+        m_x[i] = x[k];
+        m_y[i] = y[k];
+        m_z[i] = z[k];
+        m_mass[i] = mass[k];
+    }
+}
+
+void BarnesHutTree::BuildNode(int nodeIndex, int begin, int end, int depth)
+{
+    float mass = 0.0f, mx = 0.0f, my = 0.0f, mz = 0.0f;
+    for (int i = begin; i < end; i++)
+    {
+        int k = m_order[i];
+        mass += m_srcMass[k];
+        mx += m_srcMass[k] * m_srcX[k];
+        my += m_srcMass[k] * m_srcY[k];
+        mz += m_srcMass[k] * m_srcZ[k];
+    }
+    {
+        Node &node = m_nodes[nodeIndex];
+        node.begin = begin;
+        node.end = end;
+        node.mass = mass;
+        if (mass > 0.0f)
+        {
+            node.mx = mx / mass;
+            node.my = my / mass;
+            node.mz = mz / mass;
+        }
+        else
+        {
+            node.mx = node.cx;
+            node.my = node.cy;
+            node.mz = node.cz;
+        }
+        if (end - begin <= m_leafSize || depth >= MAX_DEPTH)
+            return;
+    }
+
+    // 按卦限计数排序
+    const Node parent = m_nodes[nodeIndex];
+    int counts[8] = {0};
+    auto octant = [&](int k)
+    {
+        return (m_srcX[k] >= parent.cx ? 1 : 0) | (m_srcY[k] >= parent.cy ? 2 : 0) | (m_srcZ[k] >= parent.cz ? 4 : 0);
+    };
+    for (int i = begin; i < end; i++)
+        counts[octant(m_order[i])]++;
+    int offsets[8];
+    offsets[0] = begin;
+    for (int c = 1; c < 8; c++)
+        offsets[c] = offsets[c - 1] + counts[c - 1];
+    int cursor[8];
+    std::copy(offsets, offsets + 8, cursor);
+    for (int i = begin; i < end; i++)
+        m_scratch[cursor[octant(m_order[i])]++] = m_order[i];
+    std::copy(m_scratch.begin() + begin, m_scratch.begin() + end, m_order.begin() + begin);
+
+    // 只为非空卦限建子节点, 子节点连续存放
+    const int firstChild = (int)m_nodes.size();
+    const float h = parent.halfSize * 0.5f;
+    int octants[8];
+    int childCount = 0;
+    for (int c = 0; c < 8; c++)
+    {
+        if (counts[c] == 0)
+            continue;
+        Node child;
+        child.cx = parent.cx + ((c & 1) ? h : -h);
+        child.cy = parent.cy + ((c & 2) ? h : -h);
+        child.cz = parent.cz + ((c & 4) ? h : -h);
+        child.halfSize = h;
+        m_nodes.push_back(child);
+        octants[childCount++] = c;
+    }
+    m_nodes[nodeIndex].firstChild = firstChild;
+    m_nodes[nodeIndex].childCount = childCount;
+    for (int i = 0; i < childCount; i++)
+    {
+        int c = octants[i];
+        BuildNode(firstChild + i, offsets[c], offsets[c] + counts[c], depth + 1);
+    }
+}
+
+void BarnesHutTree::ComputeAcceleration(float px, float py, float pz, float theta, float &ax, float &ay, float &az) const
+{
+    ax = ay = az = 0.0f;
+    if (m_nodes.empty())
+        return;
+    const float theta2 = theta * theta;
+
+    // 叶子内物体与近似节点先收集进交互表, 攒满后用直接求和核一次算完
+    constexpr int BATCH = 256;
+    alignas(16) float bx[BATCH], by[BATCH], bz[BATCH], bm[BATCH];
+    int count = 0;
+    auto flush = [&]()
+    {
+        AccumulateDirect(bx, by, bz, bm, 0, count, px, py, pz, ax, ay, az);
+        count = 0;
+    };
+
+    int stack[8 * MAX_DEPTH + 8];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node &node = m_nodes[stack[--top]];
+        if (node.mass <= 0.0f)
+            continue;
+        if (node.firstChild < 0)
+        {
+            const int size = node.end - node.begin;
+            if (count + size > BATCH)
+                flush();
+            if (size > BATCH)
+            {
+                AccumulateDirect(m_x.data(), m_y.data(), m_z.data(), m_mass.data(), node.begin, node.end, px, py, pz, ax, ay, az);
+                continue;
+            }
+            // 叶子通常只有几个物体, 逐个拷贝比 memmove 调用便宜
+            for (int j = node.begin; j < node.end; j++, count++)
+            {
+                bx[count] = m_x[j];
+                by[count] = m_y[j];
+                bz[count] = m_z[j];
+                bm[count] = m_mass[j];
+            }
+            continue;
+        }
+
+        float dx = node.mx - px, dy = node.my - py, dz = node.mz - pz;
+        float d2 = dx * dx + dy * dy + dz * dz;
+        float size = 2.0f * node.halfSize;
+        // 点在节点外且张角足够小时用质心近似
+        bool outside = std::fabs(px - node.cx) > node.halfSize || std::fabs(py - node.cy) > node.halfSize ||
+                       std::fabs(pz - node.cz) > node.halfSize;
+        if (outside && size * size < theta2 * d2)
+        {
+            if (count == BATCH)
+                flush();
+            bx[count] = node.mx;
+            by[count] = node.my;
+            bz[count] = node.mz;
+            bm[count] = node.mass;
+            count++;
+            continue;
+        }
+        for (int c = 0; c < node.childCount; c++)
+            stack[top++] = node.firstChild + c;
+    }
+    flush();
+}
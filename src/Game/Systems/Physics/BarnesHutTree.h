@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Barnes-Hut 八叉树
+// 每步由打包的位置/质量数组重建, 叶子内物体在排序数组中连续存放, 叶子内部直接求和
+class BarnesHutTree
+{
+public:
+    void Build(const float *x, const float *y, const float *z, const float *mass, int count);
+
+    // 返回 sum(m_j * d / |d|^3), 乘以 G*m_i 即为受力; 距离 <= minDist 的物体 (包括自身) 跳过
+    void ComputeAcceleration(float px, float py, float pz, float theta, float &ax, float &ay, float &az) const;
+
+    // 直接求和核, 有 SSE 时每次处理 4 个物体
+    static void AccumulateDirect(const float *x, const float *y, const float *z, const float *mass, int begin, int end,
+                                 float px, float py, float pz, float &ax, float &ay, float &az);
+
+    // 物体在树中的顺序; 按此顺序求值时相邻物体的遍历路径相近, 缓存命中高
+    const std::vector<int> &GetOrder() const { return m_order; }
+
+    void SetLeafSize(int leafSize) { m_leafSize = leafSize < 1 ? 1 : leafSize; }
+    size_t GetNodeCount() const { return m_nodes.size(); }
+
+    static constexpr float MIN_DIST = 1e-5f;
+
+private:
+    struct Node
+    {
+        float cx, cy, cz, halfSize; // 包围立方体
+        float mx, my, mz, mass;     // 质心与总质量
+        int firstChild = -1;        // 非空子节点连续存放, -1 为叶子
+        int childCount = 0;
+        int begin = 0, end = 0;     // 排序数组中的范围
+    };
+
+    void BuildNode(int nodeIndex, int begin, int end, int depth);
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_order;
+    std::vector<int> m_scratch;
+    std::vector<float> m_x, m_y, m_z, m_mass; // 按树序排列
+    const float *m_srcX = nullptr, *m_srcY = nullptr, *m_srcZ = nullptr, *m_srcMass = nullptr;
+    int m_leafSize = 8;
+    static constexpr int MAX_DEPTH = 32;
+};
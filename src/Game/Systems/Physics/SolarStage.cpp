@@ -7,10 +7,47 @@
 #include "SolarStage.h"
 #include "Engine/Engine.h"
 #include <iostream>
+#if !defined(PLATFORM_WEB)
+#include <omp.h>
+#endif
 void SolarStage::Initialize(const json &config)
 {
     m_G = config.value("G", 0.1);
+    std::string method = config.value("method", "auto");
+    if (method == "auto")
+        m_method = NBodyMethod::AUTO;
+    else if (method == "direct")
+        m_method = NBodyMethod::DIRECT;
+    else if (method == "barnesHut")
+        m_method = NBodyMethod::BARNES_HUT;
+    else
+        std::cerr << "[SolarStage]: Unknown method: " << method << ", fallback to auto" << std::endl;
+    m_theta = config.value("theta", 0.5f);
+    m_directThreshold = config.value("directThreshold", 4096);
+    m_tree.SetLeafSize(config.value("leafSize", 8));
+}
+
+void SolarStage::Gather(GameWorld &world)
+{
+    m_bodies.clear();
+    m_x.clear();
+    m_y.clear();
+    m_z.clear();
+    m_mass.clear();
+    for (auto &gameObject : world.GetActivateGameObjects())
+    {
+        if (!gameObject->HasComponent<RigidbodyComponent>() || !gameObject->HasComponent<TransformComponent>())
+            continue;
+        auto &rb = gameObject->GetComponent<RigidbodyComponent>();
+        Vector3f pos = gameObject->GetComponent<TransformComponent>().GetWorldPosition();
+        m_bodies.push_back(&rb);
+        m_x.push_back(pos.x());
+        m_y.push_back(pos.y());
+        m_z.push_back(pos.z());
+        m_mass.push_back(rb.mass);
+    }
 }
+
 void SolarStage::Execute(GameWorld &world, float fixedDeltaTime)
 {
     auto &gameObjects = world.GetActivateGameObjects();
@@ -20,31 +57,47 @@ void SolarStage::Execute(GameWorld &world, float fixedDeltaTime)
             std::cout << "[SloarStage]:Empty Game World" << std::endl;
         return;
     }
-    for (auto &gameObject : gameObjects)
-    {
-        if (gameObject->HasComponent<RigidbodyComponent>() && gameObject->HasComponent<TransformComponent>())
-        {
-            auto &rb = gameObject->GetComponent<RigidbodyComponent>();
-            auto &transform = gameObject->GetComponent<TransformComponent>();
-            for (auto &otherGameObject : gameObjects)
-            {
-                if (gameObject == otherGameObject)
-                    continue;
-                if (!otherGameObject->HasComponent<RigidbodyComponent>() ||
-                    !otherGameObject->HasComponent<TransformComponent>())
-                    continue;
-
-                auto &otherRb = otherGameObject->GetComponent<RigidbodyComponent>();
-                auto &otherTransform = otherGameObject->GetComponent<TransformComponent>();
+    PhysicsTimer timer;
+    m_treeMs = m_forceMs = 0.0;
+    m_usedTree = false;
+    Gather(world);
+    m_gatherMs = timer.Lap();
+    const int n = (int)m_bodies.size();
+    if (n < 2)
+        return;
 
-                auto distance = Vector3f::Distance(transform.GetWorldPosition(), otherTransform.GetWorldPosition());
-                if (distance <= 1e-5f)
-                    continue;
+    const bool useTree = m_method == NBodyMethod::BARNES_HUT ||
+                         (m_method == NBodyMethod::AUTO && n > m_directThreshold);
+    if (useTree)
+        m_tree.Build(m_x.data(), m_y.data(), m_z.data(), m_mass.data(), n);
+    m_usedTree = useTree;
+    m_treeMs = timer.Lap();
 
-                auto f = m_G * rb.mass * otherRb.mass / (distance * distance);
-                auto F = (otherTransform.GetWorldPosition() - transform.GetWorldPosition()).Normalized() * f;
-                rb.AddForce(F);
-            }
-        }
+    // 每个物体只写自己的受力, 可直接并行
+#if !defined(PLATFORM_WEB)
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for (int k = 0; k < n; k++)
+    {
+        // 树模式按树序求值, 相邻物体共享遍历路径
+        const int i = useTree ? m_tree.GetOrder()[k] : k;
+        float ax = 0.0f, ay = 0.0f, az = 0.0f;
+        if (useTree)
+            m_tree.ComputeAcceleration(m_x[i], m_y[i], m_z[i], m_theta, ax, ay, az);
+        else
+            BarnesHutTree::AccumulateDirect(m_x.data(), m_y.data(), m_z.data(), m_mass.data(), 0, n,
+                                            m_x[i], m_y[i], m_z[i], ax, ay, az);
+        const float scale = m_G * m_mass[i];
+        m_bodies[i]->AddForce(Vector3f(ax * scale, ay * scale, az * scale));
     }
+    m_forceMs = timer.Lap();
+}
+
+void SolarStage::GetStats(StageStats &outStats) const
+{
+    outStats.AddSection("gather", m_gatherMs);
+    outStats.AddSection("tree", m_treeMs);
+    outStats.AddSection("forces", m_forceMs);
+    outStats.AddCounter("bodies", m_bodies.size());
+    outStats.AddCounter("barnesHut", m_usedTree ? 1 : 0);
 }
@@ -1,8 +1,20 @@
 #pragma once
 #include "Engine/System/Physics/IPhysicsStage.h"
+#include "Engine/System/Physics/Profiling/PhysicsStats.h"
 #include "Engine/System/Input/InputManager.h"
+#include "BarnesHutTree.h"
 #include "raylib.h"
+#include <vector>
 class GameWorld;
+struct RigidbodyComponent;
+
+enum class NBodyMethod
+{
+    AUTO,
+    DIRECT,
+    BARNES_HUT,
+};
+
 class SolarStage : public IPhysicsStage
 {
 public:
@@ -11,7 +23,25 @@ public:
     void Execute(GameWorld &world, float fixedDeltaTime) override;
 
     void Initialize(const json &config) override;
+    // 分段: gather / tree / forces
+    void GetStats(StageStats &outStats) const override;
 
 private:
+    void Gather(GameWorld &world);
+
     float m_G = 0.1f;
+    NBodyMethod m_method = NBodyMethod::AUTO;
+    // 张角阈值, 0 退化为精确求和
+    float m_theta = 0.5f;
+    // AUTO 模式下物体数不超过该值时直接求和
+    int m_directThreshold = 4096;
+
+    // 每步打包的物体状态
+    std::vector<RigidbodyComponent *> m_bodies;
+    std::vector<float> m_x, m_y, m_z, m_mass;
+    BarnesHutTree m_tree;
+
+    // 最近一步的统计
+    double m_gatherMs = 0.0, m_treeMs = 0.0, m_forceMs = 0.0;
+    bool m_usedTree = false;
 };
\ No newline at end of file